@@ -17,6 +17,8 @@
 #include <printf_P.h>
 #include <lpc2xxx.h>
 #include <consol.h>
+#include "clock.h"
+#include "alphalcd.h"
 
 /***********/
 /* Defines */
@@ -28,6 +30,42 @@
 #define LCD_RS        0x01000000  // P1.24
 #define LCD_BACKLIGHT 0x40000000  // P0.30
 
+// size of the command queue, has to be a power of 2
+#define ALPHA_QUEUE_SIZE  64
+#define ALPHA_QUEUE_MASK  (ALPHA_QUEUE_SIZE - 1)
+
+// flags of a queued command, the low byte holds the data
+#define ALPHA_CHAR        0x0100  // written with RS set
+#define ALPHA_SLOW        0x0200  // needs more than 1.5 ms to execute
+
+// time needed by the display to execute a command
+#define ALPHA_FAST_CYCLES (40 * CLOCK_CYCLES_PER_US)
+#define ALPHA_SLOW_CYCLES (5 * CLOCK_CYCLES_PER_MS)
+
+// "set DDRAM address" command and the address of the second line
+#define ALPHA_SET_ADDRESS 0x80
+#define ALPHA_SECOND_LINE 0x40
+
+/*************/
+/* Variables */
+/*************/
+
+static tU16 alphaQueue[ALPHA_QUEUE_SIZE];
+static volatile tU8 alphaHead;
+static volatile tU8 alphaTail;
+
+// time of the last write and the time its command needs to execute
+static tU32 alphaLastWrite;
+static tU32 alphaBusyCycles;
+
+// contents of the display after executing all queued commands
+static char alphaShadow[ALPHA_LINES][ALPHA_COLUMNS];
+
+// address of the cursor after executing all queued commands
+static tU8 alphaCursor;
+
+static tU8 initialized;
+
 /*************/
 /* Functions */
 /*************/
@@ -49,20 +87,6 @@ static void initLCD(void) {
     IOCLR0 = LCD_BACKLIGHT;
 }
 
-/*****************************************************************************
- *
- * Description:
- *    Generates 37us delay which is needed after calling writeLCD function.
- *
- ****************************************************************************/
-static void delay37us(void) {
-    volatile tU32 i;
-
-    for (i = 0; i < 6 * 2500; i++) {
-        asm volatile (" nop");
-    }
-}
-
 /*****************************************************************************
  *
  * Description:
@@ -119,63 +143,160 @@ static void lcdBacklight(tU8 onOff) {
 /*****************************************************************************
  *
  * Description:
- *    Displays text on the screen.
- * 
+ *    Queues a command for the display.
+ *
  * Params:
- *    [in] str - the text to be displayed
- *    [in] data - a flag indicating if the backlight should be turned on
+ *    [in] command - data to be sent with ALPHA_CHAR and ALPHA_SLOW flags
+ *
+ * Returns:
+ *    tU8 - TRUE if the command was queued, FALSE if the queue is full
  *
  ****************************************************************************/
-void messageOnAlpha(char *str, tU8 keepBacklight) {
-    char *ptr;
-    static tU8 initialized;
+static tU8 queueCommand(tU16 command) {
+    tU8 head = (alphaHead + 1) & ALPHA_QUEUE_MASK;
 
-    if (initialized == 0) {
-        initLCD();
-        initialized = 1;
+    if (head == alphaTail) {
+        return FALSE;
+    }
+    alphaQueue[head] = command;
+    alphaHead = head;
+    return TRUE;
+}
 
-        // display clear
-        writeLCD(0, 0x01);
-        osSleep(1);
+/*****************************************************************************
+ *
+ * Description:
+ *    Sends the next queued command to the display if the previous one
+ *    has been executed. Never waits for the display: a command still
+ *    executing leaves the queue for the next call, so at most one command
+ *    is sent per call. Called from appTick(), so it runs in interrupt
+ *    context.
+ *
+ ****************************************************************************/
+void alphaTick(void) {
+    tU16 command;
+
+    if (alphaTail == alphaHead || CLOCK_SINCE(alphaLastWrite) < alphaBusyCycles) {
+        return;
     }
 
+    command = alphaQueue[(alphaTail + 1) & ALPHA_QUEUE_MASK];
+    writeLCD(0 != (command & ALPHA_CHAR), command & 0xff);
+    alphaLastWrite = CLOCK_NOW();
+    alphaBusyCycles = (command & ALPHA_SLOW) ? ALPHA_SLOW_CYCLES : ALPHA_FAST_CYCLES;
+    alphaTail = (alphaTail + 1) & ALPHA_QUEUE_MASK;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Initializes the display once, queuing its configuration.
+ *    Called by the first write, if not called earlier.
+ *
+ ****************************************************************************/
+void initAlphaLcd(void) {
+    tU8 line, column;
+
+    if (initialized) {
+        return;
+    }
+    initialized = TRUE;
+    initLCD();
     lcdBacklight(TRUE);
 
     // function set
-    writeLCD(0, 0x30);
-    osSleep(1);
-    writeLCD(0, 0x30);
-    delay37us();
-    writeLCD(0, 0x30);
-    delay37us();
+    queueCommand(0x30 | ALPHA_SLOW);
+    queueCommand(0x30 | ALPHA_SLOW);
+    queueCommand(0x30);
 
-    // function set
-    writeLCD(0, 0x38);
-    delay37us();
+    // function set: 8 bits, 2 lines
+    queueCommand(0x38);
 
     // display off
-    writeLCD(0, 0x08);
-    delay37us();
-
-    // display control set
-    writeLCD(0, 0x06);
-    osSleep(1);
-
-    // display control set
-    writeLCD(0, 0x0c);
-    delay37us();
-
-    // cursor home
-    writeLCD(0, 0x02);
-    osSleep(1);
-
-    for (ptr = str; *ptr; ptr++) {
-        if ('\n' != *ptr) {
-            writeLCD(1, *ptr);
-        } else {
-            writeLCD(0, 0x80 | 0x40);
+    queueCommand(0x08);
+
+    // display clear, moves the cursor home
+    queueCommand(0x01 | ALPHA_SLOW);
+
+    // entry mode set: incrementing addresses
+    queueCommand(0x06);
+
+    // display on, cursor off
+    queueCommand(0x0c);
+
+    for (line = 0; line < ALPHA_LINES; ++line) {
+        for (column = 0; column < ALPHA_COLUMNS; ++column) {
+            alphaShadow[line][column] = ' ';
+        }
+    }
+    alphaCursor = 0;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Writes text on a line of the display. Only the characters different
+ *    from the current contents are queued, together with the cursor moves
+ *    they need, so the call does not wait for the display.
+ *    Characters that do not fit in the queue are written by the next call.
+ *
+ * Params:
+ *    [in] line   - line of the display, 0 or 1
+ *    [in] column - column of the first character
+ *    [in] text   - the text, cut at the end of the line
+ *
+ ****************************************************************************/
+void writeAlpha(tU8 line, tU8 column, const char *text) {
+    tU8 address;
+
+    initAlphaLcd();
+
+    for (; *text && column < ALPHA_COLUMNS; ++text, ++column) {
+        if (alphaShadow[line][column] == *text) {
+            continue;
+        }
+
+        address = line * ALPHA_SECOND_LINE + column;
+        if (alphaCursor != address) {
+            if (!queueCommand(ALPHA_SET_ADDRESS | address)) {
+                return;
+            }
+            alphaCursor = address;
+        }
+        if (!queueCommand(ALPHA_CHAR | (tU8) *text)) {
+            return;
+        }
+        alphaShadow[line][column] = *text;
+        ++alphaCursor;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays text on the screen, starting from the first line.
+ *
+ * Params:
+ *    [in] str - the text to be displayed, '\n' starts the second line
+ *    [in] keepBacklight - a flag indicating if the backlight should be turned on
+ *
+ ****************************************************************************/
+void messageOnAlpha(char *str, tU8 keepBacklight) {
+    char line[ALPHA_COLUMNS + 1];
+    tU8 lineNumber = 0;
+    tU8 length = 0;
+
+    for (;; ++str) {
+        if ('\n' == *str || 0 == *str) {
+            line[length] = 0;
+            writeAlpha(lineNumber, 0, line);
+            if (0 == *str || ++lineNumber == ALPHA_LINES) {
+                break;
+            }
+            length = 0;
+        } else if (length < ALPHA_COLUMNS) {
+            line[length++] = *str;
         }
-        delay37us();
     }
 
     lcdBacklight(keepBacklight);
@@ -5,16 +5,27 @@
  * 
  * Description:
  *    The library is responsible for displaying messages on the alphanumeric display.
+ *    Writes are queued and sent to the display by alphaTick() in the timer tick.
  * 
  *****************************************************************************/
 
 #ifndef ALPHALCD_H_
 #define ALPHALCD_H_
 
+/***********/
+/* Defines */
+/***********/
+
+#define ALPHA_LINES   2
+#define ALPHA_COLUMNS 16
+
 /*************/
 /* Functions */
 /*************/
 
+void initAlphaLcd(void);
+void alphaTick(void);
+void writeAlpha(tU8 line, tU8 column, const char *text);
 void messageOnAlpha(char *str, tU8 keepBacklight);
 
 #endif /* ALPHALCD_H_ */
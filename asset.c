@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * File:
+ *    asset.c
+ *
+ * Description:
+ *    Reader of the asset blob.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "asset.h"
+
+/*************/
+/* Variables */
+/*************/
+
+// blob the assets are read from
+static const tU8 *assets = assetBlob;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Switches to another blob, e.g. one copied from the SD card
+ *    into memory. The blob has to be aligned to 4 bytes.
+ *
+ * Params:
+ *    [in] blob - the blob
+ *
+ * Returns:
+ *    tBool - TRUE if the blob is valid and was switched to
+ *
+ ****************************************************************************/
+tBool useAssets(const tU8 *blob) {
+    const AssetHeader *header = (const AssetHeader *) blob;
+
+    if (ASSET_MAGIC != header->magic || ASSET_VERSION != header->version) {
+        return FALSE;
+    }
+    assets = blob;
+    return TRUE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Finds an asset in the table of contents.
+ *
+ * Params:
+ *    [in] id - id of the asset (ASSET_... in assets/assetids.h)
+ *
+ * Returns:
+ *    const AssetEntry* - the entry or NULL if there is no such asset
+ *
+ ****************************************************************************/
+const AssetEntry *getAsset(tU16 id) {
+    const AssetHeader *header = (const AssetHeader *) assets;
+
+    if (ASSET_MAGIC != header->magic || id >= header->count) {
+        return NULL;
+    }
+    return (const AssetEntry *) (assets + sizeof(AssetHeader)) + id;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the data of an asset, in place.
+ *
+ * Params:
+ *    [in] id - id of the asset (ASSET_... in assets/assetids.h)
+ *
+ * Returns:
+ *    const tU8* - the data or NULL if there is no such asset
+ *
+ ****************************************************************************/
+const tU8 *getAssetData(tU16 id) {
+    const AssetEntry *entry = getAsset(id);
+
+    return entry ? assets + entry->offset : NULL;
+}
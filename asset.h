@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * File:
+ *    asset.h
+ *
+ * Description:
+ *    Reader of the asset blob built by host/assetpack.py from
+ *    assets/manifest.txt. The blob is linked into flash (assets.S),
+ *    so the assets are read in place, without copying.
+ *
+ *    Blob layout (little endian):
+ *       magic "PACA", version, number of assets,
+ *       table of contents (one AssetEntry per asset),
+ *       data of every asset aligned to 4 bytes
+ *
+ *****************************************************************************/
+
+#ifndef _ASSET_H_
+#define _ASSET_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "assets/assetids.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define ASSET_MAGIC         0x41434150  // "PACA"
+#define ASSET_VERSION       1
+
+// kinds of assets
+#define ASSET_SOUND         1
+#define ASSET_BOARD         2
+#define ASSET_SPRITES       3
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU32 magic;
+    tU16 version;
+    tU16 count;
+} AssetHeader;
+
+typedef struct {
+    tU8  kind;
+    tU8  frames;    // number of sprites in a sheet, 1 otherwise
+    tU16 rate;      // sample rate of a sound in Hz
+    tU8  width;     // width of a board or a sprite
+    tU8  height;    // height of a board or a sprite
+    tU16 reserved;
+    tU32 offset;    // from the beginning of the blob
+    tU32 size;      // in bytes
+} AssetEntry;
+
+/*************/
+/* Variables */
+/*************/
+
+// the blob linked into flash by assets.S
+extern const tU8 assetBlob[];
+
+/*************/
+/* Functions */
+/*************/
+
+tBool useAssets(const tU8 *blob);
+const AssetEntry *getAsset(tU16 id);
+const tU8 *getAssetData(tU16 id);
+
+#endif
@@ -0,0 +1,19 @@
+/******************************************************************************
+ *
+ * File:
+ *    assetids.h
+ *
+ * Description:
+ *    Ids of the assets packed from manifest.txt.
+ *    Generated with host/assetpack.py, do not edit.
+ *
+ *****************************************************************************/
+
+#ifndef ASSET_IDS_H_
+#define ASSET_IDS_H_
+
+#define ASSET_BEGINNING_SOUND          0
+
+#define ASSET_COUNT 1
+
+#endif
@@ -5,6 +5,11 @@
  * 
  * Description:
  *    The library is responsible for communication over Bluetooth.
+ *    The modem is configured by a state machine executing a script of
+ *    AT commands. It is driven by btPoll(), which takes received bytes
+ *    from the UART #1 receive buffer without blocking, matches them
+ *    incrementally against the expected answers (Knuth-Morris-Pratt)
+ *    and checks the timeouts, so the setup runs in the background.
  * 
  *****************************************************************************/
 
@@ -14,17 +19,79 @@
 
 #include "bluetooth.h"
 #include "uart.h"
+#include "clock.h"
 #include "startup/config.h"
-#include "pre_emptive_os/api/osapi.h"
 #include "pre_emptive_os/api/general.h"
-#include "alphalcd.h"
-#include "startup/printf_P.h"
+#include "log.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// modem control lines
+#define BT_RESET_PIN    0x00008000  // P0.15
+#define BT_DTR_PIN      0x00002000  // P0.13
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    void (*action)(void);   // executed when the step starts, may be NULL
+    const char *command;    // sent when the step starts, may be NULL
+    const char *expected;   // answer finishing the step, NULL if the step only waits
+    tU16 timeout;           // in milliseconds
+} BtStep;
+
+typedef struct {
+    const char *pattern;
+    tU8 length;
+    tU8 matched;
+    tU8 failure[MAX_PATTERN_LENGTH];
+} Matcher;
+
+/*************/
+/* Functions */
+/*************/
+
+static void resetModemLow(void);
+static void resetModemHigh(void);
 
 /*************/
 /* Variables */
 /*************/
 
-tU8 answerBuffer[MAX_ANSWER_BUFFER];
+// configuration script, equivalent of the former sequence of blocking waits
+static const BtStep btScript[] = {
+    {resetModemLow,  NULL,               NULL,     50},
+    {resetModemHigh, NULL,               NULL,    250},
+    {NULL,           "+++",              NULL,    200},
+    {NULL,           NULL,               "OK",   1000},
+    {NULL,           "\n+STFC=0\n",      "STFC",   1000},
+    {NULL,           NULL,               "OK",   1000},
+    {NULL,           "\n+STAUTO=0\n",    "STAUTO", 1000},
+    {NULL,           NULL,               "OK",   1000},
+    {NULL,           "\n+STWMOD=0\n",    "STWMOD", 1000},
+    {NULL,           NULL,               "OK",   1000},
+    {NULL,           "\n+STNA=pacman\n", "STNA", 1000},
+    {NULL,           NULL,               "OK",   1000},
+    {NULL,           NULL,               NULL,   1000},
+    {NULL,           "\n+INQ=1\n",       "OK",   1000}
+};
+
+#define BT_SCRIPT_STEPS (sizeof (btScript) / sizeof (btScript[0]))
+
+static BtState btState = BT_OFF;
+static tU8 btStep;
+static tU32 btStepStart;
+
+static Matcher stepMatcher;
+static Matcher connectedMatcher;
+static Matcher resultMatcher;
+
+static tU8 *pendingResult = NULL;
+
+static void (*handleData)(tU8 received, tU32 timestamp) = NULL;
 
 /*************/
 /* Functions */
@@ -33,71 +100,227 @@ tU8 answerBuffer[MAX_ANSWER_BUFFER];
 /*****************************************************************************
  *
  * Description:
- *    Waits for a particular answer to be received over Bluetooth.
+ *    Prepares a matcher for given pattern, computing the KMP failure table.
+ *
+ * Params:
+ *    [out] matcher - matcher to be prepared
+ *    [in] pattern - NULL-terminated pattern, at most MAX_PATTERN_LENGTH long
+ *
+ ****************************************************************************/
+static void initMatcher(Matcher *matcher, const char *pattern) {
+    tU8 i, k = 0;
+
+    matcher->pattern = pattern;
+    matcher->matched = 0;
+    for (matcher->length = 0; pattern[matcher->length]
+            && matcher->length < MAX_PATTERN_LENGTH; ++matcher->length)
+        ;
+
+    matcher->failure[0] = 0;
+    for (i = 1; i < matcher->length; ++i) {
+        while (k > 0 && pattern[i] != pattern[k]) {
+            k = matcher->failure[k - 1];
+        }
+        if (pattern[i] == pattern[k]) {
+            ++k;
+        }
+        matcher->failure[i] = k;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Feeds one received character into the matcher.
  *
  * Params:
- *    [in] expectedAnswer - the answer which is expected to be received
- *    [in] answerLength - length of the expected answer
- *    [in] maxLength - number of characters after which the function fails if
- *                     it does not receive the expected answer
+ *    [inout] matcher - matcher of the expected answer
+ *    [in] received - received character
  *
  * Returns:
- *    tBool - TRUE if the answer has been received
- *            FALSE if maxLength characters has been received not containing
- *                  the expected answer
+ *    tBool - TRUE if the character completes the pattern
+ *
+ ****************************************************************************/
+static tBool feedMatcher(Matcher *matcher, tU8 received) {
+    while (matcher->matched > 0 && matcher->pattern[matcher->matched] != received) {
+        matcher->matched = matcher->failure[matcher->matched - 1];
+    }
+    if (matcher->pattern[matcher->matched] == received) {
+        ++matcher->matched;
+    }
+    if (matcher->matched == matcher->length) {
+        matcher->matched = matcher->failure[matcher->length - 1];
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Actions driving the reset line of the modem
+ *
+ ****************************************************************************/
+static void resetModemLow(void) {
+    IODIR0 |= BT_RESET_PIN;
+    IOSET0 = BT_RESET_PIN;
+    IOCLR0 = BT_RESET_PIN;
+}
+
+static void resetModemHigh(void) {
+    IOSET0 = BT_RESET_PIN;
+
+    // indicate Data Terminal Ready, RTS (P0.10) is left to the joystick,
+    // so the script turns the hardware flow control of the modem off
+    IODIR0 |= BT_DTR_PIN;
+    IOSET0 = BT_DTR_PIN;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Starts given step of the configuration script.
  *
  ****************************************************************************/
-tBool waitForAnswer(char *expectedAnswer, tU8 answerLength, tU8 maxLength) {
-    if (maxLength > MAX_ANSWER_BUFFER) {
-        maxLength = MAX_ANSWER_BUFFER;
+static void startStep(tU8 step) {
+    const BtStep *current = &btScript[step];
+
+    btStep = step;
+    btStepStart = CLOCK_NOW();
+
+    if (current->action) {
+        current->action();
     }
+    if (current->command) {
+        uart1SendString((tU8 *) current->command);
+    }
+    if (current->expected) {
+        initMatcher(&stepMatcher, current->expected);
+    }
+}
 
-    printf("\nOczekuje na odpowiedz: %s\n", expectedAnswer);
-    printf("Przyjmuje maksymalnie %d znakow\n", maxLength);
-    printf("Dane z UART1:\n");
-
-    tU8 i;
-    for (i = 0; i < maxLength; ++i) {
-        answerBuffer[i] = uart1GetCh();
-        printf("%c", answerBuffer[i]);
-        if (i >= answerLength - 1) {
-            tU8 k;
-            for (k = 0; k < answerLength; ++k) {
-                if (expectedAnswer[k] != answerBuffer[i - answerLength + k + 1]) {
-                    break;
-                }
-            }
-            if (k == answerLength) {
-                printf("\nOtrzymalem oczekiwana odpowiedz\n\n");
-                return TRUE;
+/*****************************************************************************
+ *
+ * Description:
+ *    Finishes the current step and starts the next one or enters
+ *    the ready state after the last step.
+ *
+ ****************************************************************************/
+static void nextStep(void) {
+    if (btStep + 1 < BT_SCRIPT_STEPS) {
+        startStep(btStep + 1);
+    } else {
+        LOG_INFO(LOG_BT_CONFIGURED);
+        btState = BT_READY;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Handles a character received in the ready or connected state.
+ *
+ ****************************************************************************/
+static void receiveData(tU8 received, tU32 timestamp) {
+    if (handleData) {
+        handleData(received, timestamp);
+    }
+    if (feedMatcher(&connectedMatcher, received)) {
+        LOG_INFO(LOG_BT_CONNECTED);
+        btState = BT_CONNECTED;
+    }
+    if (feedMatcher(&resultMatcher, received) && pendingResult) {
+        LOG_INFO(LOG_BT_RESULT_REQUESTED);
+        uart1SendString(pendingResult);
+        pendingResult = NULL;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Drives the Bluetooth state machine. Never blocks, should be called
+ *    regularly, e.g. once in every step of the game loop.
+ *
+ ****************************************************************************/
+void btPoll(void) {
+    tU8 received;
+    tU32 timestamp;
+
+    if (BT_OFF == btState) {
+        return;
+    }
+
+    // steps that only wait leave the answers in the UART buffer for the
+    // step expecting them, e.g. the "OK" of "+++" arrives during its wait
+    while ((BT_CONFIGURING != btState || btScript[btStep].expected)
+            && uart1GetCharStamped(&received, &timestamp)) {
+        if (BT_CONFIGURING == btState) {
+            if (feedMatcher(&stepMatcher, received)) {
+                nextStep();
             }
+        } else {
+            receiveData(received, timestamp);
         }
     }
-    printf("\nNie otrzymalem oczekiwanej odpowiedzi\n\n");
-    return FALSE;
+
+    if (BT_CONFIGURING == btState
+            && CLOCK_SINCE(btStepStart) >= btScript[btStep].timeout * CLOCK_CYCLES_PER_MS) {
+        if (btScript[btStep].expected) {
+            LOG_WARN(LOG_BT_NO_RESPONSE, btStep);
+        }
+        nextStep();
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Sets the handler of data received after the configuration.
+ *
+ * Params:
+ *    [in] handler - function called with every received byte and the cycle
+ *                   clock value of its arrival
+ *
+ ****************************************************************************/
+void onBluetoothData(void (*handler)(tU8 received, tU32 timestamp)) {
+    handleData = handler;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the state of the Bluetooth connection.
+ *
+ ****************************************************************************/
+BtState getBluetoothState(void) {
+    return btState;
 }
 
 /*****************************************************************************
  *
  * Description:
  *    Send textual data over Bluetooth.
+ *    The text is sent when the connected device requests the result
+ *    and has to stay valid until then.
  *
  * Params:
  *    [in] text - text to be sent
  *
  ****************************************************************************/
 void sendDataThroughBluetooth(unsigned char *text) {
-    if (waitForAnswer("BTSTATE:4", 9, 250)) {
-        printf("\nOtrzymalem BTSTATE:4\n");
-        waitForAnswer("result", 6, 250);
-        printf("\nOtrzymalem prosbe o wynik gry\n");
-    } else {
-        printf("\nNIE otrzymalem BTSTATE:4\n");
-    }
+    LOG_INFO(LOG_BT_RESULT_PENDING);
+    pendingResult = text;
+}
 
-    printf("\nProbuje wyslac: %s\n", text);
-    uart1SendString(text);
-    printf("\nTekst zostal przeslany\n");
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if the text passed to sendDataThroughBluetooth() has been sent.
+ *
+ ****************************************************************************/
+tBool isBluetoothDataSent(void) {
+    return NULL == pendingResult;
 }
 
 /*****************************************************************************
@@ -106,73 +329,23 @@ void sendDataThroughBluetooth(unsigned char *text) {
  *    Initializes Bluetooth communication.
  *    The device runs in "slave" mode and waits to be inquired by another
  *    device which requests to get the result of the game.
+ *    Only starts the configuration, which is carried on by btPoll().
  *
  ****************************************************************************/
 void initBluetooth(void) {
 
-    printf("\n --------------------------------------------------- \n");
-
     // Baud rate: 38400
     // Bits of data: 8
     // Pairity bit: none
     // Stop bits: 1
     // UART FIFO queue size: 8
     initUart1(B38400(CORE_FREQ / PBSD), UART_8N1, UART_FIFO_8);
-    printf("\nZainicjalizowalem UART1\n");
-
-    osSleep(5);
-
-    // reset modem settings
-    IODIR0 |= 0x00008000;
-    IOSET0 = 0x00008000;
-    IOCLR0 = 0x00008000;
-    osSleep(2);
-    IOSET0 = 0x00008000;
-
-    // indicate Request To Send and Data Terminal Ready
-    IODIR0 |= 0x00000400; //P0.10 - RTS output
-    IOCLR0 = 0x00000400;
-    IODIR0 |= 0x00002000; //P0.13 - DTR output
-    IOSET0 = 0x00002000;
-    printf("\nZrestartowalem ustawienia modemu\n");
-
-    osSleep(25);
-
-    uart1SendString((unsigned char*) "+++");
-    printf("Wyslalem sekwencje +++\n");
-
-    osSleep(20);
-
-    waitForAnswer("OK", 2, 200);
-
-    uart1SendString((unsigned char*) "\n+STAUTO=0\n");
-    printf("\nWylaczylem automatyczne laczenie\n");
-
-    waitForAnswer("STAUTO", 6, 240);
-    waitForAnswer("OK", 2, 240);
-
-    printf("\nUstawiam tryb Slave\n");
-
-    uart1SendString((unsigned char*) "\n+STWMOD=0\n");
-    printf("\nWyslalem STWMOD\n");
-
-    waitForAnswer("STWMOD", 6, 240);
-    waitForAnswer("OK", 2, 240);
-
-    printf("\nZmieniam nazwe\n");
-    uart1SendString((unsigned char*) "\n+STNA=pacman\n");
-    printf("\nWyslalem STNA\n");
-
-    waitForAnswer("STNA", 4, 240);
-    waitForAnswer("OK", 2, 240);
-
-    osSleep(100);
-
-    printf("Zezwalam na odpytywanie\n");
-    uart1SendString((unsigned char*) "\n+INQ=1\n");
-    printf("\nWyslalem INQ\n");
+    LOG_INFO(LOG_BT_UART_READY);
 
-    waitForAnswer("OK", 2, 240);
+    initMatcher(&connectedMatcher, "BTSTATE:4");
+    initMatcher(&resultMatcher, "result");
+    pendingResult = NULL;
 
-    printf("\nZakonczylem inicjalizacje\n");
+    btState = BT_CONFIGURING;
+    startStep(0);
 }
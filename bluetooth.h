@@ -11,18 +11,40 @@
 #ifndef _bluetooth_h_
 #define _bluetooth_h_
 
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
 /***********/
 /* Defines */
 /***********/
 
-#define MAX_ANSWER_BUFFER	250
+// maximal length of an answer expected from the modem
+#define MAX_PATTERN_LENGTH	16
+
+/*********/
+/* Types */
+/*********/
+
+typedef enum {
+    BT_OFF,             // not initialized
+    BT_CONFIGURING,     // executing the configuration script
+    BT_READY,           // configured, waiting for a connection
+    BT_CONNECTED        // another device has connected
+} BtState;
 
 /*************/
 /* Functions */
 /*************/
 
 void initBluetooth(void);
+void btPoll(void);
+BtState getBluetoothState(void);
+void onBluetoothData(void (*handler)(tU8 received, tU32 timestamp));
 
 void sendDataThroughBluetooth(unsigned char *text);
+tBool isBluetoothDataSent(void);
 
 #endif
@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * File:
+ *    clock.c
+ *
+ * Description:
+ *    Free-running cycle clock based on the timer #1 counter.
+ *    The counter wraps after about 71 seconds, so only differences
+ *    between its values are meaningful.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "clock.h"
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Starts timer #1 counting peripheral clock cycles without stopping
+ *    or resetting on matches. Has to be called after eaInit(), which uses
+ *    the timer for the consol startup delay.
+ *
+ ****************************************************************************/
+void initClock(void) {
+    T1TCR = 0x02;          // stop and reset the timer
+    T1PR  = 0x00;          // no prescaler, one tick per peripheral clock cycle
+    T1MCR = 0x00;          // no actions on matches, the counter runs freely
+    T1IR  = 0xff;          // reset all interrupt flags
+    T1TCR = 0x01;          // start the timer
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Busy-waits until given number of cycles elapses from given clock value.
+ *
+ * Params:
+ *    [in] start - clock value the delay is measured from
+ *    [in] cycles - length of the delay in cycles
+ *
+ ****************************************************************************/
+void waitCycles(tU32 start, tU32 cycles) {
+    while (CLOCK_SINCE(start) < cycles)
+        ;
+}
@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * File:
+ *    clock.h
+ *
+ * Description:
+ *    Free-running cycle clock based on the timer #1 counter.
+ *
+ *****************************************************************************/
+
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "startup/lpc2xxx.h"
+#include "startup/config.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// timer #1 counts peripheral clock cycles without a prescaler
+#define CLOCK_FREQ          (CORE_FREQ / PBSD)
+#define CLOCK_CYCLES_PER_US (CLOCK_FREQ / 1000000)
+#define CLOCK_CYCLES_PER_MS (CLOCK_FREQ / 1000)
+
+// current value of the clock, a single load of the timer counter
+#define CLOCK_NOW()         ((tU32) T1TC)
+
+// number of cycles elapsed since given clock value, valid across the wrap
+#define CLOCK_SINCE(start)  ((tU32) (CLOCK_NOW() - (start)))
+
+/*************/
+/* Functions */
+/*************/
+
+void initClock(void);
+void waitCycles(tU32 start, tU32 cycles);
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "diskio.h"
 #include "spi.h"
+#include "spibus.h"
 #include "sd.h"
 #include "startup/printf_P.h"
 
@@ -50,18 +51,22 @@
  *                STA_READY, if initialization was successful
  ****************************************************************************/
 DSTATUS disk_initialize (){
+	DSTATUS status = STA_READY;
+
+	spiBusAcquire(SPI_BUS_SD);
 	initSpi(); /*init at low speed */
 
 	if (sdInit() < 0) {
-		return STA_NOINIT;
-	}
-
-	if (sdState() < 0) {
-		return STA_NOREADY;
+		status = STA_NOINIT;
+	} else if (sdState() < 0) {
+		status = STA_NOREADY;
+	} else {
+		/* the bus manager keeps the speed for the following reads */
+		setSpiSpeed(8);
 	}
 
-	setSpiSpeed(8);
-	return STA_READY;
+	spiBusRelease();
+	return status;
 }
 
 
@@ -82,8 +87,6 @@ DSTATUS disk_initialize (){
 DRESULT disk_readp (BYTE* dest,	DWORD sector, WORD sofs, WORD count) {
 	DRESULT res;
 
-	setSpiSpeed(8);
-
 	BYTE cardresp = 0;
 	BYTE firstblock = 0;
 	BYTE c = 0;
@@ -91,6 +94,7 @@ DRESULT disk_readp (BYTE* dest,	DWORD sector, WORD sofs, WORD count) {
 	DWORD i = 0;
 
 	DWORD place = SECTOR_SIZE * sector;
+	spiBusAcquire(SPI_BUS_SD);
 	sdCommand(CARD_CMD_READ, (WORD) (place >> 16), (WORD) place);
 
 	cardresp = sdResp8b(); /* Card response */
@@ -102,6 +106,7 @@ DRESULT disk_readp (BYTE* dest,	DWORD sector, WORD sofs, WORD count) {
 
 	if(cardresp != CARD_OK_RESP || firstblock != START_BLOCK) {
 		sdResp8bError(firstblock);
+		spiBusRelease();
 		return RES_ERROR;
 	}
 	SELECT_CARD();
@@ -122,6 +127,7 @@ DRESULT disk_readp (BYTE* dest,	DWORD sector, WORD sofs, WORD count) {
 	spiSend(0xff);
 	spiSend(0xff);
     UNSELECT_CARD();
+	spiBusRelease();
 	res = RES_OK;
 
 	return res;
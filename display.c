@@ -29,6 +29,60 @@
 #define COLOR_MESSAGE_BACKGROUND	0x00
 #define COLOR_TEXT					0xff
 
+// short names of the colors in the tiles
+#define BG	COLOR_BACKGROUND
+#define WL	COLOR_WALL
+#define PT	COLOR_POINT
+#define BN	COLOR_BONUS
+#define DR	COLOR_DOORS
+
+/*************/
+/* Variables */
+/*************/
+
+const tU8 tiles[TILES][FIELD_SIZE][FIELD_SIZE] = {
+    {   // TILE_EMPTY
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG}
+    },
+    {   // TILE_WALL
+        {WL, WL, WL, WL, WL, WL},
+        {WL, WL, WL, WL, WL, WL},
+        {WL, WL, WL, WL, WL, WL},
+        {WL, WL, WL, WL, WL, WL},
+        {WL, WL, WL, WL, WL, WL},
+        {WL, WL, WL, WL, WL, WL}
+    },
+    {   // TILE_POINT
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, PT, PT, BG, BG},
+        {BG, BG, PT, PT, BG, BG},
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BG, BG, BG, BG}
+    },
+    {   // TILE_BONUS
+        {BG, BG, BG, BG, BG, BG},
+        {BG, BG, BN, BN, BG, BG},
+        {BG, BN, BN, BN, BN, BG},
+        {BG, BN, BN, BN, BN, BG},
+        {BG, BG, BN, BN, BG, BG},
+        {BG, BG, BG, BG, BG, BG}
+    },
+    {   // TILE_DOORS
+        {DR, DR, DR, DR, DR, DR},
+        {DR, DR, DR, DR, DR, DR},
+        {DR, DR, DR, DR, DR, DR},
+        {DR, DR, DR, DR, DR, DR},
+        {DR, DR, DR, DR, DR, DR},
+        {DR, DR, DR, DR, DR, DR}
+    }
+};
+
 /*************/
 /* Functions */
 /*************/
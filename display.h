@@ -18,7 +18,9 @@
 // size of one side of the field in pixels
 #define FIELD_SIZE			6
 
-// colors of different objects on the board
+// colors of different objects on the board (RRRGGGBB), only the walls
+// and the eatable ghosts use the red and green levels reserved
+// for the palette effects (see palette.h)
 #define COLOR_BACKGROUND	0x00
 #define COLOR_WALL    		0x6d
 #define COLOR_PACMAN  		0xfc
@@ -28,7 +30,21 @@
 #define COLOR_DOORS		0xb1
 #define COLOR_EYES		0xff
 #define COLOR_EYES_BORDER       0xf6
-#define COLOR_EATABLE_GHOST     0x5b
+#define COLOR_EATABLE_GHOST     0x4b
+
+/*********/
+/* Types */
+/*********/
+
+// fields of the board drawn as whole tiles
+typedef enum {TILE_EMPTY, TILE_WALL, TILE_POINT, TILE_BONUS, TILE_DOORS, TILES} Tile;
+
+/********************/
+/* Extern variables */
+/********************/
+
+// pixels of the tiles, the same as drawn by displayEmptyField() and others
+extern const tU8 tiles[TILES][FIELD_SIZE][FIELD_SIZE];
 
 /*************/
 /* Functions */
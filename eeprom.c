@@ -4,8 +4,8 @@
  *    eeprom.c
  * 
  * Description:
- *    The library is responsible for communication with PCA9532 module and 
- *    retrieving temperature from the sensor.
+ *    The library is responsible for communication with PCA9532 module,
+ *    retrieving temperature from the sensor and accessing the eeprom memory.
  *
  *****************************************************************************/
 
@@ -15,12 +15,12 @@
 
 #include "../pre_emptive_os/api/general.h"
 #include "i2c.h"
+#include "eeprom.h"
 
 /***********/
 /* Defines */
 /***********/
 
-#define EEPROM_SIZE       0x2000  // 64kbit = 8KByte
 #define LOCAL_EEPROM_ADDR 0x0
 #define EEPROM_ADDR       0xA0
 
@@ -28,6 +28,9 @@
 #define I2C_EEPROM_RCV    (EEPROM_ADDR + (LOCAL_EEPROM_ADDR << 1) + 0x01)
 #define I2C_EEPROM_SND    (EEPROM_ADDR + (LOCAL_EEPROM_ADDR << 1) + 0x00)
 
+// attempts to address the eeprom while it finishes a write cycle (max 5 ms)
+#define EEPROM_POLL_TRIES 500
+
 /*************/
 /* Functions */
 /*************/
@@ -134,6 +137,176 @@ tS8 eepromStartRead(tU8 devAddr, tU16 address) {
     return retCode;
 }
 
+/******************************************************************************
+ *
+ * Description:
+ *    Sends the device address and the two byte memory address to the eeprom,
+ *    leaving the bus in a transfer.
+ *
+ * Params:
+ *    [in] address - eeprom address
+ *
+ * Returns:
+ *    I2C_CODE_OK or I2C_CODE_ERROR
+ *
+ *****************************************************************************/
+static tS8 eepromAddress(tU16 address) {
+    tS8 retCode = 0;
+
+    do {
+        /* generate Start condition */
+        retCode = i2cStart();
+        if (I2C_CODE_OK != retCode) {
+            break;
+        }
+
+        /* write eeprom address */
+        retCode = i2cWriteWithWait(I2C_EEPROM_SND);
+        if (I2C_CODE_OK != retCode) {
+            break;
+        }
+
+        /* write memory address, high byte first */
+        retCode = i2cWriteWithWait((tU8) (address >> 8));
+        if (I2C_CODE_OK != retCode) {
+            break;
+        }
+        retCode = i2cWriteWithWait((tU8) (address & 0xff));
+    } while (0);
+
+    return retCode;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Reads a block of the eeprom with a single sequential read.
+ *
+ * Params:
+ *    [in] address - eeprom address
+ *    [in] pBuf - buffer for received data
+ *    [in] len - number of bytes to read
+ *
+ * Returns:
+ *    I2C_CODE_OK or I2C_CODE_ERROR
+ *
+ *****************************************************************************/
+tS8 eepromRead(tU16 address, tU8* pBuf, tU16 len) {
+    tS8 retCode = 0;
+    tU8 status = 0;
+    tU16 i = 0;
+
+    retCode = eepromAddress(address);
+
+    if (I2C_CODE_OK == retCode) {
+        /* Generate Start condition */
+        retCode = i2cRepeatStart();
+    }
+
+    if (I2C_CODE_OK == retCode) {
+        /* Write SLA+R */
+        retCode = i2cPutChar(I2C_EEPROM_RCV);
+        while (I2C_CODE_BUSY == retCode) {
+            retCode = i2cPutChar(I2C_EEPROM_RCV);
+        }
+    }
+
+    if (I2C_CODE_OK == retCode) {
+        /* wait until address transmitted and receive data */
+        for (i = 1; i <= len; i++) {
+            /* wait until data transmitted */
+            while (1) {
+                /* Get new status */
+                status = i2cCheckStatus();
+
+                if ((0x40 == status) || (0x48 == status) || (0x50 == status)) {
+                    /* Data received */
+
+                    if (i == len) {
+                        /* Set generate NACK */
+                        retCode = i2cGetChar(I2C_MODE_ACK1, pBuf);
+                    } else {
+                        retCode = i2cGetChar(I2C_MODE_ACK0, pBuf);
+                    }
+
+                    /* Read data */
+                    retCode = i2cGetChar(I2C_MODE_READ, pBuf);
+                    while (I2C_CODE_EMPTY == retCode) {
+                        retCode = i2cGetChar(I2C_MODE_READ, pBuf);
+                    }
+                    pBuf++;
+
+                    break;
+                } else if (0xf8 != status) {
+                    /* ERROR */
+                    i = len;
+                    retCode = I2C_CODE_ERROR;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Generate Stop condition */
+    i2cStop();
+
+    return retCode;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Writes data within one page of the eeprom in a single page write
+ *    and waits until the eeprom finishes the write cycle.
+ *
+ * Params:
+ *    [in] address - eeprom address
+ *    [in] pBuf - bytes to write
+ *    [in] len - number of bytes, the block can not cross a page boundary
+ *
+ * Returns:
+ *    I2C_CODE_OK or I2C_CODE_ERROR
+ *
+ *****************************************************************************/
+tS8 eepromPageWrite(tU16 address, tU8* pBuf, tU16 len) {
+    tS8 retCode = 0;
+    tU16 i = 0;
+
+    if ((address % EEPROM_PAGE_SIZE) + len > EEPROM_PAGE_SIZE) {
+        return I2C_CODE_ERROR;
+    }
+
+    retCode = eepromAddress(address);
+
+    /* write data */
+    for (i = 0; I2C_CODE_OK == retCode && i < len; i++) {
+        retCode = i2cWriteWithWait(*pBuf);
+        pBuf++;
+    }
+
+    /* Generate Stop condition, starts the write cycle */
+    i2cStop();
+
+    if (I2C_CODE_OK != retCode) {
+        return retCode;
+    }
+
+    /* the eeprom does not acknowledge its address until the write ends */
+    for (i = 0; i < EEPROM_POLL_TRIES; i++) {
+        retCode = i2cStart();
+        if (I2C_CODE_OK == retCode) {
+            retCode = i2cWriteWithWait(I2C_EEPROM_SND);
+        }
+        i2cStop();
+
+        if (I2C_CODE_OK == retCode) {
+            break;
+        }
+    }
+
+    return retCode;
+}
+
 /******************************************************************************
  *
  * Description:
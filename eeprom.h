@@ -4,8 +4,8 @@
  *    eeprom.h
  * 
  * Description:
- *    The library is responsible for communication with PCA9532 module and 
- *    retrieving temperature from the sensor.
+ *    The library is responsible for communication with PCA9532 module,
+ *    retrieving temperature from the sensor and accessing the eeprom memory.
  *
  *****************************************************************************/
 
@@ -18,10 +18,21 @@
 
 #include "i2c.h"
 
+/***********/
+/* Defines */
+/***********/
+
+#define EEPROM_SIZE       0x2000  // 64kbit = 8KByte
+#define EEPROM_PAGE_SIZE  32      // bytes written by a single page write
+
 /*************/
 /* Functions */
 /*************/
 
+tS8 eepromRead(tU16 address, tU8* pBuf, tU16 len);
+
+tS8 eepromPageWrite(tU16 address, tU8* pBuf, tU16 len);
+
 tS8 lm75Read(tU8 address, tU8* pBuf, tU16 len);
 
 tS8 pca9532(tU8* pBuf, tU16 len, tU8* pBuf2, tU16 len2);
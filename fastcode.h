@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ * File:
+ *    fastcode.h
+ *
+ * Description:
+ *    Tag for hot functions executed from RAM instead of flash.
+ *
+ *    A function declared with FASTCODE is placed in the .fastcode section,
+ *    which the linker scripts put at the start of .data, so the startup
+ *    code copies it to RAM together with the initialized data. RAM has no
+ *    wait states and no MAM line misses. The files of FASTCODE_SRCS in the
+ *    makefile are compiled as ARM code with -O2, the rest stays THUMB.
+ *
+ *    RAM is out of the range of BL from flash (and back), so the tag also
+ *    makes the calls long. It has to be on the declaration in the header,
+ *    seen by every caller.
+ *
+ *****************************************************************************/
+
+#ifndef _FASTCODE_H_
+#define _FASTCODE_H_
+
+/***********/
+/* Defines */
+/***********/
+
+// set by the makefile, see FASTCODE there
+#ifndef FASTCODE_RAM
+#define FASTCODE_RAM 0
+#endif
+
+#if FASTCODE_RAM
+#define FASTCODE    __attribute__ ((long_call, section (".fastcode")))
+#else
+#define FASTCODE
+#endif
+
+#endif
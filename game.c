@@ -26,16 +26,18 @@
 #include "adc.h"
 #include "bluetooth.h"
 #include "sdcard.h"
-#include "startup/printf_P.h"
+#include "prof.h"
+#include "telemetry.h"
+#include "remote.h"
+#include "log.h"
+#include "highscore.h"
+#include "palette.h"
+#include "view.h"
 
 /***********/
 /* Defines */
 /***********/
 
-// position of the top-left corner of the board
-#define TOP_LEFT_X			1
-#define TOP_LEFT_Y			1
-
 // number of moving characters
 #define CHARACTERS			NUMBER_OF_GHOSTS + 1
 
@@ -43,6 +45,42 @@
 #define GAME_LOST			1
 #define GAME_WON			2
 
+// number of score digits on the alphanumeric LCD, higher scores saturate
+#define SCORE_DIGITS		8
+
+// bigger score changes are converted anew instead of counted digit by digit
+#define SCORE_MAX_STEP		100
+
+// steps of the game speed shown on the RGB LED
+#define GAME_SPEEDS			4
+
+// snapshots of the game passed from the logic to the render process
+#define SNAPSHOTS			2
+
+// remaining time of eating ghosts when they start to flash
+#define FRIGHTENED_FLASH_TIME	8
+
+// the render process runs below the game logic
+#define RENDER_STACK_SIZE	1200
+#define RENDER_PRIORITY		3
+
+/*********/
+/* Types */
+/*********/
+
+// State of one step of the game handed over to the render process.
+typedef struct {
+    Move moves[CHARACTERS];
+    // points and bonuses eaten when the step started
+    tU8 eatenFields[BOARD_BITMAP_SIZE];
+    // points and bonuses eaten or restored since the last rendered step
+    tU8 changedFields[BOARD_BITMAP_SIZE];
+    tU8 timeStep;
+    tU8 timeToEat;
+    tU8 lifeLost;
+    tU8 gameEnded;
+} Snapshot;
+
 /*************/
 /* Variables */
 /*************/
@@ -50,9 +88,6 @@
 // Number of ticks to wait between moves in game.
 static tU8 timeStep = 18;
 
-// Registered joystick position.
-tU8 pressedKey;
-
 // Movement direction.
 Direction direction;
 
@@ -63,7 +98,51 @@ tU8 gameEnded;
 tU8 lifeLost;
 
 // Current player's score.
-tU8 currentScore;
+tU32 currentScore;
+
+// Layout of the board read from the SD card and its size.
+static tU8 sdBoard[BOARD_MAX_HEIGHT * BOARD_MAX_WIDTH];
+static tU8 sdBoardWidth;
+static tU8 sdBoardHeight;
+
+// Decimal digits of the score on the alphanumeric LCD, leading zeros
+// are spaces. Follow displayedScore with carries instead of divisions.
+static char scoreDigits[SCORE_DIGITS + 1];
+static tU32 displayedScore;
+
+// Current number of lives.
+tU8 currentLives;
+
+// Current remaining time of eating ghosts.
+tU8 currentTimeToEat;
+
+// Snapshots and the queues passing them between the processes. The logic
+// fills a free snapshot and posts it as ready, the render process draws
+// the ready one and returns it as free.
+static Snapshot snapshots[SNAPSHOTS];
+static void *readyArea[SNAPSHOTS];
+static void *freeArea[SNAPSHOTS];
+static tQueue readySnapshots;
+static tQueue freeSnapshots;
+
+// Eaten points and bonuses as of the last posted snapshot.
+static tU8 postedFields[BOARD_BITMAP_SIZE];
+
+// Posted snapshots and the ones replaced before the render process took them.
+static tU32 postedSnapshots;
+static tU32 droppedSnapshots;
+
+static tU8 renderStack[RENDER_STACK_SIZE];
+
+// Colours of the RGB LED telling the game speed, the fastest first, and
+// the brightness of red telling it while Bluetooth takes blue and green.
+static const tU8 speedColours[GAME_SPEEDS][3] = {
+    {255, 0, 0}, {255, 255, 0}, {0, 255, 0}, {0, 0, 255}
+};
+static const tU8 speedRedLevels[GAME_SPEEDS] = {255, 64, 16, 4};
+
+// Given by the render process after it has drawn the last step.
+static tCntSem renderFinished;
 
 /*************/
 /* Functions */
@@ -72,11 +151,14 @@ tU8 currentScore;
 /*****************************************************************************
  *
  * Description:
- *    Adjusts the game speed to current temperature.
+ *    Adjusts the game speed to current temperature and shows it
+ *    on the RGB LED.
  *
  ****************************************************************************/
 void changeGameSpeed() {
     tU16 temperature = getTemperature();
+    tU8 speed;
+
     timeStep = 6 * (31 - temperature);
     if (timeStep <= 0) {
         timeStep = 6;
@@ -84,18 +166,24 @@ void changeGameSpeed() {
 
     switch (timeStep) {
         case 6:
-            setRGBLedColor(255, 0, 0);
+            speed = 0;
             break;
         case 12:
-            setRGBLedColor(255, 255, 0);
+            speed = 1;
             break;
         case 18:
-            setRGBLedColor(0, 255, 0);
+            speed = 2;
             break;
         default:
-            setRGBLedColor(0, 0, 255);
+            speed = 3;
             break;
     }
+
+    if (isRGBLedRedOnly()) {
+        setRGBLedColor(speedRedLevels[speed], 0, 0);
+    } else {
+        setRGBLedColor(speedColours[speed][0], speedColours[speed][1], speedColours[speed][2]);
+    }
 }
 
 /*****************************************************************************
@@ -107,12 +195,17 @@ void changeGameSpeed() {
  *    [in] c - a moving character
  *
  * Returns:
- *    Direction - direction from the joystick
+ *    Direction - direction from the joystick or from a remote command
  *
  ****************************************************************************/
 Direction changeDirection(struct character *c) {
-    if (KEY_NOTHING != pressedKey) {
-        switch (pressedKey) {
+    KeyEvent event;
+    tU32 timestamp;
+
+    // takes at most one buffered turn per move, so quick sequences of turns
+    // are applied in order instead of overwriting each other
+    while (pollKeyEvents(&event, 1)) {
+        switch (event.key) {
             case KEY_UP:
                 direction = UP;
                 break;
@@ -125,7 +218,20 @@ Direction changeDirection(struct character *c) {
             case KEY_LEFT:
                 direction = LEFT;
                 break;
+            default:
+                continue;
         }
+#if PROFILING
+        profRecord(PROF_INPUT_LATENCY, CLOCK_SINCE(event.timestamp));
+#endif
+        return direction;
+    }
+
+    // commands received over Bluetooth are the alternative source
+    if (pollRemoteDirection(&direction, &timestamp)) {
+#if PROFILING
+        profRecord(PROF_REMOTE_LATENCY, CLOCK_SINCE(timestamp));
+#endif
     }
     return direction;
 }
@@ -140,6 +246,7 @@ Direction changeDirection(struct character *c) {
  *
  ****************************************************************************/
 void lifeLostEventHandler(tU8 lives) {
+    currentLives = lives;
     if (lives < 3) {
         lifeLost = 1;
     }
@@ -162,7 +269,7 @@ void lifeLostEventHandler(tU8 lives) {
  *    [in] score - final score
  *
  ****************************************************************************/
-void gameLostEventHandler(tU8 level, tU8 score) {
+void gameLostEventHandler(tU8 level, tU32 score) {
     gameEnded = GAME_LOST;
 }
 
@@ -176,102 +283,61 @@ void gameLostEventHandler(tU8 level, tU8 score) {
  *    [in] score - player's score after level completion
  *
  ****************************************************************************/
-void levelCompletedEventHandler(tU8 level, tU8 score) {
+void levelCompletedEventHandler(tU8 level, tU32 score) {
     gameEnded = GAME_WON;
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Gets x coordinate of the first pixel in given column.
+ *    Converts the score to the displayed digits.
+ *    Scores with more than SCORE_DIGITS digits are shown as all nines.
  *
  * Params:
- *    [in] column - column number (columns' numbers start from 0)
- *
- * Returns:
- *    tU8 - x coordinate of the left side of the column
+ *    [in] score - player's score
  *
  ****************************************************************************/
-tU8 getX(tU8 column) {
-    return TOP_LEFT_X + column * FIELD_SIZE;
-}
+static void setScoreDigits(tU32 score) {
+    int i = SCORE_DIGITS - 1;
 
-/*****************************************************************************
- *
- * Description:
- *    Gets y coordinate of the first pixel in given row.
- *
- * Params:
- *    [in] row - row number (rows' numbers start from 0)
- *
- * Returns:
- *    tU8 - y coordinate of the top side of the row
- *
- ****************************************************************************/
-tU8 getY(tU8 row) {
-    return TOP_LEFT_Y + row * FIELD_SIZE;
-}
+    displayedScore = score;
+    do {
+        scoreDigits[i--] = '0' + (score % 10);
+        score /= 10;
+    } while (score > 0 && i >= 0);
 
-/*****************************************************************************
- *
- * Description:
- *    Displays whole board on the screen.
- *
- ****************************************************************************/
-void displayBoard(void) {
-    int row, column;
-    tU8 x, y;
-    for (row = 0; row < BOARD_WIDTH; ++row) {
-        for (column = 0; column < BOARD_HEIGHT; ++column) {
-            x = getX(column);
-            y = getY(row);
-            switch (board[row][column]) {
-                case EMPTY:
-                    displayEmptyField(x, y);
-                    break;
-                case WALL:
-                    displayWall(x, y);
-                    break;
-                case POINT:
-                    displayPoint(x, y);
-                    break;
-                case BONUS:
-                    displayBonus(x, y);
-                    break;
-                case DOORS:
-                    displayDoors(x, y);
-                    break;
-            }
+    if (score > 0) {
+        for (i = 0; i < SCORE_DIGITS; ++i) {
+            scoreDigits[i] = '9';
         }
+        return;
+    }
+    while (i >= 0) {
+        scoreDigits[i--] = ' ';
     }
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Displays a character in given step of movement.
- *
- * Params:
- *    [in] move - a structure representing the moving character and its direction
- *    [in] animationStep - the step of animation (from 0 to FIELD_SIZE - 1)
+ *    Adds one to the displayed digits, saturating at all nines.
  *
  ****************************************************************************/
-void displayCharacter(Move move, tU8 animationStep) {
-    tU8 x = getX(move.from.x) + animationStep * (move.to.x - move.from.x);
-    tU8 y = getY(move.from.y) + animationStep * (move.to.y - move.from.y);
-    switch (move.type) {
-        case GHOST:
-            displayGhost(x, y);
-            break;
-        case PACMAN:
-            displayPacman(x, y);
-            break;
-        case EATABLE_GHOST:
-            displayEatableGhost(x, y);
-            break;
-        case EYES:
-            displayEyes(x, y);
-            break;
+static void incrementScoreDigits(void) {
+    int i;
+
+    ++displayedScore;
+    for (i = SCORE_DIGITS - 1; i >= 0; --i) {
+        if ('9' != scoreDigits[i]) {
+            scoreDigits[i] = (' ' == scoreDigits[i]) ? '1' : scoreDigits[i] + 1;
+            return;
+        }
+        scoreDigits[i] = '0';
+    }
+
+    // carry out of the highest digit
+    for (i = 0; i < SCORE_DIGITS; ++i) {
+        scoreDigits[i] = '9';
     }
 }
 
@@ -282,34 +348,37 @@ void displayCharacter(Move move, tU8 animationStep) {
  *
  ****************************************************************************/
 void initAlpha() {
-    char message[] = "Current score:  \n              0";
+    char message[] = "Current score:  \n                ";
     messageOnAlpha(message, TRUE);
+
+    currentScore = INIT_SCORE;
+    setScoreDigits(currentScore);
+    writeAlpha(1, ALPHA_COLUMNS - SCORE_DIGITS, scoreDigits);
 }
 
 /*****************************************************************************
  *
  * Description:
  *    Displays current score on the alphanumeric LCD.
+ *    Small increases are counted on the digits, so only the changed digits
+ *    are touched and sent to the display.
  *
  * Params:
  *    [in] score - player's score
  *
  ****************************************************************************/
-void displayScoreOnAlpha(tU8 score) {
+void displayScoreOnAlpha(tU32 score) {
     currentScore = score;
 
-    char message[] = "\n               ";
-    int i = 16;
-
-    while (score > 0) {
-        message[i--] = '0' + (score % 10);
-        score /= 10;
-    }
-    while (i > 0) {
-        message[i--] = ' ';
+    if (score < displayedScore || score - displayedScore > SCORE_MAX_STEP) {
+        setScoreDigits(score);
+    } else {
+        while (displayedScore < score) {
+            incrementScoreDigits();
+        }
     }
 
-    messageOnAlpha(message, TRUE);
+    writeAlpha(1, ALPHA_COLUMNS - SCORE_DIGITS, scoreDigits);
 }
 
 /*****************************************************************************
@@ -344,9 +413,219 @@ void displayTimeToEatOnI2C(tU8 remainingTime) {
  *
  ****************************************************************************/
 void displayTimeToEat(tU8 remainingTime) {
+    currentTimeToEat = remainingTime;
     displayTimeToEatOnI2C(remainingTime);
 }
 
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets a snapshot for the next step and records the board the step
+ *    starts from. A snapshot the render process has not taken yet is
+ *    reused, so its frame is dropped but the fields it changed and its
+ *    lost life or end of the game are kept.
+ *
+ * Returns:
+ *    Snapshot* - snapshot owned by the logic until postSnapshot()
+ *
+ ****************************************************************************/
+static Snapshot *takeSnapshot(void) {
+    // only the bytes of the fields of the current board
+    int bitmapSize = (boardWidth * boardHeight + 7) / 8;
+    Snapshot *snapshot;
+    tU8 error;
+    int i;
+
+    snapshot = (Snapshot *) osAcceptQueue(&readySnapshots, &error);
+    if (NULL != snapshot) {
+        ++droppedSnapshots;
+    } else {
+        // one of the two snapshots is always free or being returned
+        snapshot = (Snapshot *) osPendQueue(&freeSnapshots, 0, &error);
+        for (i = 0; i < bitmapSize; ++i) {
+            snapshot->changedFields[i] = 0;
+        }
+        snapshot->lifeLost = 0;
+        snapshot->gameEnded = 0;
+    }
+
+    for (i = 0; i < bitmapSize; ++i) {
+        snapshot->eatenFields[i] = eatenFields[i];
+        snapshot->changedFields[i] |= eatenFields[i] ^ postedFields[i];
+        postedFields[i] = eatenFields[i];
+    }
+    return snapshot;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Completes the snapshot with the moves of the step and passes it
+ *    to the render process.
+ *
+ * Params:
+ *    [in] snapshot - snapshot from takeSnapshot()
+ *    [in] moves - moves of the characters in the step
+ *
+ ****************************************************************************/
+static void postSnapshot(Snapshot *snapshot, Move *moves) {
+    tU8 character, error;
+
+    for (character = 0; character < CHARACTERS; ++character) {
+        snapshot->moves[character] = moves[character];
+    }
+    snapshot->timeStep = timeStep;
+    snapshot->timeToEat = currentTimeToEat;
+    // accumulated like the changed fields, a dropped frame keeps them
+    snapshot->lifeLost |= lifeLost;
+    snapshot->gameEnded |= gameEnded;
+
+    ++postedSnapshots;
+    osPostQueue(&readySnapshots, snapshot, &error);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Process drawing the game on the LCD. Moves the camera after Pacman,
+ *    redraws the fields that changed or were covered by the characters
+ *    and animates the moves of the newest snapshot. A snapshot posted
+ *    meanwhile cuts the animation short, so a long frame does not delay
+ *    the following ones.
+ *
+ * Params:
+ *    [in] arg - parameters passed to the function (not used)
+ *
+ ****************************************************************************/
+static void renderProcess(void *arg) {
+    Move moves[CHARACTERS];
+    tU8 redrawBoard = TRUE;
+    tU8 stepTicks, stepLifeLost, stepGameEnded;
+    tU8 animationStep, character, error;
+    Snapshot *snapshot;
+
+    snapshot = (Snapshot *) osPendQueue(&readySnapshots, 0, &error);
+    // before the first step the characters stand where they start from
+    for (character = 0; character < CHARACTERS; ++character) {
+        moves[character] = snapshot->moves[character];
+    }
+    while (1) {
+        PROF_BEGIN(PROF_DISPLAY_BOARD);
+        if (viewFollow(snapshot->eatenFields, snapshot->moves[PACMAN].from)) {
+            // the camera has just drawn the whole board, it is not scrolled
+            redrawBoard = FALSE;
+        } else {
+            // texts are written on the lines of the screen, not of a scrolled board
+            if ((snapshot->lifeLost || snapshot->gameEnded) && viewScrolled()) {
+                redrawBoard = TRUE;
+            }
+            if (redrawBoard) {
+                viewDisplayBoard(snapshot->eatenFields);
+                redrawBoard = FALSE;
+            } else {
+                viewDisplayChangedFields(snapshot->eatenFields, snapshot->changedFields);
+                // clears the fields the characters moved between
+                for (character = 0; character < CHARACTERS; ++character) {
+                    viewDisplayField(snapshot->eatenFields, moves[character].from.y, moves[character].from.x);
+                    viewDisplayField(snapshot->eatenFields, moves[character].to.y, moves[character].to.x);
+                }
+            }
+        }
+        PROF_END(PROF_DISPLAY_BOARD);
+
+        for (character = 0; character < CHARACTERS; ++character) {
+            moves[character] = snapshot->moves[character];
+        }
+        stepTicks = snapshot->timeStep / FIELD_SIZE;
+        stepLifeLost = snapshot->lifeLost;
+        stepGameEnded = snapshot->gameEnded;
+
+        // eatable ghosts flash before they turn back
+        if (0 < snapshot->timeToEat && snapshot->timeToEat <= FRIGHTENED_FLASH_TIME) {
+            if (!paletteRunning(PALETTE_FRIGHTENED_END)) {
+                paletteStart(PALETTE_FRIGHTENED_END);
+            }
+        } else {
+            paletteStop(PALETTE_FRIGHTENED_END);
+        }
+
+        osPostQueue(&freeSnapshots, snapshot, &error);
+        snapshot = NULL;
+
+        // Display characters in movement.
+        // Each move is split into steps to make it smoother.
+        for (animationStep = 0; animationStep < FIELD_SIZE && NULL == snapshot; ++animationStep) {
+            PROF_BEGIN(PROF_ANIMATION);
+            for (character = 0; character < CHARACTERS; ++character) {
+                viewDisplayCharacter(moves[character], animationStep);
+            }
+            PROF_END(PROF_ANIMATION);
+
+            paletteUpdate();
+
+            if (animationStep < FIELD_SIZE - 1) {
+                snapshot = (Snapshot *) osPendQueue(&readySnapshots, stepTicks, &error);
+            }
+        }
+
+        // the logic waits while the message is shown
+        if (1 == stepLifeLost) {
+            displayText("You died");
+            redrawBoard = TRUE;
+        }
+
+        if (stepGameEnded) {
+            break;
+        }
+        if (NULL == snapshot) {
+            snapshot = (Snapshot *) osPendQueue(&readySnapshots, 0, &error);
+        }
+    }
+
+    viewEnd();
+
+    // the maze flashes after a completed level
+    paletteStop(PALETTE_FRIGHTENED_END);
+    if (GAME_WON == stepGameEnded) {
+        paletteStart(PALETTE_MAZE_FLASH);
+    }
+    do {
+        paletteUpdate();
+        osSleep(2);
+    } while (paletteRunning(PALETTE_MAZE_FLASH));
+
+    osSemGive(&renderFinished, &error);
+    osDeleteProcess();
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Creates the snapshot queues and starts the render process.
+ *
+ ****************************************************************************/
+static void startRenderProcess(void) {
+    tU8 renderProcPid, error;
+    int i;
+
+    osCreateQueue(&readySnapshots, readyArea, SNAPSHOTS);
+    osCreateQueue(&freeSnapshots, freeArea, SNAPSHOTS);
+    for (i = 0; i < SNAPSHOTS; ++i) {
+        osPostQueue(&freeSnapshots, &snapshots[i], &error);
+    }
+    // only the bytes of the fields of the current board, as in takeSnapshot()
+    for (i = 0; i < (boardWidth * boardHeight + 7) / 8; ++i) {
+        postedFields[i] = eatenFields[i];
+    }
+    postedSnapshots = 0;
+    droppedSnapshots = 0;
+    osSemInit(&renderFinished, 0);
+
+    osCreateProcess(renderProcess, renderStack, RENDER_STACK_SIZE, &renderProcPid,
+                    RENDER_PRIORITY, NULL, &error);
+    osStartProcess(renderProcPid, &error);
+}
+
 /*****************************************************************************
  *
  * Description:
@@ -382,11 +661,12 @@ void startGame(void) {
 	displayText("Reading board");
 	
     // initializes the game
-	tU8 boardRead = readBoard(&(board[0][0]), BOARD_HEIGHT, BOARD_WIDTH);
+	tU8 boardRead = readBoard(sdBoard, BOARD_MAX_HEIGHT, BOARD_MAX_WIDTH,
+	                          &sdBoardHeight, &sdBoardWidth);
 	if (TRUE == boardRead) {
-		initPacman(FALSE);
+		initPacman(sdBoard, sdBoardWidth, sdBoardHeight);
 	} else {
-		initPacman(TRUE);
+		initPacman(NULL, 0, 0);
 	}
 
     initAlpha();
@@ -397,57 +677,101 @@ void startGame(void) {
     initDAC();
 	playBeginningSound();
 
-    // displays the initial board state
-    displayBoard();
-
     // get the initial positions of characters
     Move *moves = makeMove();
 
+    // displays the initial board state around Pacman
+    viewInit(moves[PACMAN].from);
+    viewDisplayBoard(eatenFields);
+
     // display characters on their initial positions
     tU8 character;
     for (character = 0; character < CHARACTERS; ++character) {
-        displayCharacter(moves[character], 0);
+        viewDisplayCharacter(moves[character], 0);
     }
 
+    // configures Bluetooth in the background, see btPoll()
+    // and accepts remote direction commands
+    initBluetooth();
+    onBluetoothData(remoteReceive);
+
+    profReset();
+
+    // from now on only the render process draws on the LCD
+    startRenderProcess();
+
     do {
+        PROF_BEGIN(PROF_FRAME);
         lifeLost = 0;
 
-        // Display the most recent state of the board.
-        displayBoard();
+        // Snapshot the most recent state of the board.
+        Snapshot *snapshot = takeSnapshot();
 
         // Let all characters make a move.
+        PROF_BEGIN(PROF_MAKE_MOVE);
         moves = makeMove();
+        PROF_END(PROF_MAKE_MOVE);
+
+        // Stream the step to the connected Bluetooth device.
+        if (BT_CONNECTED == getBluetoothState()) {
+            sendTelemetry(moves, currentScore, currentLives, currentTimeToEat);
+        } else {
+            resetTelemetry();
+        }
 
         // Adjusts game's speed to the temperature.
+        PROF_BEGIN(PROF_GAME_SPEED);
         changeGameSpeed();
+        PROF_END(PROF_GAME_SPEED);
 
-        // Display characters in movement.
-        // Each move is split into steps to make it smoother.
+        // Let the render process draw the step.
+        postSnapshot(snapshot, moves);
+
+        // Wait for the next step, polling Bluetooth at the pace
+        // of the animation.
         int animationStep;
         for (animationStep = 0; animationStep < FIELD_SIZE; ++animationStep) {
-            int character;
-            for (character = 0; character < CHARACTERS; ++character) {
-                displayCharacter(moves[character], animationStep);
-            }
-
-            tU8 keyBuffer = checkKey();
-            if (keyBuffer != KEY_NOTHING) {
-                pressedKey = keyBuffer;
-            }
+            btPoll();
 
+            PROF_BEGIN(PROF_SLEEP);
             osSleep(timeStep / FIELD_SIZE);
+            PROF_END(PROF_SLEEP);
         }
 
+        // the render process shows "You died" meanwhile
         if (1 == lifeLost) {
-            displayText("You died");
             osSleep(150);
         }
 
+#if PROFILING
+        // statistics can be requested by sending 'p' to the consol
+        profPoll();
+#endif
+        PROF_END(PROF_FRAME);
     } while (!gameEnded);
 
+    tU8 error;
+    osSemTake(&renderFinished, 0, &error);
+    LOG_INFO(LOG_RENDER_DROPPED, droppedSnapshots, postedSnapshots);
+
+#if PROFILING
+    profDump();
+#endif
+
+    // statistics of the remote players steering ghosts
+    for (character = 0; character < NUMBER_OF_GHOSTS; ++character) {
+        const RemotePlayer *player = getRemotePlayer(character);
+        if (player->accepted) {
+            LOG_INFO(LOG_REMOTE_PLAYER, character,
+                     player->accepted, player->dropped, player->predicted);
+        }
+    }
+
+
+    tU8 rank = addHighScore(currentScore);
 
-    char message[] = "SCORE:    ";
-    int i = 9;
+    char message[] = "SCORE:          ";
+    int i = 15;
     while (currentScore > 0) {
         message[i] = '0' + (currentScore % 10);
         --i;
@@ -459,9 +783,14 @@ void startGame(void) {
     } else {
         displayText("You won");
     }
+    if (1 == rank) {
+        displayText("New high score");
+    }
 
-    displayText("Init Bluetooth");
-    initBluetooth();
     displayText("Send \"result\"");
     sendDataThroughBluetooth((unsigned char*) message);
+    while (!isBluetoothDataSent()) {
+        btPoll();
+        osSleep(1);
+    }
 }
@@ -11,12 +11,16 @@
 #ifndef _GAME_H_
 #define _GAME_H_
 
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
 /*************/
 /* Functions */
 /*************/
 
-void displayBoard(void);
-
 void startGame(void);
 
 #endif
@@ -0,0 +1,200 @@
+/******************************************************************************
+ *
+ * File:
+ *    highscore.c
+ *
+ * Description:
+ *    Table of the best scores kept in the eeprom as a log-structured ring
+ *    of records.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "highscore.h"
+#include "eeprom.h"
+#include "log.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// the ring takes the upper half of the eeprom
+#define HIGHSCORE_BASE      (EEPROM_SIZE / 2)
+#define HIGHSCORE_SLOTS     ((EEPROM_SIZE - HIGHSCORE_BASE) / EEPROM_PAGE_SIZE)
+
+// bytes covered by the crc
+#define RECORD_DATA_SIZE    (sizeof(tU32) * (1 + HIGHSCORE_ENTRIES))
+
+/*********/
+/* Types */
+/*********/
+
+// one record fills exactly one eeprom page
+typedef struct {
+    tU32 sequence;
+    tU32 scores[HIGHSCORE_ENTRIES];
+    tU16 crc;
+    tU16 reserved;
+} HighScoreRecord;
+
+/*************/
+/* Variables */
+/*************/
+
+static HighScoreRecord table;
+
+// slot of the newest record, HIGHSCORE_SLOTS - 1 if there is none yet
+static tU16 newestSlot = HIGHSCORE_SLOTS - 1;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Calculates the CRC-16-CCITT of a block.
+ *
+ ****************************************************************************/
+static tU16 crc16(const tU8 *data, tU16 length) {
+    tU16 crc = 0xffff;
+    tU8 bit;
+
+    while (length--) {
+        crc ^= (tU16) *data++ << 8;
+        for (bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Reads the record from given slot.
+ *
+ * Returns:
+ *    tU8 - TRUE if the record was read and its crc is correct
+ *
+ ****************************************************************************/
+static tU8 readRecord(tU16 slot, HighScoreRecord *record) {
+    if (I2C_CODE_OK != eepromRead(HIGHSCORE_BASE + slot * EEPROM_PAGE_SIZE,
+                                  (tU8 *) record, sizeof(HighScoreRecord))) {
+        return FALSE;
+    }
+    return record->crc == crc16((tU8 *) record, RECORD_DATA_SIZE);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Reads the newest table from the eeprom. The records following
+ *    the one in slot 0 have consecutive sequence numbers up to the newest
+ *    record, so it is the last slot passing this test.
+ *    A write interrupted at slot 0 leaves the newest record in the last slot.
+ *    Should be called once, after i2cInit().
+ *
+ ****************************************************************************/
+void loadHighScores(void) {
+    HighScoreRecord record;
+    tU32 firstSequence;
+    tU16 low, high, middle;
+    tU8 i;
+
+    if (readRecord(0, &record)) {
+        firstSequence = record.sequence;
+        table = record;
+        newestSlot = 0;
+
+        // the newest slot is in [low, high]
+        low = 0;
+        high = HIGHSCORE_SLOTS - 1;
+        while (low < high) {
+            middle = (low + high + 1) / 2;
+            if (readRecord(middle, &record) && record.sequence == firstSequence + middle) {
+                low = middle;
+                table = record;
+                newestSlot = middle;
+            } else {
+                high = middle - 1;
+            }
+        }
+    } else if (readRecord(HIGHSCORE_SLOTS - 1, &record)) {
+        table = record;
+        newestSlot = HIGHSCORE_SLOTS - 1;
+    } else {
+        // nothing stored yet
+        table.sequence = 0;
+        for (i = 0; i < HIGHSCORE_ENTRIES; ++i) {
+            table.scores[i] = 0;
+        }
+        newestSlot = HIGHSCORE_SLOTS - 1;
+    }
+
+    LOG_INFO(LOG_HIGHSCORE_LOADED, table.sequence, newestSlot);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Puts the score into the table and stores the table in the next slot
+ *    of the ring with a single page write. The table is changed only when
+ *    the write succeeds, so the sequence numbers of the ring stay
+ *    consecutive.
+ *
+ * Params:
+ *    [in] score - final score of a game
+ *
+ * Returns:
+ *    tU8 - place of the score in the table (starting from 1),
+ *          0 if the score is too low or the table could not be written
+ *
+ ****************************************************************************/
+tU8 addHighScore(tU32 score) {
+    HighScoreRecord record = table;
+    tU8 rank = HIGHSCORE_ENTRIES;
+    tU16 slot;
+
+    while (rank > 0 && record.scores[rank - 1] < score) {
+        if (rank < HIGHSCORE_ENTRIES) {
+            record.scores[rank] = record.scores[rank - 1];
+        }
+        --rank;
+    }
+    if (HIGHSCORE_ENTRIES == rank) {
+        return 0;
+    }
+    record.scores[rank] = score;
+
+    slot = (newestSlot + 1) % HIGHSCORE_SLOTS;
+    record.sequence++;
+    record.crc = crc16((tU8 *) &record, RECORD_DATA_SIZE);
+    record.reserved = 0xffff;
+
+    if (I2C_CODE_OK == eepromPageWrite(HIGHSCORE_BASE + slot * EEPROM_PAGE_SIZE,
+                                       (tU8 *) &record, sizeof(HighScoreRecord))) {
+        table = record;
+        newestSlot = slot;
+        return rank + 1;
+    }
+
+    LOG_ERROR(LOG_HIGHSCORE_WRITE_ERROR, slot);
+    return 0;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets a score from the table.
+ *
+ * Params:
+ *    [in] rank - place in the table, starting from 1
+ *
+ ****************************************************************************/
+tU32 getHighScore(tU8 rank) {
+    return table.scores[rank - 1];
+}
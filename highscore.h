@@ -0,0 +1,40 @@
+/******************************************************************************
+ *
+ * File:
+ *    highscore.h
+ *
+ * Description:
+ *    Table of the best scores kept in the eeprom.
+ *
+ *    Every change writes the whole table as a new one page record to
+ *    the next slot of a ring, so the writes are spread over all slots.
+ *    Record: sequence number, scores (best first), crc16 of the preceding
+ *    bytes. The slot after the newest record holds the oldest one, so the
+ *    newest valid record is found with a binary search over the ring.
+ *
+ *****************************************************************************/
+
+#ifndef _HIGHSCORE_H_
+#define _HIGHSCORE_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define HIGHSCORE_ENTRIES   6
+
+/*************/
+/* Functions */
+/*************/
+
+void loadHighScores(void);
+tU8 addHighScore(tU32 score);
+tU32 getHighScore(tU8 rank);
+
+#endif
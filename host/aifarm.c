@@ -0,0 +1,462 @@
+/******************************************************************************
+ *
+ * File:
+ *    aifarm.c
+ *
+ * Description:
+ *    Host tool evaluating Pacman and ghost policies over large batches of
+ *    seeded games. Games are played by the unmodified game logic on a
+ *    work-stealing thread pool, every thread keeping its own game state.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "pacman.h"
+#include "workpool.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define DEFAULT_GAMES      10000
+#define DEFAULT_MAX_STEPS  5000
+#define Z_95               1.96
+
+/*********/
+/* Types */
+/*********/
+
+typedef Direction (*Policy)(struct character *c);
+
+typedef struct {
+    const char *name;
+    Policy policy;
+} NamedPolicy;
+
+typedef struct {
+    tU32 games;
+    tU32 threads;
+    tU32 seed;
+    tU32 maxSteps;
+    Policy pacmanPolicy;
+    Policy ghostPolicy;
+} FarmConfig;
+
+typedef struct {
+    tU8 won;
+    tU8 timedOut;
+    tU32 score;
+    tU32 steps;
+    tU32 trace;     // hash of all the moves of the game
+} GameResult;
+
+typedef struct {
+    const FarmConfig *config;
+    GameResult *results;
+} FarmJob;
+
+/*************/
+/* Variables */
+/*************/
+
+// state of the game played by the current thread
+static __thread tU8 gameOver;
+static __thread tU8 gameWon;
+static __thread tU32 totalScore;
+static __thread tU32 policySeed;
+static __thread Move *lastMoves;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Pseudo random generator of the policies, independent of the game one
+ *
+ ****************************************************************************/
+static tU32 policyRandom(void) {
+    policySeed = policySeed * 1103515245 + 12345;
+    return policySeed >> 16;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Game handlers registered for every game played by the farm
+ *
+ ****************************************************************************/
+static void farmGameLost(tU8 level, tU32 score) {
+    gameOver = TRUE;
+}
+
+static void farmLevelCompleted(tU8 level, tU32 score) {
+    gameOver = TRUE;
+    gameWon = TRUE;
+}
+
+static void farmScoreChanged(tU32 score) {
+    totalScore = score;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Helpers shared by the policies
+ *
+ ****************************************************************************/
+static Coordinates step(Coordinates coords, Direction dir) {
+    switch (dir) {
+        case LEFT: coords.x--; break;
+        case RIGHT: coords.x++; break;
+        case UP: coords.y--; break;
+        case DOWN: coords.y++; break;
+    }
+    return coords;
+}
+
+static tU8 isPassable(Coordinates coords) {
+    Field field = getLayoutField(coords.y, coords.x);
+    return WALL != field && DOORS != field;
+}
+
+static Direction opposite(Direction dir) {
+    switch (dir) {
+        case LEFT: return RIGHT;
+        case RIGHT: return LEFT;
+        case UP: return DOWN;
+        default: return UP;
+    }
+}
+
+static tU8 isDangerous(Coordinates coords) {
+    tU8 i;
+
+    if (!lastMoves) {
+        return FALSE;
+    }
+    for (i = 1; i <= NUMBER_OF_GHOSTS; ++i) {
+        if (GHOST == lastMoves[i].type
+                && abs(lastMoves[i].to.x - coords.x) + abs(lastMoves[i].to.y - coords.y) <= 1) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Picks a random direction, turning back only in dead ends
+ *
+ ****************************************************************************/
+static Direction randomPolicy(Character *c) {
+    Direction options[4];
+    tU8 count = 0;
+    Direction dir;
+
+    for (dir = LEFT; dir <= DOWN; ++dir) {
+        if (dir != opposite(c->currentDirection) && isPassable(step(c->position, dir))) {
+            options[count++] = dir;
+        }
+    }
+    if (0 == count) {
+        return opposite(c->currentDirection);
+    }
+    return options[policyRandom() % count];
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Pacman policy going along the shortest path to the nearest point,
+ *    avoiding fields next to the dangerous ghosts
+ *
+ ****************************************************************************/
+static Direction greedyPolicy(Character *c) {
+    static __thread tU8 visited[BOARD_MAX_HEIGHT][BOARD_MAX_WIDTH];
+    static __thread Direction firstStep[BOARD_MAX_HEIGHT][BOARD_MAX_WIDTH];
+    Coordinates queue[BOARD_MAX_HEIGHT * BOARD_MAX_WIDTH];
+    tU32 head = 0, tail = 0;
+    Direction dir;
+
+    memset(visited, 0, sizeof (visited));
+    visited[c->position.y][c->position.x] = TRUE;
+    queue[tail++] = c->position;
+
+    while (head < tail) {
+        Coordinates current = queue[head++];
+        Field field = getField(current.y, current.x);
+
+        if (head > 1 && (POINT == field || BONUS == field)) {
+            return firstStep[current.y][current.x];
+        }
+        for (dir = LEFT; dir <= DOWN; ++dir) {
+            Coordinates next = step(current, dir);
+            if (visited[next.y][next.x] || !isPassable(next) || isDangerous(next)) {
+                continue;
+            }
+            visited[next.y][next.x] = TRUE;
+            firstStep[next.y][next.x] = (head > 1) ? firstStep[current.y][current.x] : dir;
+            queue[tail++] = next;
+        }
+    }
+
+    return randomPolicy(c);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Ghost policy moving towards the Pacman, or away from him when
+ *    the ghost is eatable
+ *
+ ****************************************************************************/
+static Direction chasePolicy(Character *c) {
+    Coordinates target;
+    Direction dir, best = opposite(c->currentDirection);
+    int bestScore = 0;
+    tU8 found = FALSE;
+
+    if (!lastMoves) {
+        return randomPolicy(c);
+    }
+    target = lastMoves[0].to;
+
+    for (dir = LEFT; dir <= DOWN; ++dir) {
+        Coordinates next = step(c->position, dir);
+        int distance;
+
+        if (dir == opposite(c->currentDirection) || !isPassable(next)) {
+            continue;
+        }
+        distance = abs(next.x - target.x) + abs(next.y - target.y);
+        if (EATABLE_GHOST == c->type) {
+            distance = -distance;
+        }
+        // random tie breaking keeps the ghosts from following each other
+        distance = distance * 4 + (int) (policyRandom() % 4);
+        if (!found || distance < bestScore) {
+            bestScore = distance;
+            best = dir;
+            found = TRUE;
+        }
+    }
+
+    return best;
+}
+
+static const NamedPolicy pacmanPolicies[] = {
+    {"random", randomPolicy},
+    {"greedy", greedyPolicy},
+    {NULL, NULL}
+};
+
+static const NamedPolicy ghostPolicies[] = {
+    {"default", NULL},
+    {"random", randomPolicy},
+    {"chase", chasePolicy},
+    {NULL, NULL}
+};
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Plays one game on the calling thread
+ *
+ * Params:
+ *    [in] config - farm configuration
+ *    [in] index - index of the game, selects its seed
+ *
+ * Returns:
+ *    GameResult - outcome of the game
+ *
+ ****************************************************************************/
+static GameResult playGame(const FarmConfig *config, tU32 index) {
+    GameResult result;
+    tU8 i;
+
+    gameOver = FALSE;
+    gameWon = FALSE;
+    totalScore = 0;
+    lastMoves = NULL;
+    policySeed = config->seed + index * 2654435761u;
+
+    setRandomSeed((int) ((config->seed + index) & 0x7fffffff));
+    onGameLost(farmGameLost);
+    onLevelCompleted(farmLevelCompleted);
+    onScoreChanged(farmScoreChanged);
+    setDirectionCallback(config->pacmanPolicy);
+    for (i = 0; i < NUMBER_OF_GHOSTS; ++i) {
+        setGhostDirectionCallback(i, config->ghostPolicy);
+    }
+    initPacman(NULL, 0, 0);
+
+    result.steps = 0;
+    result.trace = 2166136261u;
+    while (!gameOver && result.steps < config->maxSteps) {
+        lastMoves = makeMove();
+        result.steps++;
+        for (i = 0; i <= NUMBER_OF_GHOSTS; ++i) {
+            result.trace = (result.trace ^ lastMoves[i].to.x) * 16777619u;
+            result.trace = (result.trace ^ lastMoves[i].to.y) * 16777619u;
+        }
+    }
+
+    result.won = gameWon;
+    result.timedOut = !gameOver;
+    result.score = totalScore;
+    return result;
+}
+
+static void farmJob(tU32 worker, tU32 index, void *arg) {
+    FarmJob *job = arg;
+    job->results[index] = playGame(job->config, index);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks that the seed of the game logic changes the games of the default
+ *    ghosts, which depend on nothing else
+ *
+ * Returns:
+ *    tU8 - TRUE if two seeds give different games
+ *
+ ****************************************************************************/
+static tU8 checkSeeds(const FarmConfig *config) {
+    GameResult first = playGame(config, 0);
+    GameResult second = playGame(config, 1);
+
+    return first.trace != second.trace;
+}
+
+static Policy findPolicy(const NamedPolicy *policies, const char *name, tU8 *found) {
+    for (; policies->name; ++policies) {
+        if (0 == strcmp(policies->name, name)) {
+            *found = TRUE;
+            return policies->policy;
+        }
+    }
+    *found = FALSE;
+    return NULL;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [-n games] [-j threads] [-s seed] [-m max-steps]\n"
+            "          [-p random|greedy] [-g default|random|chase]\n",
+            program);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Prints the statistics of the batch
+ *
+ ****************************************************************************/
+static void report(const FarmConfig *config, const GameResult *results, double seconds) {
+    double n = config->games;
+    double wins = 0, timeouts = 0, scoreSum = 0, scoreSq = 0, stepsSum = 0, stepsSq = 0;
+    double winRate, center, half, z2 = Z_95 * Z_95;
+    double scoreMean, scoreDev, stepsMean, stepsDev;
+    tU32 i;
+
+    for (i = 0; i < config->games; ++i) {
+        wins += results[i].won;
+        timeouts += results[i].timedOut;
+        scoreSum += results[i].score;
+        scoreSq += (double) results[i].score * results[i].score;
+        stepsSum += results[i].steps;
+        stepsSq += (double) results[i].steps * results[i].steps;
+    }
+
+    // Wilson score interval of the win rate
+    winRate = wins / n;
+    center = (winRate + z2 / (2 * n)) / (1 + z2 / n);
+    half = Z_95 * sqrt(winRate * (1 - winRate) / n + z2 / (4 * n * n)) / (1 + z2 / n);
+
+    scoreMean = scoreSum / n;
+    scoreDev = n > 1 ? sqrt((scoreSq - n * scoreMean * scoreMean) / (n - 1)) : 0;
+    stepsMean = stepsSum / n;
+    stepsDev = n > 1 ? sqrt((stepsSq - n * stepsMean * stepsMean) / (n - 1)) : 0;
+
+    printf("games:        %u (%u threads, seed %u)\n", config->games, config->threads, config->seed);
+    printf("win rate:     %.4f  95%% CI [%.4f, %.4f]\n", winRate, center - half, center + half);
+    printf("timeouts:     %.0f\n", timeouts);
+    printf("mean score:   %.2f +- %.2f\n", scoreMean, Z_95 * scoreDev / sqrt(n));
+    printf("mean steps:   %.1f +- %.1f\n", stepsMean, Z_95 * stepsDev / sqrt(n));
+    printf("throughput:   %.0f games/s (%.3f s)\n", n / seconds, seconds);
+}
+
+int main(int argc, char *argv[]) {
+    FarmConfig config;
+    FarmJob job;
+    struct timespec start, end;
+    const char *pacmanName = "greedy", *ghostName = "default";
+    tU8 found;
+    int option;
+
+    config.games = DEFAULT_GAMES;
+    config.threads = sysconf(_SC_NPROCESSORS_ONLN);
+    config.seed = INIT_SEED;
+    config.maxSteps = DEFAULT_MAX_STEPS;
+
+    while (-1 != (option = getopt(argc, argv, "n:j:s:m:p:g:h"))) {
+        switch (option) {
+            case 'n': config.games = strtoul(optarg, NULL, 0); break;
+            case 'j': config.threads = strtoul(optarg, NULL, 0); break;
+            case 's': config.seed = strtoul(optarg, NULL, 0); break;
+            case 'm': config.maxSteps = strtoul(optarg, NULL, 0); break;
+            case 'p': pacmanName = optarg; break;
+            case 'g': ghostName = optarg; break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+
+    config.pacmanPolicy = findPolicy(pacmanPolicies, pacmanName, &found);
+    if (!found) {
+        fprintf(stderr, "unknown pacman policy: %s\n", pacmanName);
+        return 1;
+    }
+    config.ghostPolicy = findPolicy(ghostPolicies, ghostName, &found);
+    if (!found) {
+        fprintf(stderr, "unknown ghost policy: %s\n", ghostName);
+        return 1;
+    }
+    if (0 == config.games || 0 == config.threads) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (NULL == config.ghostPolicy && !checkSeeds(&config)) {
+        fprintf(stderr, "seeds %u and %u give the same game\n", config.seed, config.seed + 1);
+        return 1;
+    }
+
+    job.config = &config;
+    job.results = calloc(config.games, sizeof (GameResult));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    runWorkPool(config.threads, config.games, farmJob, &job);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("pacman: %s, ghosts: %s\n", pacmanName, ghostName);
+    report(&config, job.results,
+           (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+
+    free(job.results);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#!/usr/bin/python
+
+import os
+import sys
+import struct as st
+import argparse as ap
+
+
+MAGIC = b'PACA'
+VERSION = 1
+ALIGN = 4
+
+HEADER = '<4sHH'
+ENTRY = '<BBHBBHII'
+
+SOUND = 1
+BOARD = 2
+SPRITES = 3
+
+
+def read_wave(path, options):
+    """Returns the samples of an uncompressed 8-bit mono wave file and its
+    sample rate, skipping all chunks other than 'data'."""
+    with open(path, 'rb') as wave:
+        chunk_id, _, form = st.unpack('<4sI4s', wave.read(12))
+        if chunk_id != b'RIFF' or form != b'WAVE':
+            raise ValueError('{} is not a wave file'.format(path))
+        rate = bits = channels = None
+        while True:
+            header = wave.read(8)
+            if len(header) < 8:
+                raise ValueError('{} has no data chunk'.format(path))
+            chunk_id, size = st.unpack('<4sI', header)
+            body = wave.read(size + (size & 1))[:size]
+            if chunk_id == b'fmt ':
+                audio_format, channels, rate, _, _, bits = \
+                    st.unpack('<HHIIHH', body[:16])
+                if audio_format != 1:
+                    raise ValueError('{} is compressed'.format(path))
+            elif chunk_id == b'data':
+                break
+    if bits != 8 or channels != 1:
+        raise ValueError('{} is not 8-bit mono'.format(path))
+    return body, dict(rate=rate)
+
+
+def read_board(path, options):
+    """Returns the fields of a board written as rows of digits,
+    the format of board.txt read from the SD card."""
+    with open(path) as board:
+        rows = [line.strip() for line in board if line.strip()]
+    width = len(rows[0])
+    if any(len(row) != width for row in rows):
+        raise ValueError('{} has rows of different length'.format(path))
+    return bytes(int(c) for row in rows for c in row), \
+        dict(width=width, height=len(rows))
+
+
+def read_ppm(path):
+    """Returns width, height and RGB bytes of a binary (P6) pixmap."""
+    with open(path, 'rb') as ppm:
+        data = ppm.read()
+    fields = []
+    i = 0
+    while len(fields) < 4:
+        while data[i:i + 1].isspace():
+            i += 1
+        if data[i:i + 1] == b'#':
+            i = data.index(b'\n', i)
+            continue
+        start = i
+        while not data[i:i + 1].isspace():
+            i += 1
+        fields.append(data[start:i])
+    if fields[0] != b'P6' or int(fields[3]) != 255:
+        raise ValueError('{} is not an 8-bit binary pixmap'.format(path))
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, data[i + 1:i + 1 + 3 * width * height]
+
+
+def read_sprites(path, options):
+    """Cuts a sprite sheet into frames of the given size ('8x8' option)
+    and converts the pixels to the RGB 3-3-2 colors of the LCD, so every
+    frame can be passed to lcdIcon() directly."""
+    frame_width, frame_height = (int(x) for x in options[0].split('x'))
+    width, height, rgb = read_ppm(path)
+    frames = bytearray()
+    for top in range(0, height - frame_height + 1, frame_height):
+        for left in range(0, width - frame_width + 1, frame_width):
+            for y in range(top, top + frame_height):
+                for x in range(left, left + frame_width):
+                    r, g, b = rgb[3 * (y * width + x):3 * (y * width + x) + 3]
+                    frames.append((r & 0xe0) | ((g & 0xe0) >> 3) | (b >> 6))
+    return bytes(frames), dict(width=frame_width, height=frame_height,
+                               frames=len(frames) // (frame_width * frame_height))
+
+
+READERS = {'sound': (SOUND, read_wave),
+           'board': (BOARD, read_board),
+           'sprites': (SPRITES, read_sprites)}
+
+
+def read_manifest(path):
+    """Yields (kind, name, file, options) of every manifest line,
+    the files are relative to the manifest."""
+    base = os.path.dirname(path)
+    with open(path) as manifest:
+        for number, line in enumerate(manifest, 1):
+            words = line.split('#')[0].split()
+            if not words:
+                continue
+            if len(words) < 3 or words[0] not in READERS:
+                raise ValueError('{}:{}: expected "kind name file [options]"'
+                                 .format(path, number))
+            yield words[0], words[1], os.path.join(base, words[2]), words[3:]
+
+
+def pad(data):
+    return data + bytes(-len(data) % ALIGN)
+
+
+def pack(assets):
+    """Builds the blob: header, table of contents, then the data of every
+    asset aligned to 4 bytes."""
+    offset = st.calcsize(HEADER) + st.calcsize(ENTRY) * len(assets)
+    toc = bytearray()
+    data = bytearray()
+    for kind, contents, info in assets:
+        toc += st.pack(ENTRY, kind, info.get('frames', 1), info.get('rate', 0),
+                       info.get('width', 0), info.get('height', 0), 0,
+                       offset + len(data), len(contents))
+        data += pad(contents)
+    return st.pack(HEADER, MAGIC, VERSION, len(assets)) + bytes(toc) + bytes(data)
+
+
+def write_ids(out, names, manifest):
+    guard = 'ASSET_IDS_H_'
+    print('/' + '*' * 78, file=out)
+    print(' *\n * File:\n *    {}\n *'.format(os.path.basename(out.name)), file=out)
+    print(' * Description:\n *    Ids of the assets packed from {}.'
+          .format(os.path.basename(manifest)), file=out)
+    print(' *    Generated with host/assetpack.py, do not edit.\n *', file=out)
+    print(' ' + '*' * 77 + '/\n', file=out)
+    print('#ifndef {0}\n#define {0}\n'.format(guard), file=out)
+    for i, name in enumerate(names):
+        print('#define ASSET_{:<24} {}'.format(name, i), file=out)
+    print('\n#define ASSET_COUNT {}\n\n#endif'.format(len(names)), file=out)
+
+
+def main():
+    parser = ap.ArgumentParser(
+        description='packs sounds, boards and sprite sheets into one '
+                    'indexed asset blob')
+    parser.add_argument('manifest', help='the list of assets, one per line: '
+                        'sound|board|sprites NAME FILE [WxH]')
+    parser.add_argument('-o', '--out', type=ap.FileType('wb'), required=True,
+                        help='place the blob into file')
+    parser.add_argument('-H', '--header', type=ap.FileType('w'),
+                        help='place the #defines of the asset ids into file')
+    args = parser.parse_args()
+
+    names = []
+    assets = []
+    for kind_name, name, path, options in read_manifest(args.manifest):
+        kind, reader = READERS[kind_name]
+        contents, info = reader(path, options)
+        names.append(name)
+        assets.append((kind, contents, info))
+
+    blob = pack(assets)
+    args.out.write(blob)
+    if args.header:
+        write_ids(args.header, names, args.manifest)
+
+    print('{} assets, {} bytes'.format(len(assets), len(blob)), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+/******************************************************************************
+ *
+ * File:
+ *    diskimage.c
+ *
+ * Description:
+ *    Implementation of diskio.h on a card image file for the host tools.
+ *
+ *    The SPI traffic follows diskio.c and sd.c: disk_initialize() sends
+ *    the wake-up clocks and CMD0, CMD1 and CMD13 at the initialization
+ *    speed, and every disk_readp() sends CMD17 and clocks the whole
+ *    512-byte sector with its CRC, however few bytes are requested.
+ *    The card answers CMD1 at once, a real card needs more retries.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "diskio.h"
+#include "spi.h"
+#include "diskimage.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// prescalers of setSpiSpeed() in spi.c and diskio.c, the second one
+// is raised to SPI_PRESCALE_MIN
+#define SPI_INIT_PRESCALE   254
+#define SPI_READ_PRESCALE   (8 < SPI_PRESCALE_MIN ? SPI_PRESCALE_MIN : 8)
+
+// peripheral clock of the board, CORE_FREQ / PBSD of startup/config.h
+#define SPI_PCLK            60000000
+
+// bytes of a command sent by sdCommand()
+#define COMMAND_BYTES       8
+
+// wake-up clocks sent by initSpi()
+#define WAKEUP_BYTES        21
+
+// data token and CRC around the sector data
+#define TOKEN_BYTES         1
+#define CRC_BYTES           2
+
+/*************/
+/* Variables */
+/*************/
+
+static int image = -1;
+
+static tU8 responseLatency = 1;
+static tU8 tokenLatency = 1;
+
+static DiskStats stats;
+static DiskRequest *requests;
+static tU32 requestCount;
+static tU32 requestCapacity;
+
+/*************/
+/* Functions */
+/*************/
+
+// adds the SPI bytes clocked with the given prescaler
+static void countSpi(tU32 bytes, tU32 prescale) {
+    stats.spiBytes += bytes;
+    stats.spiMicroseconds += bytes * 8.0 * prescale * 1000000.0 / SPI_PCLK;
+}
+
+tBool diskImageOpen(const char *path) {
+    diskImageClose();
+    image = open(path, O_RDONLY);
+    return image >= 0;
+}
+
+void diskImageClose(void) {
+    if (image >= 0) {
+        close(image);
+        image = -1;
+    }
+}
+
+void diskImageSetLatency(tU8 responseBytes, tU8 tokenBytes) {
+    responseLatency = responseBytes;
+    tokenLatency = tokenBytes;
+}
+
+void diskImageEndPhase(DiskStats *phaseStats) {
+    *phaseStats = stats;
+    stats = (DiskStats) { 0 };
+    requestCount = 0;
+}
+
+const DiskRequest *diskImageRequests(tU32 *count) {
+    *count = requestCount;
+    return requests;
+}
+
+/*****************************************************************************
+ * Functions of diskio.h
+ ****************************************************************************/
+
+DSTATUS disk_initialize(void) {
+    tU32 command = COMMAND_BYTES + responseLatency + 1;
+
+    stats.initializations++;
+    if (image < 0) {
+        // no card answers CMD0
+        countSpi(WAKEUP_BYTES + COMMAND_BYTES + 8, SPI_INIT_PRESCALE);
+        return STA_NOINIT;
+    }
+
+    // CMD0, CMD1 and CMD13 with its two byte response
+    countSpi(WAKEUP_BYTES + 3 * command + 1, SPI_INIT_PRESCALE);
+    return STA_READY;
+}
+
+DRESULT disk_readp(BYTE *dest, DWORD sector, WORD sofs, WORD count) {
+    tU8 buffer[SECTOR_SIZE];
+
+    if (requestCount == requestCapacity) {
+        requestCapacity = requestCapacity ? 2 * requestCapacity : 64;
+        requests = realloc(requests, requestCapacity * sizeof(DiskRequest));
+    }
+    requests[requestCount++] = (DiskRequest) { sector, sofs, count };
+    stats.requests++;
+
+    countSpi(COMMAND_BYTES + responseLatency + 1 + tokenLatency + TOKEN_BYTES
+             + SECTOR_SIZE + CRC_BYTES, SPI_READ_PRESCALE);
+
+    if (image < 0 || sofs + count > SECTOR_SIZE) {
+        return RES_ERROR;
+    }
+    if (pread(image, buffer, SECTOR_SIZE, (off_t) sector * SECTOR_SIZE) != SECTOR_SIZE) {
+        // out of the card, the R1 response reports an address error
+        return RES_ERROR;
+    }
+
+    // pf_read() passes no buffer to forward the data, which is only skipped here
+    if (dest) {
+        tU16 i;
+        for (i = 0; i < count; ++i) {
+            dest[i] = buffer[sofs + i];
+        }
+    }
+    stats.bytes += count;
+    return RES_OK;
+}
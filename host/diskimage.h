@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * File:
+ *    diskimage.h
+ *
+ * Description:
+ *    SD card backend of diskio.h for the host tools. Serves disk_readp()
+ *    from a FAT image file, records every request and models the SPI
+ *    traffic that diskio.c and sd.c would produce on the board.
+ *
+ *****************************************************************************/
+
+#ifndef _DISKIMAGE_H_
+#define _DISKIMAGE_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/*********/
+/* Types */
+/*********/
+
+// one call of disk_readp()
+typedef struct {
+    tU32 sector;
+    tU16 offset;
+    tU16 count;
+} DiskRequest;
+
+// traffic since the end of the previous phase
+typedef struct {
+    tU32 initializations;   // calls of disk_initialize()
+    tU32 requests;          // calls of disk_readp()
+    tU32 bytes;             // bytes returned to the caller
+    tU32 spiBytes;          // bytes clocked over SPI
+    double spiMicroseconds; // time of the SPI transfers
+} DiskStats;
+
+/*************/
+/* Functions */
+/*************/
+
+// opens the card image, returns FALSE if it can not be read;
+// without an image disk_initialize() reports a missing card
+tBool diskImageOpen(const char *path);
+void diskImageClose(void);
+
+// SPI bytes the card waits before the R1 response and before the data token
+void diskImageSetLatency(tU8 responseBytes, tU8 tokenBytes);
+
+// copies the statistics of the finished phase and clears them and the request log
+void diskImageEndPhase(DiskStats *stats);
+
+// requests of the current phase, in the order of the calls
+const DiskRequest *diskImageRequests(tU32 *count);
+
+#endif
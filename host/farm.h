@@ -0,0 +1,30 @@
+/******************************************************************************
+ *
+ * File:
+ *    farm.h
+ *
+ * Description:
+ *    Forced include for building the game logic into the host tools.
+ *    Makes the game state thread local, so every worker thread plays its
+ *    own game, and silences the log output of the game logic.
+ *
+ *****************************************************************************/
+
+#ifndef _FARM_H_
+#define _FARM_H_
+
+/***********/
+/* Defines */
+/***********/
+
+// every thread gets its own copy of the game state
+#define PACMAN_TLS __thread
+
+// skip the console output of the firmware in the game sources
+#ifdef FARM_GAME
+#define LOG_LEVEL 0
+#define _PRINTF_P_H_
+#define printf(format, args...)
+#endif
+
+#endif
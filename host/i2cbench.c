@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * File:
+ *    i2cbench.c
+ *
+ * Description:
+ *    Runs the I2C drivers of the firmware (i2c.c, eeprom.c, pca9532.c and
+ *    adc.c) on the simulated bus (i2csim.c) with the LM75 and PCA9532
+ *    models and prints the bus cost of the I2C work of a game: the
+ *    initialization, the temperature read by changeGameSpeed() every step
+ *    and the LED bar of displayTimeToEatOnI2C().
+ *
+ *    Usage: i2cbench [-k bus clock in kHz] [-T temperature in degrees]
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "pre_emptive_os/api/general.h"
+#include "i2c.h"
+#include "pca9532.h"
+#include "adc.h"
+#include "pacman.h"
+#include "i2csim.h"
+#include "i2cmodels.h"
+
+/*************/
+/* Functions */
+/*************/
+
+// the same LED bar as displayTimeToEatOnI2C() in game.c
+static void displayTimeToEatOnI2C(tU8 remainingTime) {
+    int diodesAlight = (remainingTime + 1) * 8 / INIT_TIME_TO_EAT;
+    int i;
+    for (i = 8 + diodesAlight; i < 16; ++i) {
+        setPca9532Pin(i, 1);
+    }
+    for (i = 8; i < 8 + diodesAlight; ++i) {
+        setPca9532Pin(i, 0);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Ends a phase and prints its traffic, per call if there were many.
+ *
+ ****************************************************************************/
+static void endPhase(const char *name, int calls) {
+    I2cSimStats stats;
+
+    i2cSimEndPhase(&stats);
+    printf("%-12s %5d %9.1f %7.1f %7.1f %6u %11.1f\n", name, calls,
+           (double) stats.transactions / calls, (double) stats.starts / calls,
+           (double) stats.bytes / calls, stats.nacks, stats.busMicroseconds / calls);
+}
+
+int main(int argc, char **argv) {
+    double temperature = 22.5;
+    tU16 measured = 0;
+    tU16 fullBar = 0;
+    int remaining;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "k:T:")) != -1) {
+        switch (opt) {
+            case 'k':
+                i2cSimSetClock(atoi(optarg) * 1000);
+                break;
+            case 'T':
+                temperature = atof(optarg);
+                break;
+            default:
+                fprintf(stderr, "uzycie: %s [-k zegar magistrali w kHz] [-T temperatura]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    i2cModelsAttach();
+    lm75SimSetTemperature((tS16) (temperature * 2));
+
+    printf("faza         wywolan transakcji  starty  bajty   NACK  czas us/wyw\n");
+
+    i2cInit();
+    if (!pca9532Init()) {
+        fprintf(stderr, "PCA9532 nie odpowiada\n");
+        return 1;
+    }
+    endPhase("init", 1);
+
+    measured = getTemperature();
+    endPhase("temperatura", 1);
+
+    for (remaining = INIT_TIME_TO_EAT; remaining >= 0; --remaining) {
+        displayTimeToEatOnI2C(remaining);
+        if (INIT_TIME_TO_EAT == remaining) {
+            fullBar = pca9532SimLeds();
+        }
+    }
+    endPhase("diody", INIT_TIME_TO_EAT + 1);
+
+    printf("zegar magistrali %u Hz, temperatura %u C, diody 0x%04x na poczatku"
+           " i 0x%04x na koncu\n", i2cSimClock(), measured, fullBar, pca9532SimLeds());
+    return 0;
+}
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ * File:
+ *    i2cmodels.c
+ *
+ * Description:
+ *    Models of the LM75 temperature sensor and the PCA9532 LED driver.
+ *
+ *    LM75: the first byte written selects the register (temperature,
+ *    configuration, hysteresis, overtemperature), the following bytes write
+ *    it. Reads return the bytes of the selected register over and over.
+ *
+ *    PCA9532: the first byte written is the control register, with the
+ *    register number in the low nibble and the auto-increment flag (0x10).
+ *    The input registers show a pin low when its LED is lit.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "i2csim.h"
+#include "i2cmodels.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define LM75_REGISTERS      4
+#define LM75_TEMPERATURE    0
+
+#define PCA9532_REGISTERS   10
+#define PCA9532_INPUT0      0
+#define PCA9532_INPUT1      1
+#define PCA9532_LS0         6
+#define PCA9532_AI          0x10
+
+// states of a pin in the LS registers
+#define LED_OFF             0
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    I2cSimDevice device;
+    tU8 pointer;
+    tU8 index;          // byte of the selected register
+    tBool pointerSet;   // the first byte of a write selects the register
+    tU8 registers[LM75_REGISTERS][2];
+} Lm75;
+
+typedef struct {
+    I2cSimDevice device;
+    tU8 control;
+    tBool controlSet;
+    tU8 registers[PCA9532_REGISTERS];
+} Pca9532;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ * LM75
+ ****************************************************************************/
+
+// the hysteresis and the overtemperature registers have 2 bytes
+static const tU8 lm75Sizes[LM75_REGISTERS] = { 2, 1, 2, 2 };
+
+static void lm75Start(I2cSimDevice *device, tBool read) {
+    Lm75 *lm75 = (Lm75 *) device;
+    lm75->pointerSet = read;
+    lm75->index = 0;
+}
+
+static tBool lm75Write(I2cSimDevice *device, tU8 data) {
+    Lm75 *lm75 = (Lm75 *) device;
+
+    if (!lm75->pointerSet) {
+        lm75->pointer = data % LM75_REGISTERS;
+        lm75->pointerSet = TRUE;
+    } else if (lm75->pointer != LM75_TEMPERATURE) {
+        // the temperature register is read only
+        lm75->registers[lm75->pointer][lm75->index] = data;
+        lm75->index = (lm75->index + 1) % lm75Sizes[lm75->pointer];
+    }
+    return TRUE;
+}
+
+static tU8 lm75Read(I2cSimDevice *device) {
+    Lm75 *lm75 = (Lm75 *) device;
+    tU8 data = lm75->registers[lm75->pointer][lm75->index];
+
+    lm75->index = (lm75->index + 1) % lm75Sizes[lm75->pointer];
+    return data;
+}
+
+// power-on values: 80 degrees overtemperature, 75 degrees hysteresis
+static Lm75 lm75 = {
+    { LM75_SIM_ADDRESS, lm75Start, lm75Write, lm75Read, NULL, NULL },
+    0, 0, FALSE,
+    { { 0, 0 }, { 0, 0 }, { 75, 0 }, { 80, 0 } }
+};
+
+void lm75SimSetTemperature(tS16 halfDegrees) {
+    // 9-bit two's complement, left aligned in 2 bytes
+    tU16 value = (tU16) (halfDegrees << 7);
+    lm75.registers[LM75_TEMPERATURE][0] = value >> 8;
+    lm75.registers[LM75_TEMPERATURE][1] = value & 0x80;
+}
+
+/*****************************************************************************
+ * PCA9532
+ ****************************************************************************/
+
+// updates the input registers from the states of the LEDs
+static void pca9532UpdateInputs(Pca9532 *pca) {
+    tU16 lit = pca9532SimLeds();
+    pca->registers[PCA9532_INPUT0] = ~lit & 0xFF;
+    pca->registers[PCA9532_INPUT1] = ~lit >> 8;
+}
+
+static void pca9532Start(I2cSimDevice *device, tBool read) {
+    Pca9532 *pca = (Pca9532 *) device;
+    pca->controlSet = read;
+}
+
+// advances the register number of the control register
+static void pca9532Advance(Pca9532 *pca) {
+    if (pca->control & PCA9532_AI) {
+        tU8 reg = ((pca->control & 0x0F) + 1) % PCA9532_REGISTERS;
+        pca->control = (pca->control & 0xF0) | reg;
+    }
+}
+
+static tBool pca9532Write(I2cSimDevice *device, tU8 data) {
+    Pca9532 *pca = (Pca9532 *) device;
+    tU8 reg = pca->control & 0x0F;
+
+    if (!pca->controlSet) {
+        pca->control = data & 0x1F;
+        pca->controlSet = TRUE;
+        return (data & 0x0F) < PCA9532_REGISTERS;
+    }
+
+    // the input registers are read only
+    if (reg > PCA9532_INPUT1) {
+        pca->registers[reg] = data;
+    }
+    pca9532Advance(pca);
+    return TRUE;
+}
+
+static tU8 pca9532Read(I2cSimDevice *device) {
+    Pca9532 *pca = (Pca9532 *) device;
+    tU8 data;
+
+    pca9532UpdateInputs(pca);
+    data = pca->registers[pca->control & 0x0F];
+    pca9532Advance(pca);
+    return data;
+}
+
+static Pca9532 pca9532 = {
+    { PCA9532_SIM_ADDRESS, pca9532Start, pca9532Write, pca9532Read, NULL, NULL },
+    0, FALSE,
+    { 0xFF, 0xFF, 0, 0x80, 0, 0x80, 0, 0, 0, 0 }
+};
+
+tU16 pca9532SimLeds(void) {
+    tU16 lit = 0;
+    int pin;
+
+    for (pin = 0; pin < 16; ++pin) {
+        tU8 ls = pca9532.registers[PCA9532_LS0 + pin / 4] >> (2 * (pin % 4));
+        if (LED_OFF != (ls & 0x03)) {
+            lit |= 1 << pin;
+        }
+    }
+    return lit;
+}
+
+/*****************************************************************************
+ * Bus
+ ****************************************************************************/
+
+void i2cModelsAttach(void) {
+    i2cSimAttach(&lm75.device);
+    i2cSimAttach(&pca9532.device);
+}
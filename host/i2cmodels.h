@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * File:
+ *    i2cmodels.h
+ *
+ * Description:
+ *    Register-level models of the I2C devices on the board for the
+ *    simulated bus (i2csim.h): the LM75 temperature sensor and the
+ *    PCA9532 LED driver.
+ *
+ *****************************************************************************/
+
+#ifndef _I2CMODELS_H_
+#define _I2CMODELS_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define LM75_SIM_ADDRESS     0x90
+#define PCA9532_SIM_ADDRESS  0xC0
+
+/*************/
+/* Functions */
+/*************/
+
+// connects both models to the simulated bus
+void i2cModelsAttach(void);
+
+// temperature measured by the LM75, in half degrees Celsius
+void lm75SimSetTemperature(tS16 halfDegrees);
+
+// LEDs of the PCA9532 that are lit (on or blinking), one bit per pin
+tU16 pca9532SimLeds(void);
+
+#endif
@@ -0,0 +1,256 @@
+/******************************************************************************
+ *
+ * File:
+ *    i2csim.c
+ *
+ * Description:
+ *    Simulated I2C controller of the LPC2148 in master mode.
+ *
+ *    The registers are plain bytes. Before every access of the driver the
+ *    controller applies the bits written to CONCLR and, while SI is clear,
+ *    performs the next bus action: STOP, (repeated) START, sending the byte
+ *    in DATA or receiving a byte acknowledged according to AA. Every action
+ *    ends by setting SI with the status code of the real controller, so the
+ *    transfers complete at once and the drivers never wait.
+ *
+ *    The bus time counts one bit time for START, repeated START and STOP
+ *    and nine for every byte with its acknowledge.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "i2csim.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// bits of CONSET and CONCLR
+#define CON_AA          0x04
+#define CON_SI          0x08
+#define CON_STO         0x10
+#define CON_STA         0x20
+#define CON_I2EN        0x40
+
+// status codes of the master modes
+#define STAT_START      0x08
+#define STAT_RESTART    0x10
+#define STAT_SLAW_ACK   0x18
+#define STAT_SLAW_NACK  0x20
+#define STAT_DATA_ACK   0x28
+#define STAT_DATA_NACK  0x30
+#define STAT_SLAR_ACK   0x40
+#define STAT_SLAR_NACK  0x48
+#define STAT_RECV_ACK   0x50
+#define STAT_RECV_NACK  0x58
+#define STAT_IDLE       0xF8
+
+// peripheral clock of the board, CORE_FREQ / PBSD of startup/config.h
+#define I2C_PCLK        60000000
+
+// accesses with SI clear and nothing to do, after which the driver is
+// considered to be waiting forever
+#define STALL_LIMIT     1000000
+
+/*********/
+/* Types */
+/*********/
+
+typedef enum {
+    BUS_IDLE,       // no transaction
+    BUS_ADDRESS,    // START sent, DATA holds the address
+    BUS_WRITE,      // a device receives
+    BUS_READ,       // a device sends
+    BUS_HALTED      // a byte was not acknowledged, waiting for STOP or START
+} BusState;
+
+/*************/
+/* Variables */
+/*************/
+
+volatile unsigned long i2cSimPinsel;
+
+static volatile unsigned char registers[5] = { 0, STAT_IDLE, 0, 0, 0 };
+static volatile unsigned short clockRegisters[2];
+
+static BusState state = BUS_IDLE;
+static I2cSimDevice *devices;
+static I2cSimDevice *selected;
+static tU32 clockOverride;
+static tU32 stalls;
+
+static I2cSimStats stats;
+
+/*************/
+/* Functions */
+/*************/
+
+// adds the bus time of the given number of bits
+static void countBits(tU32 bits) {
+    stats.busMicroseconds += bits * 1000000.0 / i2cSimClock();
+}
+
+// ends the transfer with the status for the driver
+static void complete(tU8 status) {
+    registers[I2C_SIM_STAT] = status;
+    registers[I2C_SIM_CONSET] |= CON_SI;
+    stalls = 0;
+}
+
+static void startCondition(void) {
+    if (BUS_IDLE == state) {
+        stats.transactions++;
+    }
+    stats.starts++;
+    countBits(1);
+    complete(BUS_IDLE == state ? STAT_START : STAT_RESTART);
+    state = BUS_ADDRESS;
+}
+
+static void stopCondition(void) {
+    if (selected) {
+        if (selected->stop) {
+            selected->stop(selected);
+        }
+        selected = NULL;
+    }
+    if (BUS_IDLE != state) {
+        countBits(1);
+    }
+    registers[I2C_SIM_CONSET] &= ~CON_STO;
+    registers[I2C_SIM_STAT] = STAT_IDLE;
+    state = BUS_IDLE;
+    stalls = 0;
+}
+
+static void sendAddress(tU8 address) {
+    tBool read = address & 0x01;
+    I2cSimDevice *device;
+
+    stats.bytes++;
+    countBits(9);
+
+    // a repeated START ends the previous transfer of the device
+    if (selected && selected->stop) {
+        selected->stop(selected);
+    }
+    selected = NULL;
+    for (device = devices; device && !selected; device = device->next) {
+        if (device->address == (address & 0xFE)) {
+            selected = device;
+        }
+    }
+
+    if (!selected) {
+        stats.nacks++;
+        state = BUS_HALTED;
+        complete(read ? STAT_SLAR_NACK : STAT_SLAW_NACK);
+        return;
+    }
+    if (selected->start) {
+        selected->start(selected, read);
+    }
+    state = read ? BUS_READ : BUS_WRITE;
+    complete(read ? STAT_SLAR_ACK : STAT_SLAW_ACK);
+}
+
+static void sendData(tU8 data) {
+    stats.bytes++;
+    countBits(9);
+    if (selected->write && selected->write(selected, data)) {
+        complete(STAT_DATA_ACK);
+    } else {
+        stats.nacks++;
+        state = BUS_HALTED;
+        complete(STAT_DATA_NACK);
+    }
+}
+
+static void receiveData(void) {
+    stats.bytes++;
+    countBits(9);
+    registers[I2C_SIM_DATA] = selected->read ? selected->read(selected) : 0xFF;
+    if (registers[I2C_SIM_CONSET] & CON_AA) {
+        complete(STAT_RECV_ACK);
+    } else {
+        // the last byte, the device stops sending
+        state = BUS_HALTED;
+        complete(STAT_RECV_NACK);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Lets the controller act on the registers written by the driver.
+ *
+ ****************************************************************************/
+static void sync(void) {
+    tU8 control;
+
+    control = registers[I2C_SIM_CONCLR];
+    if (control) {
+        registers[I2C_SIM_CONSET] &= ~control;
+        registers[I2C_SIM_CONCLR] = 0;
+    }
+
+    control = registers[I2C_SIM_CONSET];
+    if (!(control & CON_I2EN) || (control & CON_SI)) {
+        return;
+    }
+
+    if (control & CON_STO) {
+        stopCondition();
+    } else if (control & CON_STA) {
+        startCondition();
+    } else if (BUS_ADDRESS == state) {
+        sendAddress(registers[I2C_SIM_DATA]);
+    } else if (BUS_WRITE == state) {
+        sendData(registers[I2C_SIM_DATA]);
+    } else if (BUS_READ == state) {
+        receiveData();
+    } else if (++stalls == STALL_LIMIT) {
+        fprintf(stderr, "i2csim: sterownik czeka na SI, ktore nie zostanie ustawione"
+                " (status 0x%02x)\n", registers[I2C_SIM_STAT]);
+        abort();
+    }
+}
+
+volatile unsigned char *i2cSimRegister(int reg) {
+    sync();
+    return &registers[reg];
+}
+
+volatile unsigned short *i2cSimClockRegister(int reg) {
+    return &clockRegisters[reg];
+}
+
+void i2cSimAttach(I2cSimDevice *device) {
+    device->next = devices;
+    devices = device;
+}
+
+void i2cSimSetClock(tU32 hz) {
+    clockOverride = hz;
+}
+
+tU32 i2cSimClock(void) {
+    tU32 period = clockRegisters[I2C_SIM_SCLH] + clockRegisters[I2C_SIM_SCLL];
+
+    if (clockOverride) {
+        return clockOverride;
+    }
+    // the controller is not configured yet, as after reset (SCLH = SCLL = 4)
+    return I2C_PCLK / (period ? period : 8);
+}
+
+void i2cSimEndPhase(I2cSimStats *phaseStats) {
+    *phaseStats = stats;
+    stats = (I2cSimStats) { 0 };
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+ *
+ * File:
+ *    i2csim.h
+ *
+ * Description:
+ *    Simulated I2C controller of the LPC2148 for the host tools. Forced
+ *    into the build of i2c.c, it maps the I2C registers to the controller
+ *    model, which runs the transfers on a bus of device models and counts
+ *    the transactions with their bus time.
+ *
+ *****************************************************************************/
+
+#ifndef _I2CSIM_H_
+#define _I2CSIM_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// registers of the controller
+#define I2C_SIM_CONSET      0
+#define I2C_SIM_STAT        1
+#define I2C_SIM_DATA        2
+#define I2C_SIM_ADDR        3
+#define I2C_SIM_CONCLR      4
+#define I2C_SIM_SCLH        0
+#define I2C_SIM_SCLL        1
+
+// registers used by i2c.c, every access lets the controller make progress
+#define I2C_CONSET (*i2cSimRegister(I2C_SIM_CONSET))
+#define I2C_STAT   (*i2cSimRegister(I2C_SIM_STAT))
+#define I2C_DATA   (*i2cSimRegister(I2C_SIM_DATA))
+#define I2C_ADDR   (*i2cSimRegister(I2C_SIM_ADDR))
+#define I2C_CONCLR (*i2cSimRegister(I2C_SIM_CONCLR))
+#define I2C_SCLH   (*i2cSimClockRegister(I2C_SIM_SCLH))
+#define I2C_SCLL   (*i2cSimClockRegister(I2C_SIM_SCLL))
+#define I2C_PINSEL i2cSimPinsel
+
+/*********/
+/* Types */
+/*********/
+
+// model of a device on the bus
+typedef struct i2cSimDevice {
+    tU8 address;    // address with the R/W bit cleared, e.g. 0x90
+    // addressed after a START, for reading or for writing
+    void (*start)(struct i2cSimDevice *device, tBool read);
+    // receives a byte, returns TRUE to acknowledge it
+    tBool (*write)(struct i2cSimDevice *device, tU8 data);
+    // sends the next byte
+    tU8 (*read)(struct i2cSimDevice *device);
+    // STOP ended the transaction
+    void (*stop)(struct i2cSimDevice *device);
+    struct i2cSimDevice *next;
+} I2cSimDevice;
+
+// bus traffic since the end of the previous phase
+typedef struct {
+    tU32 transactions;      // from a START on an idle bus to the STOP
+    tU32 starts;            // START and repeated START conditions
+    tU32 bytes;             // address and data bytes
+    tU32 nacks;             // bytes not acknowledged by a device
+    double busMicroseconds; // time of the transfers on the bus
+} I2cSimStats;
+
+/*************/
+/* Variables */
+/*************/
+
+extern volatile unsigned long i2cSimPinsel;
+
+/*************/
+/* Functions */
+/*************/
+
+volatile unsigned char *i2cSimRegister(int reg);
+volatile unsigned short *i2cSimClockRegister(int reg);
+
+// connects a device model to the bus
+void i2cSimAttach(I2cSimDevice *device);
+
+// bus clock in Hz, 0 takes the clock set by the driver in SCLH and SCLL
+void i2cSimSetClock(tU32 hz);
+
+// bus clock used for the bus time
+tU32 i2cSimClock(void);
+
+// copies the statistics of the finished phase and clears them
+void i2cSimEndPhase(I2cSimStats *stats);
+
+#endif
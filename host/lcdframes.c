@@ -0,0 +1,253 @@
+/******************************************************************************
+ *
+ * File:
+ *    lcdframes.c
+ *
+ * Description:
+ *    Renders the game screens through lcd.c, display.c and view.c into the virtual
+ *    LCD controller (lcdsim.c) and prints the SPI traffic of every frame
+ *    with a checksum of the image, so rendering strategies can be compared
+ *    by their traffic and checked for pixel-exactness.
+ *
+ *    The frames follow game.c: the menu, "Get ready", the initial board
+ *    and then one frame per game step as drawn by the render process (the
+ *    whole board in the first step, then the changed fields and the fields
+ *    the characters moved between, and the animation of the characters).
+ *    The characters are moved by the default policies of pacman.c. On a
+ *    board bigger than the screen the camera follows Pacman, -r redraws
+ *    the whole screen every step as the reference for the checksums.
+ *
+ *    Usage: lcdframes [-s steps] [-o prefix of the PPM files]
+ *                     [-f full board drawn field by field, as before
+ *                         the single window blit]
+ *                     [-b board file] [-r]
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "pre_emptive_os/api/general.h"
+#include "lcd.h"
+#include "display.h"
+#include "pacman.h"
+#include "view.h"
+#include "lcdsim.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define CHARACTERS          NUMBER_OF_GHOSTS + 1
+
+/*************/
+/* Variables */
+/*************/
+
+static const char *prefix;
+static int fieldByField;
+static int redrawAll;
+static tU8 board[BOARD_MAX_HEIGHT * BOARD_MAX_WIDTH];
+static tU8 width, height;
+static int frame;
+static LcdSimStats total;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Reads a board written as rows of field digits, like board.txt
+ *    on the SD card.
+ *
+ ****************************************************************************/
+static void readBoardFile(const char *path) {
+    char line[BOARD_MAX_WIDTH + 3];
+    FILE *file = fopen(path, "r");
+    int length;
+
+    if (!file) {
+        fprintf(stderr, "nie mozna otworzyc %s\n", path);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), file)) {
+        for (length = 0; line[length] >= '0' && line[length] <= '0' + DOORS; ++length) {
+            board[height * BOARD_MAX_WIDTH + length] = line[length] - '0';
+        }
+        if (0 == length) {
+            continue;
+        }
+        if ((height > 0 && length != width) || ++height > BOARD_MAX_HEIGHT) {
+            fprintf(stderr, "nieprawidlowa plansza w wierszu %d\n", height + 1);
+            exit(1);
+        }
+        width = length;
+    }
+    fclose(file);
+
+    // the rows were read with the stride of the biggest board
+    for (length = 1; length < height; ++length) {
+        memmove(&board[length * width], &board[length * BOARD_MAX_WIDTH], width);
+    }
+
+    // the same check as readBoard() in sdcard.c
+    if (!checkBoard(board, width, height)) {
+        fprintf(stderr, "plansza %dx%d nie ma obramowania ze scian, jest mniejsza niz %dx%d"
+                " lub zaczyna postacie na scianie\n", width, height, BOARD_MIN_WIDTH, BOARD_MIN_HEIGHT);
+        exit(1);
+    }
+}
+
+// the same drawing as viewDisplayBoard(), -f draws field by field
+static void displayBoard(const tU8 *eaten) {
+    int row, column;
+
+    if (!fieldByField) {
+        viewDisplayBoard(eaten);
+        return;
+    }
+    for (row = 0; row < boardHeight; ++row) {
+        for (column = 0; column < boardWidth; ++column) {
+            viewDisplayField(eaten, row, column);
+        }
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Ends a frame: prints its traffic and checksum and dumps the image.
+ *
+ ****************************************************************************/
+static void endFrame(const char *name) {
+    LcdSimStats stats;
+    char path[256];
+
+    lcdSimEndFrame(&stats);
+    printf("%4d %-10s %6u %7u %6u %7u %9u  %08x\n", frame, name,
+           stats.commandBytes, stats.dataBytes, stats.windows, stats.pixels,
+           (stats.commandBytes + stats.dataBytes) * LCDSIM_BITS_PER_BYTE,
+           lcdSimChecksum());
+    if (stats.strayBytes) {
+        printf("     %u bajtow wyslanych bez wybrania sterownika\n", stats.strayBytes);
+    }
+
+    total.commandBytes += stats.commandBytes;
+    total.dataBytes += stats.dataBytes;
+    total.windows += stats.windows;
+    total.pixels += stats.pixels;
+
+    if (prefix) {
+        snprintf(path, sizeof(path), "%s%03d.ppm", prefix, frame);
+        if (!lcdSimWritePpm(path)) {
+            fprintf(stderr, "nie mozna zapisac %s\n", path);
+            exit(1);
+        }
+    }
+    ++frame;
+}
+
+int main(int argc, char **argv) {
+    int steps = 20;
+    int step, character, animationStep, i;
+    Move *moves;
+    Move drawn[CHARACTERS];
+    tU8 eaten[BOARD_BITMAP_SIZE];
+    tU8 posted[BOARD_BITMAP_SIZE];
+    tU8 changed[BOARD_BITMAP_SIZE];
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:o:fb:r")) != -1) {
+        switch (opt) {
+            case 's':
+                steps = atoi(optarg);
+                break;
+            case 'o':
+                prefix = optarg;
+                break;
+            case 'f':
+                fieldByField = 1;
+                break;
+            case 'b':
+                readBoardFile(optarg);
+                break;
+            case 'r':
+                redrawAll = 1;
+                break;
+            default:
+                fprintf(stderr, "uzycie: %s [-s kroki] [-o prefiks plikow PPM] [-f]"
+                        " [-b plik planszy] [-r]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    printf("ramka nazwa       komendy    dane   okna  piksele   bity SPI  suma\n");
+
+    lcdSimReset();
+    lcdInit();
+    displayMenu();
+    endFrame("menu");
+
+    lcdClrscr();
+    displayText("Get ready");
+    endFrame("ready");
+
+    initPacman(height ? board : NULL, width, height);
+    for (i = 0; i < BOARD_BITMAP_SIZE; ++i) {
+        posted[i] = eatenFields[i];
+    }
+    moves = makeMove();
+    viewInit(moves[PACMAN].from);
+    displayBoard(eatenFields);
+    for (character = 0; character < CHARACTERS; ++character) {
+        viewDisplayCharacter(moves[character], 0);
+    }
+    endFrame("plansza");
+
+    for (step = 0; step < steps; ++step) {
+        // the snapshot of takeSnapshot() in game.c
+        for (i = 0; i < BOARD_BITMAP_SIZE; ++i) {
+            eaten[i] = eatenFields[i];
+            changed[i] = eatenFields[i] ^ posted[i];
+            posted[i] = eatenFields[i];
+        }
+
+        moves = makeMove();
+
+        // the frame of the render process in game.c
+        if (viewFollow(eaten, moves[PACMAN].from)) {
+            // the camera moved sideways and redrew the board
+        } else if (0 == step || redrawAll) {
+            displayBoard(eaten);
+        } else {
+            viewDisplayChangedFields(eaten, changed);
+            for (character = 0; character < CHARACTERS; ++character) {
+                viewDisplayField(eaten, drawn[character].from.y, drawn[character].from.x);
+                viewDisplayField(eaten, drawn[character].to.y, drawn[character].to.x);
+            }
+        }
+
+        for (character = 0; character < CHARACTERS; ++character) {
+            drawn[character] = moves[character];
+        }
+        for (animationStep = 0; animationStep < FIELD_SIZE; ++animationStep) {
+            for (character = 0; character < CHARACTERS; ++character) {
+                viewDisplayCharacter(moves[character], animationStep);
+            }
+        }
+        endFrame("krok");
+    }
+
+    printf("razem           %6u %7u %6u %7u %9u\n",
+           total.commandBytes, total.dataBytes, total.windows, total.pixels,
+           (total.commandBytes + total.dataBytes) * LCDSIM_BITS_PER_BYTE);
+    return 0;
+}
@@ -0,0 +1,333 @@
+/******************************************************************************
+ *
+ * File:
+ *    lcdsim.c
+ *
+ * Description:
+ *    Virtual LCD controller replacing lcd_hw.c in the host tools.
+ *
+ *    Decodes the commands used by lcd.c (SWRESET, CASET, PASET, RAMWR,
+ *    RGBSET, VSCRDEF, SEP, MADCTL, COLMOD and SETCON) into the 132x132
+ *    controller memory. The visible 130x130 area starts at column and page
+ *    2, which is why lcd.c adds 2 to every coordinate. The image shows the
+ *    lines of the vertical scroll area from the one set by SEP. Pixels are
+ *    decoded only in the 8-bit colour mode (COLMOD 0x02) used by the
+ *    firmware, other modes are only counted. The MADCTL value set by
+ *    lcdInit() (MX and BGR) is taken as the normal orientation.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd_hw.h"
+#include "lcdsim.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define LCD_CMD_SWRESET   0x01
+#define LCD_CMD_SETCON    0x25
+#define LCD_CMD_CASET     0x2A
+#define LCD_CMD_PASET     0x2B
+#define LCD_CMD_RAMWR     0x2C
+#define LCD_CMD_RGBSET    0x2D
+#define LCD_CMD_VSCRDEF   0x33
+#define LCD_CMD_MADCTL    0x36
+#define LCD_CMD_SEP       0x37
+#define LCD_CMD_COLMOD    0x3A
+
+#define MADCTL_MY         0x80
+#define MADCTL_MX         0x40
+#define MADCTL_MV         0x20
+
+#define COLMOD_8BIT       0x02
+
+// size of the controller memory and offset of the visible area
+#define RAM_SIZE          132
+#define VISIBLE_OFFSET    2
+
+// entries of the colour table for red, green and blue
+#define LUT_RED           0
+#define LUT_GREEN         8
+#define LUT_BLUE          16
+#define LUT_SIZE          20
+
+/*************/
+/* Variables */
+/*************/
+
+static tU8 ram[RAM_SIZE][RAM_SIZE];
+static tU8 framebuffer[LCDSIM_HEIGHT][LCDSIM_WIDTH];
+
+// colour table, the power-on values are the ones set by lcdInit()
+static const tU8 defaultLut[LUT_SIZE] = {
+    0, 2, 4, 6, 9, 11, 13, 15,
+    0, 2, 4, 6, 9, 11, 13, 15,
+    0, 6, 10, 15
+};
+static tU8 lut[LUT_SIZE];
+
+static tBool selected;
+static tU8 command;
+static tU8 paramIndex;
+static tU8 madctl;
+static tU8 colmod;
+static tU8 contrast;
+
+// window and the position of the next pixel
+static tU8 columnStart, columnEnd, pageStart, pageEnd;
+static tU8 column, page;
+
+// vertical scroll area: top fixed and scrolled lines, first line shown
+static tU8 scrollTop, scrollLines, scrollStart;
+
+static LcdSimStats stats;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Restores the state of the controller after SWRESET, the memory
+ *    is left as it was.
+ *
+ ****************************************************************************/
+static void resetController(void) {
+    command = 0;
+    paramIndex = 0;
+    madctl = MADCTL_MX;
+    colmod = COLMOD_8BIT;
+    contrast = 0;
+    columnStart = pageStart = 0;
+    columnEnd = pageEnd = RAM_SIZE - 1;
+    column = page = 0;
+    scrollTop = scrollStart = 0;
+    scrollLines = RAM_SIZE;
+    memcpy(lut, defaultLut, LUT_SIZE);
+}
+
+void lcdSimReset(void) {
+    memset(ram, 0, sizeof(ram));
+    memset(&stats, 0, sizeof(stats));
+    selected = FALSE;
+    resetController();
+}
+
+void lcdSimEndFrame(LcdSimStats *frameStats) {
+    *frameStats = stats;
+    memset(&stats, 0, sizeof(stats));
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Writes one pixel at the current position and advances it within
+ *    the window, along the columns or along the pages (MADCTL MV).
+ *
+ ****************************************************************************/
+static void writePixel(tU8 color) {
+    tU8 x = (madctl & MADCTL_MX) ? column : RAM_SIZE - 1 - column;
+    tU8 y = (madctl & MADCTL_MY) ? RAM_SIZE - 1 - page : page;
+
+    if (column < RAM_SIZE && page < RAM_SIZE) {
+        ram[y][x] = color;
+    }
+    stats.pixels++;
+
+    if (madctl & MADCTL_MV) {
+        if (page++ >= pageEnd) {
+            page = pageStart;
+            if (column++ >= columnEnd) {
+                column = columnStart;
+            }
+        }
+    } else {
+        if (column++ >= columnEnd) {
+            column = columnStart;
+            if (page++ >= pageEnd) {
+                page = pageStart;
+            }
+        }
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Interprets a parameter of the current command.
+ *
+ ****************************************************************************/
+static void receiveData(tU8 data) {
+    switch (command) {
+        case LCD_CMD_CASET:
+            if (0 == paramIndex) {
+                columnStart = data;
+            } else if (1 == paramIndex) {
+                columnEnd = data;
+            }
+            break;
+        case LCD_CMD_PASET:
+            if (0 == paramIndex) {
+                pageStart = data;
+            } else if (1 == paramIndex) {
+                pageEnd = data;
+            }
+            break;
+        case LCD_CMD_RAMWR:
+            if (COLMOD_8BIT == colmod) {
+                writePixel(data);
+            }
+            break;
+        case LCD_CMD_RGBSET:
+            if (paramIndex < LUT_SIZE) {
+                lut[paramIndex] = data & 0x0f;
+            }
+            break;
+        case LCD_CMD_VSCRDEF:
+            // the bottom fixed lines are the remaining ones
+            if (0 == paramIndex) {
+                scrollTop = data;
+            } else if (1 == paramIndex) {
+                scrollLines = data;
+            }
+            break;
+        case LCD_CMD_SEP:
+            if (0 == paramIndex) {
+                scrollStart = data;
+            }
+            break;
+        case LCD_CMD_MADCTL:
+            madctl = data;
+            break;
+        case LCD_CMD_COLMOD:
+            colmod = data & 0x07;
+            break;
+        case LCD_CMD_SETCON:
+            contrast = data;
+            break;
+        default:
+            // parameters of the remaining commands do not change the image
+            break;
+    }
+    if (paramIndex < 0xff) {
+        paramIndex++;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Starts a new command.
+ *
+ ****************************************************************************/
+static void receiveCommand(tU8 cmd) {
+    command = cmd;
+    paramIndex = 0;
+
+    switch (cmd) {
+        case LCD_CMD_SWRESET:
+            resetController();
+            break;
+        case LCD_CMD_CASET:
+            stats.windows++;
+            break;
+        case LCD_CMD_RAMWR:
+            column = columnStart;
+            page = pageStart;
+            break;
+    }
+}
+
+/*****************************************************************************
+ * Functions of lcd_hw.h
+ ****************************************************************************/
+
+void sendToLCD(tU8 firstBit, tU8 data) {
+    if (!selected) {
+        stats.strayBytes++;
+        return;
+    }
+
+    if (firstBit) {
+        stats.dataBytes++;
+        receiveData(data);
+    } else {
+        stats.commandBytes++;
+        receiveCommand(data);
+    }
+}
+
+void initSpiForLcd(void) {
+    selected = FALSE;
+}
+
+void selectLCD(tBool select) {
+    if (select && !selected) {
+        stats.selects++;
+    }
+    selected = select;
+}
+
+/*****************************************************************************
+ * Framebuffer
+ ****************************************************************************/
+
+// line of the memory shown on given line of the panel
+static int shownLine(int line) {
+    int offset = scrollStart - scrollTop;
+
+    if (line < scrollTop || line >= scrollTop + scrollLines || 0 == scrollLines) {
+        return line;
+    }
+    return scrollTop + ((line - scrollTop + offset) % scrollLines + scrollLines) % scrollLines;
+}
+
+const tU8 *lcdSimFramebuffer(void) {
+    int y;
+
+    for (y = 0; y < LCDSIM_HEIGHT; ++y) {
+        memcpy(framebuffer[y], &ram[shownLine(y + VISIBLE_OFFSET)][VISIBLE_OFFSET], LCDSIM_WIDTH);
+    }
+    return &framebuffer[0][0];
+}
+
+tU32 lcdSimChecksum(void) {
+    const tU8 *pixels = lcdSimFramebuffer();
+    tU32 hash = 2166136261u;
+    int i;
+
+    for (i = 0; i < LCDSIM_WIDTH * LCDSIM_HEIGHT; ++i) {
+        hash = (hash ^ pixels[i]) * 16777619u;
+    }
+    return hash;
+}
+
+tBool lcdSimWritePpm(const char *path) {
+    const tU8 *pixels = lcdSimFramebuffer();
+    FILE *file = fopen(path, "wb");
+    tU8 rgb[3];
+    int i;
+
+    if (!file) {
+        return FALSE;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", LCDSIM_WIDTH, LCDSIM_HEIGHT);
+    for (i = 0; i < LCDSIM_WIDTH * LCDSIM_HEIGHT; ++i) {
+        tU8 color = pixels[i];
+        rgb[0] = lut[LUT_RED + (color >> 5)] * 17;
+        rgb[1] = lut[LUT_GREEN + ((color >> 2) & 0x07)] * 17;
+        rgb[2] = lut[LUT_BLUE + (color & 0x03)] * 17;
+        fwrite(rgb, 1, 3, file);
+    }
+
+    return 0 == fclose(file);
+}
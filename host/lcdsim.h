@@ -0,0 +1,67 @@
+/******************************************************************************
+ *
+ * File:
+ *    lcdsim.h
+ *
+ * Description:
+ *    Virtual LCD controller for the host tools. Implements the functions
+ *    of lcd_hw.h and decodes the 9-bit command stream sent by lcd.c into
+ *    a framebuffer, counting the traffic of every frame.
+ *
+ *****************************************************************************/
+
+#ifndef _LCDSIM_H_
+#define _LCDSIM_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// visible area, the same as used by lcd.c
+#define LCDSIM_WIDTH        130
+#define LCDSIM_HEIGHT       130
+
+// every command and data byte is sent as 9 bits
+#define LCDSIM_BITS_PER_BYTE 9
+
+/*********/
+/* Types */
+/*********/
+
+// traffic sent to the controller since the end of the previous frame
+typedef struct {
+    tU32 commandBytes;
+    tU32 dataBytes;
+    tU32 windows;       // CASET commands, lcd.c sends one with every window
+    tU32 pixels;        // pixels written by RAMWR
+    tU32 selects;       // chip select activations
+    tU32 strayBytes;    // bytes sent while the controller was not selected
+} LcdSimStats;
+
+/*************/
+/* Functions */
+/*************/
+
+// restores the power-on state of the controller and clears the statistics
+void lcdSimReset(void);
+
+// copies the statistics of the finished frame and clears them
+void lcdSimEndFrame(LcdSimStats *stats);
+
+// visible area in the RRRGGGBB format, LCDSIM_HEIGHT rows of LCDSIM_WIDTH pixels
+const tU8 *lcdSimFramebuffer(void);
+
+// FNV-1a hash of the visible area, for comparing frames between builds
+tU32 lcdSimChecksum(void);
+
+// writes the visible area through the RGBSET colour table as a binary PPM,
+// returns FALSE when the file can not be written
+tBool lcdSimWritePpm(const char *path);
+
+#endif
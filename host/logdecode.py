@@ -0,0 +1,85 @@
+#!/usr/bin/python
+
+import os
+import re
+import sys
+import struct
+import argparse as ap
+
+
+SYNC = 0xA7
+MAX_ARGS = 4
+
+EVENT = re.compile(r'X\((\w+),\s*("(?:[^"\\]|\\.)*")\)')
+CONVERSION = re.compile(r'%([-0 ]*\d*)([dux%])')
+DEFAULT_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             '..', 'logevents.h')
+
+
+def events(path):
+    """Reads the (name, format) pairs of LOG_EVENTS in the order of their ids."""
+    with open(path) as table:
+        return [(name, bytes(text[1:-1], 'ascii').decode('unicode_escape'))
+                for name, text in EVENT.findall(table.read())]
+
+
+def format_event(text, args):
+    """Formats the event like printf would on the device."""
+    args = iter(args)
+
+    def convert(match):
+        flags, kind = match.groups()
+        if kind == '%':
+            return '%'
+        value = next(args, 0)
+        if kind != 'd':
+            value &= 0xffffffff
+        return ('%' + flags + kind.replace('u', 'd')) % value
+
+    return CONVERSION.sub(convert, text)
+
+
+def decode(data, table):
+    """Yields the text of the stream with every trace record replaced
+    by its formatted message."""
+    i = 0
+    text = bytearray()
+    while i < len(data):
+        if data[i] != SYNC or i + 3 > len(data) or data[i + 2] > MAX_ARGS:
+            text.append(data[i])
+            i += 1
+            continue
+        event, argc = data[i + 1], data[i + 2]
+        end = i + 3 + 4 * argc
+        if end > len(data):
+            break
+        if text:
+            yield text.decode('latin-1')
+            text = bytearray()
+        args = struct.unpack('<%di' % argc, data[i + 3:end])
+        if event < len(table):
+            yield format_event(table[event][1], args)
+        else:
+            yield '<unknown event {} {}>\n'.format(event, args)
+        i = end
+    if text:
+        yield text.decode('latin-1')
+
+
+def main():
+    parser = ap.ArgumentParser(
+        description='decodes a captured Pacman binary log trace')
+    parser.add_argument('file', type=ap.FileType('rb'), nargs='?',
+                        default=sys.stdin.buffer,
+                        help='the captured trace (stdin by default)')
+    parser.add_argument('-e', '--events', default=DEFAULT_TABLE,
+                        help='the event table of the firmware (logevents.h)')
+    args = parser.parse_args()
+
+    table = events(args.events)
+    for text in decode(args.file.read(), table):
+        sys.stdout.write(text.replace('\r', ''))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Builds a FAT12/16/32 card image with files in the root directory.
+
+The images feed the SD card backend of the host tools (diskimage.c), so
+pf_mount(), pf_open() and pf_read() can be measured on different card
+layouts: FAT type, cluster size, a partition table in front of the file
+system and fragmented files.
+
+Usage: mkfatimage.py [-F 12|16|32] [-s sectors] [-S MiB] [--mbr]
+                     [--interleave] -o card.img file...
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+SECTOR_SIZE = 512
+DIR_ENTRY_SIZE = 32
+NUM_FATS = 2
+
+# first sector of the partition when a partition table is used
+PARTITION_START = 63
+
+# default image size in MiB and sectors per cluster of every FAT type,
+# chosen so that the cluster count falls in the range of the type
+DEFAULT_LAYOUT = {12: (4, 4), 16: (16, 4), 32: (40, 1)}
+
+
+def fat_type(clusters):
+    """FAT type defined by the number of clusters, as pf_mount() decides."""
+    if clusters < 4085:
+        return 12
+    if clusters < 65525:
+        return 16
+    return 32
+
+
+def short_name(path):
+    """8.3 directory name of a file."""
+    base, ext = os.path.splitext(os.path.basename(path).upper())
+    ext = ext[1:]
+    if not base or len(base) > 8 or len(ext) > 3:
+        sys.exit("%s: the name does not fit 8.3" % path)
+    return (base.ljust(8) + ext.ljust(3)).encode("ascii")
+
+
+def layout(fat, cluster_sectors, sectors):
+    """Returns reserved sectors, root directory sectors, FAT size and cluster count."""
+    reserved = 32 if fat == 32 else 1
+    root_sectors = 0 if fat == 32 else 512 * DIR_ENTRY_SIZE // SECTOR_SIZE
+    fat_size = 1
+    while True:
+        data = sectors - reserved - NUM_FATS * fat_size - root_sectors
+        clusters = data // cluster_sectors
+        entries = clusters + 2
+        size = {12: (entries * 3 + 1) // 2, 16: entries * 2, 32: entries * 4}[fat]
+        needed = (size + SECTOR_SIZE - 1) // SECTOR_SIZE
+        if needed <= fat_size:
+            return reserved, root_sectors, fat_size, clusters
+        fat_size = needed
+
+
+def set_fat(table, fat, cluster, value):
+    if fat == 12:
+        offset = cluster * 3 // 2
+        if cluster & 1:
+            table[offset] = (table[offset] & 0x0F) | ((value << 4) & 0xF0)
+            table[offset + 1] = (value >> 4) & 0xFF
+        else:
+            table[offset] = value & 0xFF
+            table[offset + 1] = (table[offset + 1] & 0xF0) | ((value >> 8) & 0x0F)
+    elif fat == 16:
+        struct.pack_into("<H", table, cluster * 2, value)
+    else:
+        struct.pack_into("<I", table, cluster * 4, value)
+
+
+def allocate(sizes, cluster_bytes, first, interleave):
+    """Lists the clusters of every file, one after another or round robin."""
+    needed = [(size + cluster_bytes - 1) // cluster_bytes for size in sizes]
+    chains = [[] for _ in sizes]
+    cluster = first
+    if interleave:
+        for step in range(max(needed, default=0)):
+            for i, count in enumerate(needed):
+                if step < count:
+                    chains[i].append(cluster)
+                    cluster += 1
+    else:
+        for i, count in enumerate(needed):
+            chains[i] = list(range(cluster, cluster + count))
+            cluster += count
+    return chains, cluster
+
+
+def boot_sector(fat, args, sectors, reserved, root_sectors, fat_size, hidden):
+    sector = bytearray(SECTOR_SIZE)
+    struct.pack_into("<3s8sHBHBHHBHHHII", sector, 0,
+                     b"\xEB\x3C\x90", b"PACMAN  ", SECTOR_SIZE, args.cluster,
+                     reserved, NUM_FATS, root_sectors * SECTOR_SIZE // DIR_ENTRY_SIZE,
+                     sectors if fat != 32 and sectors < 0x10000 else 0, 0xF8,
+                     0 if fat == 32 else fat_size, 63, 255, hidden,
+                     sectors if fat == 32 or sectors >= 0x10000 else 0)
+    if fat == 32:
+        struct.pack_into("<IHHIHH12sBBBI11s8s", sector, 36,
+                         fat_size, 0, 0, 2, 1, 6, bytes(12),
+                         0x80, 0, 0x29, 0x50414321, b"PACMAN     ", b"FAT32   ")
+    else:
+        struct.pack_into("<BBBI11s8s", sector, 36,
+                         0x80, 0, 0x29, 0x50414321, b"PACMAN     ",
+                         ("FAT%d   " % fat).encode("ascii"))
+    sector[510:512] = b"\x55\xAA"
+    return sector
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Builds a FAT card image.")
+    parser.add_argument("-F", dest="fat", type=int, choices=(12, 16, 32), default=16)
+    parser.add_argument("-s", dest="cluster", type=int,
+                        help="sectors per cluster, by default 4 (FAT12/16) or 1 (FAT32)")
+    parser.add_argument("-S", dest="size", type=int,
+                        help="image size in MiB, by default 4, 16 or 40 for FAT12, 16 or 32")
+    parser.add_argument("--mbr", action="store_true",
+                        help="put the file system in a partition")
+    parser.add_argument("--interleave", action="store_true",
+                        help="allocate the clusters of the files round robin")
+    parser.add_argument("-o", dest="output", required=True)
+    parser.add_argument("files", nargs="*")
+    args = parser.parse_args()
+    if args.size is None:
+        args.size = DEFAULT_LAYOUT[args.fat][0]
+    if args.cluster is None:
+        args.cluster = DEFAULT_LAYOUT[args.fat][1]
+
+    if args.cluster not in (1, 2, 4, 8, 16, 32, 64, 128):
+        sys.exit("sectors per cluster must be a power of two up to 128")
+
+    total = args.size * 1024 * 1024 // SECTOR_SIZE
+    hidden = PARTITION_START if args.mbr else 0
+    sectors = total - hidden
+    reserved, root_sectors, fat_size, clusters = layout(args.fat, args.cluster, sectors)
+    if fat_type(clusters) != args.fat:
+        sys.exit("%d clusters make FAT%d, change the size or the cluster size"
+                 % (clusters, fat_type(clusters)))
+
+    contents = [open(path, "rb").read() for path in args.files]
+    cluster_bytes = args.cluster * SECTOR_SIZE
+
+    # FAT32 keeps the root directory in a cluster chain, starting at cluster 2
+    root_entries = 1 + len(args.files)
+    first = 2
+    root_chain = []
+    if args.fat == 32:
+        count = (root_entries * DIR_ENTRY_SIZE + cluster_bytes - 1) // cluster_bytes
+        root_chain = list(range(2, 2 + count))
+        first += count
+    elif root_entries * DIR_ENTRY_SIZE > root_sectors * SECTOR_SIZE:
+        sys.exit("too many files for the root directory")
+
+    chains, end = allocate([len(data) for data in contents], cluster_bytes, first,
+                           args.interleave)
+    if end > clusters + 2:
+        sys.exit("the files do not fit on the image")
+
+    image = bytearray(total * SECTOR_SIZE)
+    base = hidden * SECTOR_SIZE
+    fat_start = base + reserved * SECTOR_SIZE
+    root_start = fat_start + NUM_FATS * fat_size * SECTOR_SIZE
+    data_start = root_start + root_sectors * SECTOR_SIZE
+
+    def cluster_offset(cluster):
+        return data_start + (cluster - 2) * cluster_bytes
+
+    image[base:base + SECTOR_SIZE] = boot_sector(args.fat, args, sectors, reserved,
+                                                 root_sectors, fat_size, hidden)
+    if args.fat == 32:
+        info = bytearray(SECTOR_SIZE)
+        struct.pack_into("<I", info, 0, 0x41615252)
+        struct.pack_into("<IIII", info, 484, 0x61417272, 0xFFFFFFFF, 0xFFFFFFFF, 0)
+        struct.pack_into("<I", info, 508, 0xAA550000)
+        image[base + SECTOR_SIZE:base + 2 * SECTOR_SIZE] = info
+        backup = base + 6 * SECTOR_SIZE
+        image[backup:backup + SECTOR_SIZE] = image[base:base + SECTOR_SIZE]
+
+    if args.mbr:
+        kind = {12: 0x01, 16: 0x06 if sectors >= 65536 else 0x04, 32: 0x0C}[args.fat]
+        struct.pack_into("<B3sB3sII", image, 446, 0, b"\x00\x01\x01", kind,
+                         b"\xFE\xFF\xFF", hidden, sectors)
+        image[510:512] = b"\x55\xAA"
+
+    # allocation table, the end of chain values fit every FAT type
+    end_of_chain = {12: 0xFFF, 16: 0xFFFF, 32: 0x0FFFFFFF}[args.fat]
+    table = bytearray(fat_size * SECTOR_SIZE)
+    set_fat(table, args.fat, 0, end_of_chain & ~0xFF | 0xF8)
+    set_fat(table, args.fat, 1, end_of_chain)
+    for chain in chains + [root_chain]:
+        for current, following in zip(chain, chain[1:] + [end_of_chain]):
+            set_fat(table, args.fat, current, following)
+    for i in range(NUM_FATS):
+        offset = fat_start + i * fat_size * SECTOR_SIZE
+        image[offset:offset + len(table)] = table
+
+    # root directory: the volume label and the files
+    directory = bytearray(root_entries * DIR_ENTRY_SIZE)
+    struct.pack_into("<11sB", directory, 0, b"PACMAN     ", 0x08)
+    for i, (path, data, chain) in enumerate(zip(args.files, contents, chains)):
+        first_cluster = chain[0] if chain else 0
+        struct.pack_into("<11sB8sH4sHI", directory, (i + 1) * DIR_ENTRY_SIZE,
+                         short_name(path), 0x20, bytes(8), first_cluster >> 16,
+                         bytes(4), first_cluster & 0xFFFF, len(data))
+        for j, cluster in enumerate(chain):
+            piece = data[j * cluster_bytes:(j + 1) * cluster_bytes]
+            offset = cluster_offset(cluster)
+            image[offset:offset + len(piece)] = piece
+
+    if args.fat == 32:
+        for j, cluster in enumerate(root_chain):
+            piece = directory[j * cluster_bytes:(j + 1) * cluster_bytes]
+            offset = cluster_offset(cluster)
+            image[offset:offset + len(piece)] = piece
+    else:
+        image[root_start:root_start + len(directory)] = directory
+
+    with open(args.output, "wb") as output:
+        output.write(image)
+    print("%s: FAT%d, %d clusters of %d sectors, FAT of %d sectors%s"
+          % (args.output, args.fat, clusters, args.cluster, fat_size,
+             ", partition at sector %d" % hidden if args.mbr else ""))
+
+
+if __name__ == "__main__":
+    main()
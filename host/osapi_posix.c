@@ -0,0 +1,779 @@
+/******************************************************************************
+ *
+ * File:
+ *    osapi_posix.c
+ *
+ * Description:
+ *    Implementation of the pre_emptive_os API (osapi.h) on POSIX threads,
+ *    so the firmware processes can run on a workstation.
+ *
+ *    Every process is a thread, but only the process holding the processor
+ *    (running) executes, the others wait for their turn. The scheduler
+ *    picks the ready process with the highest priority, the oldest one
+ *    among processes of equal priority. Threads can not be stopped from
+ *    outside, so a process woken by an interrupt (the tick) takes the
+ *    processor over at the next OS call of the running process.
+ *
+ *    The main thread becomes the tick interrupt after osStart(): it advances
+ *    the sleeping and waiting processes and the timers, and calls appTick()
+ *    with "interrupts disabled" (see halDisableInterrupts_oshal()).
+ *    Timer callbacks run in a timer process of priority 0, created by
+ *    osInitTimers() like in the original kernel.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "osapi_posix.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// states of a process
+#define PROC_FREE       0
+#define PROC_CREATED    1
+#define PROC_READY      2
+#define PROC_RUNNING    3
+#define PROC_SLEEPING   4
+#define PROC_WAITING    5
+#define PROC_SUSPENDED  6
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 state;
+    tU8 prio;
+    void (*proc)(void *arg);
+    void *param;
+    pthread_t thread;
+    pthread_cond_t turn;    // signalled when the process gets the processor
+    tU32 order;             // when the process became ready or started waiting
+    tU32 timeout;           // ticks to sleep or wait, 0 = forever
+    tU32 wakeTick;          // tick ending the sleep or the wait
+    void *waitObject;       // semaphore or queue waited on
+    void *message;          // message handed over by osPostQueue()
+    tBool timedOut;
+} Process;
+
+/*************/
+/* Variables */
+/*************/
+
+// protects the scheduler state, never held while calling the firmware
+static pthread_mutex_t osLock = PTHREAD_MUTEX_INITIALIZER;
+
+// held while the "interrupts are disabled", recursive
+static pthread_mutex_t irqLock;
+
+static Process processes[MAX_NUM_PROC];
+
+// process holding the processor, NULL when all processes are blocked
+static Process *running;
+
+// process of the calling thread, NULL in the tick (interrupt) and main thread
+static __thread Process *current;
+
+// set by the tick when a process of higher priority than the running one is ready
+static tBool preempt;
+
+static tBool started;
+static volatile tU32 ticks;
+static tU32 order;
+static volatile tU32 tickPeriod = OS_TICK_MS * 1000;
+
+// armed timers and the process running their callbacks
+static tTimer *timers;
+static tCntSem timerSem;
+
+/*************/
+/* Functions */
+/*************/
+
+// called on every tick by the kernel, defined by the firmware (main.c)
+void appTick(tU32 elapsedTime) __attribute__((weak));
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Finds the process that should run: the ready process of the highest
+ *    priority (lowest number), the oldest one among equal priorities.
+ *    Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static Process *highestReady(void) {
+    Process *best = NULL;
+    int i;
+
+    for (i = 0; i < MAX_NUM_PROC; ++i) {
+        Process *p = &processes[i];
+        if ((PROC_READY == p->state || PROC_RUNNING == p->state)
+                && (!best || p->prio < best->prio
+                    || (p->prio == best->prio && (tS32) (p->order - best->order) < 0))) {
+            best = p;
+        }
+    }
+    return best;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Finds the process that should get a semaphore or a queue message:
+ *    the waiting process of the highest priority, the first one to wait
+ *    among equal priorities. Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static Process *firstWaiter(void *object) {
+    Process *best = NULL;
+    int i;
+
+    for (i = 0; i < MAX_NUM_PROC; ++i) {
+        Process *p = &processes[i];
+        if (PROC_WAITING == p->state && object == p->waitObject
+                && (!best || p->prio < best->prio
+                    || (p->prio == best->prio && (tS32) (p->order - best->order) < 0))) {
+            best = p;
+        }
+    }
+    return best;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gives the processor to the process that should run and, if it is not
+ *    the calling process, waits until the calling process gets it back.
+ *    The caller sets its own state first. Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static void reschedule(Process *self) {
+    Process *next = highestReady();
+
+    preempt = FALSE;
+    running = next;
+    if (next) {
+        next->state = PROC_RUNNING;
+        if (next != self) {
+            pthread_cond_signal(&next->turn);
+        }
+    }
+    while (self && running != self) {
+        pthread_cond_wait(&self->turn, &osLock);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Makes a process ready. Starts it at once if the processor is idle,
+ *    or marks the running process to be preempted if the woken one has
+ *    a higher priority. Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static void wakeUp(Process *p) {
+    p->state = PROC_READY;
+    p->order = ++order;
+
+    if (!started) {
+        return;
+    }
+    if (!running) {
+        reschedule(NULL);
+    } else if (p->prio < running->prio) {
+        preempt = TRUE;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Lets a process of higher priority take the processor over from the
+ *    calling process. Every OS call is such a preemption point.
+ *    Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static void preemptionPoint(void) {
+    Process *self = current;
+
+    if (self && preempt && running == self && highestReady() != self) {
+        self->state = PROC_READY;
+        self->order = ++order;
+        reschedule(self);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Blocks the calling process until it is woken up by wakeUp()
+ *    or the timeout passes. Has to be called with osLock held.
+ *
+ ****************************************************************************/
+static void block(tU8 state, void *object, tU32 timeout) {
+    Process *self = current;
+
+    self->state = state;
+    self->order = ++order;
+    self->waitObject = object;
+    self->message = NULL;
+    self->timedOut = FALSE;
+    self->timeout = timeout;
+    self->wakeTick = ticks + timeout;
+    reschedule(self);
+    self->waitObject = NULL;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Body of every process thread.
+ *
+ ****************************************************************************/
+static void *processThread(void *arg) {
+    Process *self = (Process *) arg;
+
+    current = self;
+    pthread_mutex_lock(&osLock);
+    while (running != self) {
+        pthread_cond_wait(&self->turn, &osLock);
+    }
+    pthread_mutex_unlock(&osLock);
+
+    self->proc(self->param);
+    osDeleteProcess();
+    return NULL;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Process running the callbacks of fired timers.
+ *
+ ****************************************************************************/
+static void timerProcess(void *arg) {
+    tTimer *timer;
+    tTimer **link;
+    tU8 error;
+
+    while (1) {
+        osSemTake(&timerSem, 0, &error);
+
+        pthread_mutex_lock(&osLock);
+        link = &timers;
+        while ((timer = *link)) {
+            if (timer->delta) {
+                link = &timer->next;
+                continue;
+            }
+            if (timer->repeat) {
+                timer->delta = timer->time;
+                link = &timer->next;
+            } else {
+                *link = timer->next;
+            }
+
+            pthread_mutex_unlock(&osLock);
+            timer->callback();
+            pthread_mutex_lock(&osLock);
+            // the list could change during the callback
+            link = &timers;
+        }
+        pthread_mutex_unlock(&osLock);
+    }
+}
+
+/*****************************************************************************
+ * Interrupt state
+ ****************************************************************************/
+
+tU32 halDisableInterrupts_oshal(void) {
+    pthread_mutex_lock(&irqLock);
+    return 0;
+}
+
+void halRestoreInterrupts_oshal(tU32 state) {
+    pthread_mutex_unlock(&irqLock);
+}
+
+/*****************************************************************************
+ * Kernel
+ ****************************************************************************/
+
+void osInit(void) {
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&irqLock, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    memset(processes, 0, sizeof(processes));
+    running = NULL;
+    timers = NULL;
+    ticks = 0;
+    started = FALSE;
+}
+
+void osStart(void) {
+    struct timespec delay;
+
+    pthread_mutex_lock(&osLock);
+    started = TRUE;
+    reschedule(NULL);
+    pthread_mutex_unlock(&osLock);
+
+    // the main thread becomes the tick interrupt
+    while (1) {
+        tU32 period = tickPeriod ? tickPeriod : 1000;
+        delay.tv_sec = period / 1000000;
+        delay.tv_nsec = (period % 1000000) * 1000;
+        nanosleep(&delay, NULL);
+        if (tickPeriod) {
+            osTick();
+        }
+    }
+}
+
+void osTick(void) {
+    tBool fired = FALSE;
+    tTimer *timer;
+    tU8 error;
+    int i;
+
+    halDisableInterrupts_oshal();
+
+    pthread_mutex_lock(&osLock);
+    ++ticks;
+    for (i = 0; i < MAX_NUM_PROC; ++i) {
+        Process *p = &processes[i];
+        if ((PROC_SLEEPING == p->state || PROC_WAITING == p->state)
+                && p->timeout && (tS32) (ticks - p->wakeTick) >= 0) {
+            p->timedOut = TRUE;
+            p->waitObject = NULL;
+            wakeUp(p);
+        }
+    }
+    for (timer = timers; timer; timer = timer->next) {
+        if (timer->delta && 0 == --timer->delta) {
+            fired = TRUE;
+        }
+    }
+    pthread_mutex_unlock(&osLock);
+
+    if (fired) {
+        osSemGive(&timerSem, &error);
+    }
+    if (appTick) {
+        appTick(OS_TICK_MS);
+    }
+
+    halRestoreInterrupts_oshal(0);
+}
+
+void osGetHighPrioProc(void) {
+    pthread_mutex_lock(&osLock);
+    preemptionPoint();
+    pthread_mutex_unlock(&osLock);
+}
+
+void osISREnter(void) {
+}
+
+void osISRExit(void) {
+}
+
+void osSetTickPeriod(tU32 microseconds) {
+    tickPeriod = microseconds;
+}
+
+tU32 osTickCount(void) {
+    return ticks;
+}
+
+/*****************************************************************************
+ * Processes
+ ****************************************************************************/
+
+void osCreateProcess(void (*pProc)(void *arg), tU8 *pStk, tU16 stkSize,
+                     tU8 *pPid, tU8 prio, void *pParam, tU8 *pError) {
+    pthread_attr_t attr;
+    Process *p = NULL;
+    int i;
+
+    if (prio >= NUM_PRIO) {
+        *pError = OS_ERROR_PRIO;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    for (i = 0; i < MAX_NUM_PROC && !p; ++i) {
+        if (PROC_FREE == processes[i].state) {
+            p = &processes[i];
+            *pPid = i;
+        }
+    }
+    if (!p) {
+        pthread_mutex_unlock(&osLock);
+        *pError = OS_ERROR_ALLOCATE;
+        return;
+    }
+
+    memset(p, 0, sizeof(Process));
+    p->state = PROC_CREATED;
+    p->prio = prio;
+    p->proc = pProc;
+    p->param = pParam;
+    pthread_cond_init(&p->turn, NULL);
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_create(&p->thread, &attr, processThread, p);
+    pthread_attr_destroy(&attr);
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
+
+void osStartProcess(tU8 pid, tU8 *pError) {
+    if (pid >= MAX_NUM_PROC || PROC_CREATED != processes[pid].state) {
+        *pError = OS_ERROR_PID;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    wakeUp(&processes[pid]);
+    preemptionPoint();
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
+
+void osDeleteProcess(void) {
+    Process *self = current;
+
+    pthread_mutex_lock(&osLock);
+    self->state = PROC_FREE;
+    reschedule(NULL);
+    pthread_mutex_unlock(&osLock);
+
+    pthread_exit(NULL);
+}
+
+tU8 osPid(tU8 *pError) {
+    if (!current) {
+        *pError = OS_ERROR_ISR;
+        return 0;
+    }
+    *pError = OS_OK;
+    return current - processes;
+}
+
+void osSleep(tU32 ticks) {
+    struct timespec delay;
+    tU32 period;
+
+    if (!current) {
+        // outside of the processes (before osStart()) the caller just sleeps
+        period = ticks * (tickPeriod ? tickPeriod : OS_TICK_MS * 1000);
+        delay.tv_sec = period / 1000000;
+        delay.tv_nsec = (period % 1000000) * 1000;
+        nanosleep(&delay, NULL);
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    if (ticks) {
+        block(PROC_SLEEPING, NULL, ticks);
+    } else {
+        // lets the other ready processes of the same priority run
+        current->state = PROC_READY;
+        current->order = ++order;
+        reschedule(current);
+    }
+    pthread_mutex_unlock(&osLock);
+}
+
+void osSuspend(void) {
+    pthread_mutex_lock(&osLock);
+    block(PROC_SUSPENDED, NULL, 0);
+    pthread_mutex_unlock(&osLock);
+}
+
+void osResume(tU8 pid, tU8 *pError) {
+    if (pid >= MAX_NUM_PROC) {
+        *pError = OS_ERROR_PID;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    if (PROC_SUSPENDED == processes[pid].state) {
+        wakeUp(&processes[pid]);
+        preemptionPoint();
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
+
+tU8 osStackUsage(tU8 pid) {
+    // the processes run on the stacks of their threads
+    return 0;
+}
+
+/*****************************************************************************
+ * Semaphores
+ ****************************************************************************/
+
+void osSemInit(tCntSem *pSem, tU16 initial) {
+    memset(pSem, 0, sizeof(tCntSem));
+    pSem->cnt = initial;
+}
+
+tBool osSemTake(tCntSem *pSem, tU32 timeout, tU8 *pError) {
+    tBool taken = TRUE;
+
+    if (!pSem) {
+        *pError = OS_ERROR_NULL;
+        return FALSE;
+    }
+    if (!current) {
+        *pError = OS_ERROR_ISR;
+        return FALSE;
+    }
+
+    pthread_mutex_lock(&osLock);
+    preemptionPoint();
+    if (pSem->cnt > 0) {
+        pSem->cnt--;
+    } else {
+        block(PROC_WAITING, pSem, timeout);
+        taken = !current->timedOut;
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = taken ? OS_OK : OS_ERROR_TIMEOUT;
+    return taken;
+}
+
+void osSemGive(tCntSem *pSem, tU8 *pError) {
+    Process *waiter;
+
+    if (!pSem) {
+        *pError = OS_ERROR_NULL;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    waiter = firstWaiter(pSem);
+    if (waiter) {
+        waiter->waitObject = NULL;
+        wakeUp(waiter);
+    } else {
+        pSem->cnt++;
+    }
+    preemptionPoint();
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
+
+tU8 osSemTryTake(tCntSem *pSem, tU8 *pError) {
+    tU8 result = 1;
+
+    if (!pSem) {
+        *pError = OS_ERROR_NULL;
+        return 1;
+    }
+
+    pthread_mutex_lock(&osLock);
+    if (pSem->cnt > 0) {
+        pSem->cnt--;
+        result = 0;
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+    return result;
+}
+
+/*****************************************************************************
+ * Queues
+ ****************************************************************************/
+
+void osCreateQueue(tQueue *pQueue, void **pQueueArea, tU16 size) {
+    memset(pQueue, 0, sizeof(tQueue));
+    pQueue->pQStart = pQueueArea;
+    pQueue->pQEnd = pQueueArea + size;
+    pQueue->pQIn = pQueueArea;
+    pQueue->pQOut = pQueueArea;
+    pQueue->queueSize = size;
+}
+
+// takes the first message, the queue can not be empty
+static void *takeMessage(tQueue *pQueue) {
+    void *msg = *pQueue->pQOut;
+
+    if (++pQueue->pQOut == pQueue->pQEnd) {
+        pQueue->pQOut = pQueue->pQStart;
+    }
+    pQueue->nEntries--;
+    return msg;
+}
+
+void *osPendQueue(tQueue *pQueue, tU16 timeout, tU8 *pError) {
+    void *msg;
+
+    if (!pQueue) {
+        *pError = OS_ERROR_NULL;
+        return NULL;
+    }
+    if (!current) {
+        *pError = OS_ERROR_ISR;
+        return NULL;
+    }
+
+    pthread_mutex_lock(&osLock);
+    preemptionPoint();
+    if (pQueue->nEntries > 0) {
+        msg = takeMessage(pQueue);
+    } else {
+        block(PROC_WAITING, pQueue, timeout);
+        msg = current->message;
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = msg ? OS_OK : OS_ERROR_TIMEOUT;
+    return msg;
+}
+
+void *osAcceptQueue(tQueue *pQueue, tU8 *pError) {
+    void *msg = NULL;
+
+    if (!pQueue) {
+        *pError = OS_ERROR_NULL;
+        return NULL;
+    }
+
+    pthread_mutex_lock(&osLock);
+    if (pQueue->nEntries > 0) {
+        msg = takeMessage(pQueue);
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+    return msg;
+}
+
+void osFlushQueue(tQueue *pQueue, tU8 *pError) {
+    if (!pQueue) {
+        *pError = OS_ERROR_NULL;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    pQueue->pQIn = pQueue->pQStart;
+    pQueue->pQOut = pQueue->pQStart;
+    pQueue->nEntries = 0;
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
+
+// posts a message to the back or the front of the queue
+static void postMessage(tQueue *pQueue, void *msg, tBool front, tU8 *pError) {
+    Process *waiter;
+
+    if (!pQueue) {
+        *pError = OS_ERROR_NULL;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    *pError = OS_OK;
+    waiter = firstWaiter(pQueue);
+    if (waiter) {
+        // a waiting process means an empty queue, the message is handed over
+        waiter->message = msg;
+        waiter->waitObject = NULL;
+        wakeUp(waiter);
+    } else if (pQueue->nEntries == pQueue->queueSize) {
+        *pError = OS_ERROR_QUEUE_FULL;
+    } else if (front) {
+        if (pQueue->pQOut == pQueue->pQStart) {
+            pQueue->pQOut = pQueue->pQEnd;
+        }
+        *--pQueue->pQOut = msg;
+        pQueue->nEntries++;
+    } else {
+        *pQueue->pQIn = msg;
+        if (++pQueue->pQIn == pQueue->pQEnd) {
+            pQueue->pQIn = pQueue->pQStart;
+        }
+        pQueue->nEntries++;
+    }
+    preemptionPoint();
+    pthread_mutex_unlock(&osLock);
+}
+
+void osPostQueue(tQueue *pQueue, void *msg, tU8 *pError) {
+    postMessage(pQueue, msg, FALSE, pError);
+}
+
+void osPostFrontQueue(tQueue *pQueue, void *msg, tU8 *pError) {
+    postMessage(pQueue, msg, TRUE, pError);
+}
+
+/*****************************************************************************
+ * Timers
+ ****************************************************************************/
+
+void osInitTimers(tU8 *pError) {
+    tU8 pid;
+
+    osSemInit(&timerSem, 0);
+    osCreateProcess(timerProcess, NULL, 0, &pid, 0, NULL, pError);
+    if (OS_OK == *pError) {
+        osStartProcess(pid, pError);
+    }
+}
+
+void osCreateTimer(tTimer *pTimer, void (*callback)(void), tBool repeat, tU32 time) {
+    pthread_mutex_lock(&osLock);
+    pTimer->callback = callback;
+    pTimer->repeat = repeat;
+    pTimer->time = time ? time : 1;
+    pTimer->delta = pTimer->time;
+    pTimer->next = timers;
+    timers = pTimer;
+    pthread_mutex_unlock(&osLock);
+}
+
+void osDeleteTimer(tTimer *pTimer, tU8 *pError) {
+    tTimer **link;
+
+    if (!pTimer) {
+        *pError = OS_ERROR_NULL;
+        return;
+    }
+
+    pthread_mutex_lock(&osLock);
+    for (link = &timers; *link; link = &(*link)->next) {
+        if (pTimer == *link) {
+            *link = pTimer->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&osLock);
+
+    *pError = OS_OK;
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *
+ * File:
+ *    osapi_posix.h
+ *
+ * Description:
+ *    Host extensions of the pre_emptive_os API implemented on POSIX threads
+ *    by osapi_posix.c. The rest of the API is declared in osapi.h.
+ *
+ *****************************************************************************/
+
+#ifndef _OSAPI_POSIX_H_
+#define _OSAPI_POSIX_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/osapi.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// length of a system tick passed to appTick(), like osstub.h of the firmware
+#define OS_TICK_MS          10
+
+/*************/
+/* Functions */
+/*************/
+
+// sets the real time between ticks generated after osStart(), 0 stops
+// the tick thread so ticks only come from calls to osTick()
+void osSetTickPeriod(tU32 microseconds);
+
+// number of ticks since osStart()
+tU32 osTickCount(void);
+
+// interrupt state of the emulated processor, see m_os_dis_int() in osapi.h
+tU32 halDisableInterrupts_oshal(void);
+void halRestoreInterrupts_oshal(tU32 state);
+
+#endif
@@ -0,0 +1,236 @@
+/******************************************************************************
+ *
+ * File:
+ *    oslatency.c
+ *
+ * Description:
+ *    Measures the latencies of the pre_emptive_os API ported to POSIX
+ *    threads (osapi_posix.c): waking a process of higher priority with
+ *    a semaphore, a queue round trip between two processes and the
+ *    accuracy of osSleep() and of a repeating timer.
+ *
+ *    Usage: oslatency [-n iterations] [-t tick period in microseconds]
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "osapi_posix.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define PROC_STACK_SIZE 1024
+
+// priorities of the processes, 0 is taken by the timer process
+#define CONTROL_PRIO    4
+#define WAITER_PRIO     1
+#define ECHO_PRIO       2
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    const char *name;
+    tU32 count;
+    tU32 min;
+    tU32 max;
+    double sum;
+} Stats;
+
+/*************/
+/* Variables */
+/*************/
+
+static tU32 iterations = 100;
+
+static tU8 controlStack[PROC_STACK_SIZE];
+static tU8 waiterStack[PROC_STACK_SIZE];
+static tU8 echoStack[PROC_STACK_SIZE];
+static tU8 controlPid, waiterPid, echoPid;
+
+static tCntSem wakeSem;
+static tCntSem doneSem;
+static tCntSem timerSem;
+static volatile tU32 giveTime;
+
+static tQueue requestQueue, replyQueue;
+static void *requestArea[4], *replyArea[4];
+
+static tTimer timer;
+static volatile tU32 timerTime;
+
+static Stats semWake = { "semafor -> proces wyzszego priorytetu" };
+static Stats queueTrip = { "kolejka tam i z powrotem" };
+static Stats sleepTime = { "osSleep(1)" };
+static Stats timerPeriod = { "okres timera (1 tick)" };
+
+/*************/
+/* Functions */
+/*************/
+
+// monotonic time in microseconds
+static tU32 now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static void record(Stats *stats, tU32 value) {
+    if (!stats->count || value < stats->min) {
+        stats->min = value;
+    }
+    if (value > stats->max) {
+        stats->max = value;
+    }
+    stats->sum += value;
+    stats->count++;
+}
+
+static void report(const Stats *stats) {
+    if (!stats->count) {
+        printf("%-40s brak pomiarow\n", stats->name);
+        return;
+    }
+    printf("%-40s min %6u us  avg %9.1f us  max %6u us\n", stats->name,
+           stats->min, stats->sum / stats->count, stats->max);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Waits on the semaphore given by the control process, which has
+ *    a lower priority, so every give should switch processes at once.
+ *
+ ****************************************************************************/
+static void waiterProc(void *arg) {
+    tU8 error;
+
+    while (1) {
+        osSemTake(&wakeSem, 0, &error);
+        record(&semWake, now() - giveTime);
+        osSemGive(&doneSem, &error);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Answers every request posted to the request queue.
+ *
+ ****************************************************************************/
+static void echoProc(void *arg) {
+    tU8 error;
+    void *msg;
+
+    while (1) {
+        msg = osPendQueue(&requestQueue, 0, &error);
+        osPostQueue(&replyQueue, msg, &error);
+    }
+}
+
+static void timerCallback(void) {
+    tU8 error;
+
+    timerTime = now();
+    osSemGive(&timerSem, &error);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Runs the measurements one after another and prints the results.
+ *
+ ****************************************************************************/
+static void controlProc(void *arg) {
+    tU32 i, start, last;
+    tU8 error;
+
+    for (i = 0; i < iterations; ++i) {
+        giveTime = now();
+        osSemGive(&wakeSem, &error);
+        osSemTake(&doneSem, 0, &error);
+    }
+
+    for (i = 0; i < iterations; ++i) {
+        start = now();
+        osPostQueue(&requestQueue, (void *) (size_t) (i + 1), &error);
+        osPendQueue(&replyQueue, 0, &error);
+        record(&queueTrip, now() - start);
+    }
+
+    for (i = 0; i < iterations; ++i) {
+        start = now();
+        osSleep(1);
+        record(&sleepTime, now() - start);
+    }
+
+    osCreateTimer(&timer, timerCallback, TRUE, 1);
+    osSemTake(&timerSem, 0, &error);
+    last = timerTime;
+    for (i = 0; i < iterations; ++i) {
+        osSemTake(&timerSem, 0, &error);
+        record(&timerPeriod, timerTime - last);
+        last = timerTime;
+    }
+    osDeleteTimer(&timer, &error);
+
+    report(&semWake);
+    report(&queueTrip);
+    report(&sleepTime);
+    report(&timerPeriod);
+    exit(0);
+}
+
+int main(int argc, char **argv) {
+    tU32 tickPeriod = OS_TICK_MS * 1000;
+    tU8 error;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:t:")) != -1) {
+        switch (opt) {
+            case 'n':
+                iterations = atoi(optarg);
+                break;
+            case 't':
+                tickPeriod = atoi(optarg);
+                break;
+            default:
+                fprintf(stderr, "uzycie: %s [-n iteracje] [-t okres ticku w us]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (!tickPeriod) {
+        fprintf(stderr, "okres ticku musi byc wiekszy od zera\n");
+        return 1;
+    }
+
+    osInit();
+    osSetTickPeriod(tickPeriod);
+    osSemInit(&wakeSem, 0);
+    osSemInit(&doneSem, 0);
+    osSemInit(&timerSem, 0);
+    osCreateQueue(&requestQueue, requestArea, 4);
+    osCreateQueue(&replyQueue, replyArea, 4);
+
+    osCreateProcess(controlProc, controlStack, PROC_STACK_SIZE, &controlPid, CONTROL_PRIO, NULL, &error);
+    osStartProcess(controlPid, &error);
+    osCreateProcess(waiterProc, waiterStack, PROC_STACK_SIZE, &waiterPid, WAITER_PRIO, NULL, &error);
+    osStartProcess(waiterPid, &error);
+    osCreateProcess(echoProc, echoStack, PROC_STACK_SIZE, &echoPid, ECHO_PRIO, NULL, &error);
+    osStartProcess(echoPid, &error);
+    osInitTimers(&error);
+
+    printf("okres ticku %u us, %u iteracji\n", tickPeriod, iterations);
+    osStart();
+    return 0;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ *
+ * File:
+ *    pffbench.c
+ *
+ * Description:
+ *    Measures pf_mount(), pf_open() and pf_read() of pff.c on a card image
+ *    (diskimage.c): the number of disk_readp() requests of every phase,
+ *    how many of them read the FAT, and the modelled SPI traffic and time.
+ *    The default file and buffer size are the ones of readBoard() in sdcard.c.
+ *
+ *    Usage: pffbench [-f file] [-b buffer size] [-l response latency]
+ *                    [-t token latency] [-r] card.img
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "pff.h"
+#include "diskimage.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// the same as BOARD_BUFFER_SIZE in sdcard.c
+#define DEFAULT_BUFFER_SIZE 500
+#define MAX_BUFFER_SIZE     4096
+
+/*************/
+/* Variables */
+/*************/
+
+static FATFS fatfs;
+static tBool listRequests;
+static DiskStats total;
+static tU32 totalFatRequests;
+
+/*************/
+/* Functions */
+/*************/
+
+// TRUE if the sector belongs to the allocation table of the mounted file system
+static tBool isFatSector(tU32 sector) {
+    tU32 end = FS_FAT32 == fatfs.fs_type ? fatfs.database : fatfs.dirbase;
+    return fatfs.fs_type && sector >= fatfs.fatbase && sector < end;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Ends a phase: prints its requests and traffic.
+ *
+ ****************************************************************************/
+static void endPhase(const char *name, FRESULT result) {
+    const DiskRequest *requests;
+    DiskStats stats;
+    tU32 count, i, fatRequests = 0;
+
+    requests = diskImageRequests(&count);
+    for (i = 0; i < count; ++i) {
+        tBool fat = isFatSector(requests[i].sector);
+        fatRequests += fat;
+        if (listRequests) {
+            printf("      sektor %8u  offset %3u  bajtow %3u%s\n", requests[i].sector,
+                   requests[i].offset, requests[i].count, fat ? "  FAT" : "");
+        }
+    }
+    diskImageEndPhase(&stats);
+
+    printf("%-6s %3d %9u %5u %8u %9u %11.0f\n", name, result, stats.requests,
+           fatRequests, stats.bytes, stats.spiBytes, stats.spiMicroseconds);
+
+    total.requests += stats.requests;
+    total.bytes += stats.bytes;
+    total.spiBytes += stats.spiBytes;
+    total.spiMicroseconds += stats.spiMicroseconds;
+    totalFatRequests += fatRequests;
+}
+
+int main(int argc, char **argv) {
+    static tU8 buffer[MAX_BUFFER_SIZE];
+    const char *file = "board.txt";
+    int bufferSize = DEFAULT_BUFFER_SIZE;
+    int responseLatency = 1, tokenLatency = 1;
+    FRESULT result;
+    WORD bytesRead;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "f:b:l:t:r")) != -1) {
+        switch (opt) {
+            case 'f':
+                file = optarg;
+                break;
+            case 'b':
+                bufferSize = atoi(optarg);
+                break;
+            case 'l':
+                responseLatency = atoi(optarg);
+                break;
+            case 't':
+                tokenLatency = atoi(optarg);
+                break;
+            case 'r':
+                listRequests = TRUE;
+                break;
+            default:
+                optind = argc;
+                break;
+        }
+    }
+    if (optind != argc - 1 || bufferSize <= 0 || bufferSize > MAX_BUFFER_SIZE) {
+        fprintf(stderr, "uzycie: %s [-f plik] [-b bufor] [-l opoznienie odpowiedzi]"
+                " [-t opoznienie danych] [-r] obraz\n", argv[0]);
+        return 1;
+    }
+    if (!diskImageOpen(argv[optind])) {
+        fprintf(stderr, "nie mozna otworzyc %s\n", argv[optind]);
+        return 1;
+    }
+    diskImageSetLatency(responseLatency, tokenLatency);
+
+    printf("faza   wynik zadania   FAT   bajtow  bajty SPI  czas SPI us\n");
+
+    result = pf_mount(&fatfs);
+    endPhase("mount", result);
+    if (FR_OK != result) {
+        return 1;
+    }
+    printf("       FAT%d, %u sektorow na klaster\n",
+           FS_FAT12 == fatfs.fs_type ? 12 : FS_FAT16 == fatfs.fs_type ? 16 : 32, fatfs.csize);
+
+    result = pf_open(file);
+    endPhase("open", result);
+    if (FR_OK != result) {
+        return 1;
+    }
+
+    // reads the whole file with the buffer of the given size
+    do {
+        result = pf_read(buffer, bufferSize, &bytesRead);
+    } while (FR_OK == result && bytesRead == bufferSize);
+    endPhase("read", result);
+
+    printf("razem        %9u %5u %8u %9u %11.0f\n", total.requests, totalFatRequests,
+           total.bytes, total.spiBytes, total.spiMicroseconds);
+    return FR_OK != result;
+}
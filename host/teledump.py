@@ -0,0 +1,91 @@
+#!/usr/bin/python
+
+import sys
+import argparse as ap
+
+
+SYNC = 0xA5
+KEYFRAME = ord('K')
+DELTA = ord('D')
+
+SCORE_CHANGED = 0x01
+LIVES_CHANGED = 0x02
+TIME_CHANGED = 0x04
+
+STEPS = {0: (0, 0), 1: (-1, 0), 2: (1, 0), 3: (0, -1), 4: (0, 1)}
+TYPES = ['pacman', 'ghost', 'eatable', 'eyes']
+CHARACTERS = 5
+
+
+def frames(data):
+    """Yields (kind, sequence, payload) of every valid frame in the stream,
+    skipping any text and damaged frames in between."""
+    i = 0
+    while i + 5 <= len(data):
+        if data[i] != SYNC:
+            i += 1
+            continue
+        length = data[i + 3]
+        end = i + 4 + length
+        if end >= len(data):
+            break
+        if sum(data[i + 1:end]) & 0xff != data[end]:
+            i += 1
+            continue
+        yield data[i + 1], data[i + 2], data[i + 4:end]
+        i = end + 1
+
+
+def main():
+    parser = ap.ArgumentParser(
+        description='decodes a captured Pacman telemetry stream')
+    parser.add_argument('file', type=ap.FileType('rb'), nargs='?',
+                        default=sys.stdin.buffer,
+                        help='the captured stream (stdin by default)')
+    args = parser.parse_args()
+
+    state = None
+    expected = None
+    lost = 0
+
+    for kind, sequence, payload in frames(args.file.read()):
+        if expected is not None and sequence != expected:
+            lost += (sequence - expected) & 0xff
+        expected = (sequence + 1) & 0xff
+
+        if kind == KEYFRAME:
+            state = {
+                'score': int.from_bytes(payload[0:4], 'little'),
+                'lives': payload[4], 'time': payload[5],
+                'characters': [(payload[6 + 3 * c], payload[7 + 3 * c],
+                                payload[8 + 3 * c]) for c in range(CHARACTERS)]
+            }
+        elif kind == DELTA and state is not None:
+            flags = payload[0]
+            characters = []
+            for c in range(CHARACTERS):
+                code = payload[1 + c]
+                dx, dy = STEPS[code & 0x07]
+                _, x, y = state['characters'][c]
+                characters.append((code >> 3, x + dx, y + dy))
+            state['characters'] = characters
+            rest = list(payload[1 + CHARACTERS:])
+            if flags & SCORE_CHANGED:
+                state['score'] += rest.pop(0)
+            for flag, name in ((LIVES_CHANGED, 'lives'),
+                               (TIME_CHANGED, 'time')):
+                if flags & flag:
+                    state[name] = rest.pop(0)
+        else:
+            continue
+
+        print('{:3} {} score={} lives={} time={} {}'.format(
+            sequence, chr(kind), state['score'], state['lives'], state['time'],
+            ' '.join('{}@{},{}'.format(TYPES[t], x, y)
+                     for t, x, y in state['characters'])))
+
+    print('lost frames: {}'.format(lost), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
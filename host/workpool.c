@@ -0,0 +1,198 @@
+/******************************************************************************
+ *
+ * File:
+ *    workpool.c
+ *
+ * Description:
+ *    Work-stealing thread pool running a batch of independent jobs.
+ *    Every worker starts with an equal range of job indices and takes jobs
+ *    from its front. A worker that runs out of jobs steals the upper half
+ *    of the largest range left, so long jobs do not leave threads idle.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "workpool.h"
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    pthread_mutex_t lock;
+    tU32 next;
+    tU32 end;
+} WorkRange;
+
+typedef struct {
+    tU32 workers;
+    WorkRange *ranges;
+    void (*job)(tU32 worker, tU32 index, void *arg);
+    void *arg;
+} WorkPool;
+
+typedef struct {
+    WorkPool *pool;
+    tU32 worker;
+} WorkerArgs;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Takes the next job from the front of the worker's own range.
+ *
+ * Returns:
+ *    tBool - TRUE if a job was taken, FALSE if the range is empty
+ *
+ ****************************************************************************/
+static tBool takeJob(WorkRange *range, tU32 *index) {
+    tBool taken = FALSE;
+
+    pthread_mutex_lock(&range->lock);
+    if (range->next < range->end) {
+        *index = range->next++;
+        taken = TRUE;
+    }
+    pthread_mutex_unlock(&range->lock);
+
+    return taken;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Moves the upper half of the largest range of other workers
+ *    into the range of given worker.
+ *
+ * Returns:
+ *    tBool - TRUE if anything was stolen, FALSE if there is no work left
+ *
+ ****************************************************************************/
+static tBool stealJobs(WorkPool *pool, tU32 thief) {
+    while (1) {
+        tU32 i, victim = thief, largest = 0;
+
+        for (i = 0; i < pool->workers; ++i) {
+            WorkRange *range = &pool->ranges[i];
+            tU32 left;
+
+            if (i == thief) {
+                continue;
+            }
+            pthread_mutex_lock(&range->lock);
+            left = range->end - range->next;
+            pthread_mutex_unlock(&range->lock);
+
+            if (left > largest) {
+                largest = left;
+                victim = i;
+            }
+        }
+
+        if (0 == largest) {
+            return FALSE;
+        }
+
+        WorkRange *range = &pool->ranges[victim];
+        tU32 from, to;
+
+        pthread_mutex_lock(&range->lock);
+        to = range->end;
+        from = range->next + (range->end - range->next) / 2;
+        range->end = from;
+        pthread_mutex_unlock(&range->lock);
+
+        // the victim could have drained its range in the meantime
+        if (from < to) {
+            range = &pool->ranges[thief];
+            pthread_mutex_lock(&range->lock);
+            range->next = from;
+            range->end = to;
+            pthread_mutex_unlock(&range->lock);
+            return TRUE;
+        }
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Entry function of a worker thread.
+ *
+ ****************************************************************************/
+static void *workerThread(void *arg) {
+    WorkerArgs *args = arg;
+    WorkPool *pool = args->pool;
+    tU32 index;
+
+    do {
+        while (takeJob(&pool->ranges[args->worker], &index)) {
+            pool->job(args->worker, index, pool->arg);
+        }
+    } while (stealJobs(pool, args->worker));
+
+    return NULL;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Runs all jobs of the batch and waits until they are finished.
+ *
+ * Params:
+ *    [in] workers - number of threads
+ *    [in] jobs - number of jobs
+ *    [in] job - function executing a job with given index
+ *    [in] arg - argument passed to every job
+ *
+ ****************************************************************************/
+void runWorkPool(tU32 workers, tU32 jobs,
+                 void (*job)(tU32 worker, tU32 index, void *arg), void *arg) {
+    WorkPool pool;
+    WorkerArgs *args;
+    pthread_t *threads;
+    tU32 i;
+
+    if (0 == workers) {
+        workers = 1;
+    }
+
+    pool.workers = workers;
+    pool.job = job;
+    pool.arg = arg;
+    pool.ranges = calloc(workers, sizeof (WorkRange));
+    args = calloc(workers, sizeof (WorkerArgs));
+    threads = calloc(workers, sizeof (pthread_t));
+
+    for (i = 0; i < workers; ++i) {
+        pthread_mutex_init(&pool.ranges[i].lock, NULL);
+        pool.ranges[i].next = (tU32) ((unsigned long long) jobs * i / workers);
+        pool.ranges[i].end = (tU32) ((unsigned long long) jobs * (i + 1) / workers);
+        args[i].pool = &pool;
+        args[i].worker = i;
+    }
+
+    for (i = 0; i < workers; ++i) {
+        pthread_create(&threads[i], NULL, workerThread, &args[i]);
+    }
+    for (i = 0; i < workers; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < workers; ++i) {
+        pthread_mutex_destroy(&pool.ranges[i].lock);
+    }
+    free(threads);
+    free(args);
+    free(pool.ranges);
+}
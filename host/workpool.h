@@ -0,0 +1,29 @@
+/******************************************************************************
+ *
+ * File:
+ *    workpool.h
+ *
+ * Description:
+ *    Work-stealing thread pool running a batch of independent jobs.
+ *
+ *****************************************************************************/
+
+#ifndef _WORKPOOL_H_
+#define _WORKPOOL_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/*************/
+/* Functions */
+/*************/
+
+// runs job(worker, index, arg) for every index from 0 to jobs - 1
+// on the given number of worker threads and waits for all of them
+void runWorkPool(tU32 workers, tU32 jobs,
+                 void (*job)(tU32 worker, tU32 index, void *arg), void *arg);
+
+#endif
@@ -21,6 +21,9 @@
 /* Defines */
 /***********/
 
+// registers of the I2C interface, the host tools map them
+// to a simulated controller (host/i2csim.h)
+#ifndef I2C_CONSET
 #define I2C_CONSET (*((volatile unsigned char *) 0xE001C000))
 #define I2C_STAT   (*((volatile unsigned char *) 0xE001C004))
 #define I2C_DATA   (*((volatile unsigned char *) 0xE001C008))
@@ -28,6 +31,8 @@
 #define I2C_SCLH   (*((volatile unsigned short*) 0xE001C010))
 #define I2C_SCLL   (*((volatile unsigned short*) 0xE001C014))
 #define I2C_CONCLR (*((volatile unsigned char *) 0xE001C018))
+#define I2C_PINSEL PINSEL0
+#endif
 
 
 #define I2C_REG_CONSET      0x00000040 /* Control Set Register         */
@@ -105,15 +110,15 @@ tU8 i2cCheckStatus(void) {
  *
  *****************************************************************************/
 void i2cInit(void) {
-    PINSEL0 |= 0x50;
+    I2C_PINSEL |= 0x50;
 
     /* clear flags */
     I2C_CONCLR = 0x6c;
 
-    /* reset registers */
-    I2C_SCLL = (I2C_SCLL & ~I2C_REG_SCLL_MASK) | I2C_REG_SCLL;
-    I2C_SCLH = (I2C_SCLH & ~I2C_REG_SCLH_MASK) | I2C_REG_SCLH;
-    I2C_ADDR = (I2C_ADDR & ~I2C_REG_ADDR_MASK) | I2C_REG_ADDR;
+    /* reset registers, all their bits are used */
+    I2C_SCLL = I2C_REG_SCLL;
+    I2C_SCLH = I2C_REG_SCLH;
+    I2C_ADDR = I2C_REG_ADDR;
     I2C_CONSET = (I2C_CONSET & ~I2C_REG_CONSET_MASK) | I2C_REG_CONSET;
 }
 
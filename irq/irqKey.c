@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * File:
+ *    irqKey.c
+ *
+ * Description:
+ *    Joystick capture interrupt, that must be compiled in ARM code.
+ *
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "../pre_emptive_os/api/general.h"
+#include <lpc2xxx.h>
+#include "irqKey.h"
+#include "../key.h"
+
+/*****************************************************************************
+ * Implementation of public functions
+ ****************************************************************************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Timer #1 ISR that is called on a falling edge of a joystick line
+ *    routed to a capture input. The captured counter value is the exact
+ *    time of the press on the cycle clock.
+ *
+ ****************************************************************************/
+void
+keyCaptureISR(void)
+{
+  tU32 flags = T1IR & 0x30;
+
+  if (flags & 0x10)            //CAP1.0 = P0.10 = UP
+    keyEdge(KEY_UP, T1CR0);
+
+  if (flags & 0x20)            //CAP1.1 = P0.11 = RIGHT
+    keyEdge(KEY_RIGHT, T1CR1);
+
+  T1IR = flags;                //reset handled IRQ flags
+  VICVectAddr = 0x00000000;    //dummy write to VIC to signal end of interrupt
+}
@@ -0,0 +1,19 @@
+/******************************************************************************
+ *
+ * File:
+ *    irqKey.h
+ *
+ * Description:
+ *    Contains interface definitions for the joystick interrupt routine
+ *
+ *****************************************************************************/
+#ifndef _IRQKEY_H_
+#define _IRQKEY_H_
+
+/*****************************************************************************
+ * Public function prototypes
+ ****************************************************************************/
+void keyCaptureISR(void);
+
+
+#endif
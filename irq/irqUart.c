@@ -14,7 +14,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "../../pre_emptive_os/api/general.h"
+#include "../pre_emptive_os/api/general.h"
 #include <lpc2xxx.h>
 #include "irqUart.h"
 #include "../uart.h"
@@ -63,7 +63,10 @@ uart1ISR(void)
         if(tmpHead == uart1RxTail)
           tmpHead = U1RBR;              //dummy read to reset IRQ flag
         else
-          uart1RxBuf[tmpHead] = U1RBR;  //will reset IRQ flag
+        {
+          uart1RxBuf[tmpHead]  = U1RBR; //will reset IRQ flag
+          uart1RxTime[tmpHead] = T1TC;  //arrival time on the cycle clock
+        }
       } while (U1LSR & 0x01);
       break;
 
@@ -22,6 +22,7 @@ extern volatile tU32 uart1TxTail;
 extern volatile tU8  uart1TxRunning;
 
 extern tU8 uart1RxBuf[];
+extern tU32 uart1RxTime[];
 extern volatile tU32 uart1RxHead;
 extern volatile tU32 uart1RxTail;
 
@@ -5,7 +5,7 @@
  *
  *****************************************************************************/
 
-#include "../../pre_emptive_os/api/general.h"
+#include "../pre_emptive_os/api/general.h"
 #include <lpc2xxx.h>
 
 #define  SPI_CS   0x00008000  //<= new board, old board = 0x00800000
@@ -11,6 +11,13 @@
  *
  * Description:
  *    Implements sampling and handling of joystick key.
+ *    Joystick lines that have a capture function (UP on CAP1.0 and RIGHT
+ *    on CAP1.1) report presses from the timer #1 capture interrupt,
+ *    timestamped by the capture hardware. The other lines (CENTER, LEFT
+ *    and DOWN) have no interrupt-capable function free on this board and
+ *    are sampled on every OS tick. Debouncing of all lines is done
+ *    in the tick callback. CENTER and LEFT share P0.8 and P0.9 with
+ *    UART #1 and are not sampled while Bluetooth holds them.
  *
  *****************************************************************************/
 
@@ -18,37 +25,71 @@
 /* Includes */
 /************/
 
-#include "pre_emptive_os/api/osapi.h"
 #include "pre_emptive_os/api/general.h"
 #include "key.h"
+#include "clock.h"
 #include "lpc2xxx.h"
+#include "irq/irqKey.h"
 
 /***********/
 /* Defines */
 /***********/
 
-#define KEYPROC_STACK_SIZE 300
-
 #define KEYPIN_CENTER 0x00000100
 #define KEYPIN_UP     0x00000400
 #define KEYPIN_DOWN   0x00001000
 #define KEYPIN_LEFT   0x00000200 
 #define KEYPIN_RIGHT  0x00000800
 
+#define KEYPINS (KEYPIN_CENTER | KEYPIN_UP | KEYPIN_DOWN | KEYPIN_LEFT | KEYPIN_RIGHT)
+
+// PINSEL0 setting of P0.8 = TxD1 and P0.9 = RxD1 and the lines they take
+#define UART1_PINS      0x00050000
+#define UART1_PINS_MASK 0x000f0000
+#define UART1_KEYPINS   (KEYPIN_CENTER | KEYPIN_LEFT)
+
+// number of ticks a key has to stay released before the next press is accepted
+#define KEY_DEBOUNCE_TICKS 2
+
+// timer #1 interrupt channel in VIC
+#define VIC_TIMER1 5
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 key;
+    tU32 pin;
+    tU8 captured;           // TRUE if presses come from the capture interrupt
+    volatile tU8 released;
+    tU8 releasedTicks;
+} KeyLine;
+
 /*************/
 /* Variables */
 /*************/
 
-static tU8 centerReleased = TRUE;
-static tU8 keyUpReleased = TRUE;
-static tU8 keyDownReleased = TRUE;
-static tU8 keyLeftReleased = TRUE;
-static tU8 keyRightReleased = TRUE;
+static KeyLine keyLines[] = {
+    {KEY_CENTER, KEYPIN_CENTER, FALSE, TRUE, 0},
+    {KEY_UP,     KEYPIN_UP,     TRUE,  TRUE, 0},
+    {KEY_DOWN,   KEYPIN_DOWN,   FALSE, TRUE, 0},
+    {KEY_LEFT,   KEYPIN_LEFT,   FALSE, TRUE, 0},
+    {KEY_RIGHT,  KEYPIN_RIGHT,  TRUE,  TRUE, 0}
+};
 
-static volatile tU8 activeKey = KEY_NOTHING;
+#define KEY_LINES (sizeof (keyLines) / sizeof (keyLines[0]))
 
-static tU8 keyProcStack[KEYPROC_STACK_SIZE];
-static tU8 keyProcPid;
+// Single-producer/single-consumer queue of key presses.
+// Presses are pushed only from interrupt context (the capture interrupt
+// and the tick callback, which do not nest) and only the reader writes
+// eventsTail, so no locking is needed. Both indices are single bytes,
+// which are stored atomically, and the event is written before the head
+// is advanced.
+static KeyEvent events[KEY_EVENTS_SIZE];
+static volatile tU8 eventsHead = 0;
+static volatile tU8 eventsTail = 0;
+static volatile tU32 droppedEvents = 0;
 
 /*************/
 /* Functions */
@@ -75,114 +116,178 @@ tU8 getKeys(void) {
 /*****************************************************************************
  *
  * Description:
- *    Function to check if any key press has been detected
+ *    Adds a key press to the event queue. Called only by the producer.
+ *    The press is dropped and counted if the queue is full.
+ *
+ * Params:
+ *    [in] key - pressed key
+ *    [in] timestamp - cycle clock value of the press
  *
  ****************************************************************************/
-tU8 checkKey(void) {
-    tU8 retVal = activeKey;
-    activeKey = KEY_NOTHING;
-    return retVal;
+static void pushKeyEvent(tU8 key, tU32 timestamp) {
+    tU8 head = eventsHead;
+
+    if ((tU8) (head - eventsTail) >= KEY_EVENTS_SIZE) {
+        droppedEvents++;
+        return;
+    }
+
+    events[head & (KEY_EVENTS_SIZE - 1)].key = key;
+    events[head & (KEY_EVENTS_SIZE - 1)].timestamp = timestamp;
+    eventsHead = head + 1;
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Function to check pressed key
+ *    Takes pending key presses from the event queue, oldest first.
+ *    Must be called from one process only.
+ *
+ * Params:
+ *    [out] buffer - buffer for the key events
+ *    [in] maxEvents - capacity of the buffer
+ *
+ * Returns:
+ *    tU8 - number of events taken
  *
  ****************************************************************************/
-void checkKeyStatus(tU8 key, tU8 *keyReleased) {
-    if (*keyReleased == TRUE) {
-        *keyReleased = FALSE;
-        activeKey = key;
+tU8 pollKeyEvents(KeyEvent *buffer, tU8 maxEvents) {
+    tU8 tail = eventsTail;
+    tU8 count = 0;
+
+    while (count < maxEvents && tail != eventsHead) {
+        buffer[count++] = events[tail & (KEY_EVENTS_SIZE - 1)];
+        tail++;
     }
+    eventsTail = tail;
+
+    return count;
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Sample key states
+ *    Gets the number of key presses lost because the queue was full
  *
  ****************************************************************************/
-void sampleKey(void) {
-
-    tBool nothing = TRUE;
-    tU8 readKeys;
-
-    // get sample
-    readKeys = getKeys();
+tU32 getDroppedKeyEvents(void) {
+    return droppedEvents;
+}
 
-    // check center key
-    if (readKeys & KEY_CENTER) {
-        nothing = FALSE;
-        checkKeyStatus(KEY_CENTER, &centerReleased);
-    } else {
-        centerReleased = TRUE;
-    }
+/*****************************************************************************
+ *
+ * Description:
+ *    Function to check if any key press has been detected.
+ *    Takes the oldest key press from the event queue.
+ *
+ ****************************************************************************/
+tU8 checkKey(void) {
+    KeyEvent event;
 
-    // check up key
-    if (readKeys & KEY_UP) {
-        nothing = FALSE;
-        checkKeyStatus(KEY_UP, &keyUpReleased);
-    } else {
-        keyUpReleased = TRUE;
+    if (pollKeyEvents(&event, 1)) {
+        return event.key;
     }
+    return KEY_NOTHING;
+}
 
-    // check down key
-    if (readKeys & KEY_DOWN) {
-        nothing = FALSE;
-        checkKeyStatus(KEY_DOWN, &keyDownReleased);
-    } else {
-        keyDownReleased = TRUE;
+/*****************************************************************************
+ *
+ * Description:
+ *    Accepts a press of given line if the line was released long enough.
+ *    Bounces of the contacts are ignored until the line is released again.
+ *
+ * Params:
+ *    [in] line - pressed joystick line
+ *    [in] timestamp - cycle clock value of the press
+ *
+ ****************************************************************************/
+static void acceptPress(KeyLine *line, tU32 timestamp) {
+    line->releasedTicks = 0;
+    if (TRUE == line->released) {
+        line->released = FALSE;
+        pushKeyEvent(line->key, timestamp);
     }
+}
 
-    // check left key
-    if (readKeys & KEY_LEFT) {
-        nothing = FALSE;
-        checkKeyStatus(KEY_LEFT, &keyLeftReleased);
-    } else {
-        keyLeftReleased = TRUE;
-    }
+/*****************************************************************************
+ *
+ * Description:
+ *    Called from the capture interrupt on a falling edge of a joystick line.
+ *
+ * Params:
+ *    [in] key - key of the line
+ *    [in] timestamp - captured cycle clock value of the edge
+ *
+ ****************************************************************************/
+void keyEdge(tU8 key, tU32 timestamp) {
+    tU8 i;
 
-    // check right key
-    if (readKeys & KEY_RIGHT) {
-        nothing = FALSE;
-        checkKeyStatus(KEY_RIGHT, &keyRightReleased);
-    } else {
-        keyRightReleased = TRUE;
+    for (i = 0; i < KEY_LINES; ++i) {
+        if (keyLines[i].key == key) {
+            acceptPress(&keyLines[i], timestamp);
+            return;
+        }
     }
 }
 
 /*****************************************************************************
  *
  * Description:
- *    A process entry function 
- *
- * Params:
- *    [in] arg - This parameter is not used in this application. 
+ *    Samples all joystick lines, called once for each OS tick from appTick().
+ *    Reports presses of lines without capture interrupt and re-arms lines
+ *    that were released for KEY_DEBOUNCE_TICKS ticks.
  *
  ****************************************************************************/
-static void procKey(void *arg) {
+void keyTick(void) {
+    tU32 pins = IOPIN;
+    tU32 ignored = 0;
+    tU8 i;
 
-    // make all key signals as inputs
-    IODIR &= ~(KEYPIN_CENTER | KEYPIN_UP | KEYPIN_DOWN | KEYPIN_LEFT | KEYPIN_RIGHT);
+    // the levels of the lines taken by UART #1 are the bits of its data
+    if (UART1_PINS == (PINSEL0 & UART1_PINS_MASK)) {
+        ignored = UART1_KEYPINS;
+    }
+
+    for (i = 0; i < KEY_LINES; ++i) {
+        KeyLine *line = &keyLines[i];
 
-    // sample keys each 50 ms
-    while (1) {
-        sampleKey();
-        osSleep(5);
+        if (line->pin & ignored) {
+            continue;
+        }
+        if (0 == (pins & line->pin)) {
+            if (line->captured) {
+                line->releasedTicks = 0;
+            } else {
+                acceptPress(line, CLOCK_NOW());
+            }
+        } else if (!line->released && ++line->releasedTicks >= KEY_DEBOUNCE_TICKS) {
+            line->released = TRUE;
+        }
     }
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Creates and starts the key sampling process. 
+ *    Configures the joystick lines and enables the capture interrupt.
+ *    Requires the cycle clock (timer #1) to be running, see initClock().
  *
  ****************************************************************************/
-void initKeyProc(void) {
+void initKeys(void) {
+
+    // make all key signals as inputs
+    IODIR &= ~KEYPINS;
+
+    // P0.10 = CAP1.0 (UP), P0.11 = CAP1.1 (RIGHT)
+    PINSEL0 = (PINSEL0 & ~0x00f00000) | 0x00a00000;
 
-    tU8 error;
+    // capture on falling edge (press) with interrupt on both inputs
+    T1IR  = 0x30;
+    T1CCR = (T1CCR & ~0x3f) | 0x36;
 
-    osCreateProcess(procKey, keyProcStack, KEYPROC_STACK_SIZE, &keyProcPid, 3, NULL, &error);
-    osStartProcess(keyProcPid, &error);
+    // initialize the interrupt vector
+    VICIntSelect &= ~(1 << VIC_TIMER1);
+    VICVectCntl6 = 0x20 | VIC_TIMER1;
+    VICVectAddr6 = (tU32) keyCaptureISR;
+    VICIntEnable |= (1 << VIC_TIMER1);
 }
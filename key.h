@@ -34,12 +34,29 @@
 #define KEY_LEFT    0x08
 #define KEY_CENTER  0x10
 
+// capacity of the key event queue, has to be a power of two
+#define KEY_EVENTS_SIZE 16
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 key;
+    tU32 timestamp;     // cycle clock value when the press was sampled
+} KeyEvent;
+
 /*************/
 /* Functions */
 /*************/
 
 tU8 checkKey(void);
+tU8 pollKeyEvents(KeyEvent *events, tU8 maxEvents);
+tU32 getDroppedKeyEvents(void);
+
+void keyEdge(tU8 key, tU32 timestamp);
+void keyTick(void);
 
-void initKeyProc(void);
+void initKeys(void);
 
 #endif
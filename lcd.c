@@ -39,21 +39,41 @@
 #define LCD_CMD_PASET     0x2B
 #define LCD_CMD_RAMWR     0x2C
 #define LCD_CMD_RGBSET    0x2D
+#define LCD_CMD_VSCRDEF   0x33
 #define LCD_CMD_MADCTL    0x36
+#define LCD_CMD_SEP       0x37
 #define LCD_CMD_COLMOD    0x3A
 
 #define MADCTL_HORIZ      0x48
 #define MADCTL_VERT       0x68
 
+// widest row of lcdBlit()
+#define LCD_BLIT_WIDTH    130
+
+// lines of the controller memory, the visible ones start at line 2
+#define LCD_RAM_LINES     132
+
 /*************/
 /* Variables */
 /*************/
 
+// levels of the RGBSET lookup table after reset
+const tU8 lcdDefaultPalette[LCD_PALETTE_SIZE] = {
+    0, 2, 4, 6, 9, 11, 13, 15,  // Red
+    0, 2, 4, 6, 9, 11, 13, 15,  // Green
+    0, 6, 10, 15                // Blue
+};
+
 static tU8 lcd_x;
 static tU8 lcd_y;
 static tU8 bkgColor;
 static tU8 textColor;
 static tU8 setcolmark;
+static tU8 blitRow[LCD_BLIT_WIDTH];
+
+// vertical scroll area of lcdScrollArea(), no area when scrollLines is 0
+static tU8 scrollTop;
+static tU8 scrollLines;
 
 /*************/
 /* Functions */
@@ -70,6 +90,8 @@ static void lcdWindowNoReset(tU8 xp, tU8 yp, tU8 xe, tU8 ye);
  *
  ****************************************************************************/
 void lcdInit(void) {
+    tU8 i;
+
     bkgColor = 0;
     textColor = 0;
 
@@ -100,26 +122,9 @@ void lcdInit(void) {
     lcdWrcmd(LCD_CMD_INVON); // Non Invert mode
 
     lcdWrcmd(LCD_CMD_RGBSET); // LUT write
-    lcdWrdata(0); // Red
-    lcdWrdata(2);
-    lcdWrdata(4);
-    lcdWrdata(6);
-    lcdWrdata(9);
-    lcdWrdata(11);
-    lcdWrdata(13);
-    lcdWrdata(15);
-    lcdWrdata(0); // Green
-    lcdWrdata(2);
-    lcdWrdata(4);
-    lcdWrdata(6);
-    lcdWrdata(9);
-    lcdWrdata(11);
-    lcdWrdata(13);
-    lcdWrdata(15);
-    lcdWrdata(0); // Blue
-    lcdWrdata(6);
-    lcdWrdata(10);
-    lcdWrdata(15);
+    for (i = 0; i < LCD_PALETTE_SIZE; i++) {
+        lcdWrdata(lcdDefaultPalette[i]);
+    }
 
     // deselect controller
     selectLCD(FALSE);
@@ -187,16 +192,104 @@ void lcdContrast(tU8 cont) {
     selectLCD(FALSE);
 }
 
+/*****************************************************************************
+ *
+ * Description:
+ *    Rewrite the RGBSET lookup table, which maps the 3 bits of red,
+ *    3 bits of green and 2 bits of blue of a color to the 4-bit levels
+ *    of the display. Changes the colors of the whole screen at once.
+ *
+ ****************************************************************************/
+void lcdPalette(const tU8 *levels) {
+    tU8 i;
+
+    //select controller
+    selectLCD(TRUE);
+
+    lcdWrcmd(LCD_CMD_RGBSET); // LUT write
+    for (i = 0; i < LCD_PALETTE_SIZE; i++) {
+        lcdWrdata(levels[i]);
+    }
+
+    //deselect controller
+    selectLCD(FALSE);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Define the vertical scroll area: yLen lines from line y scroll,
+ *    the lines above and below it stay. 0 lines end scrolling.
+ *    The area starts unscrolled.
+ *
+ ****************************************************************************/
+void lcdScrollArea(tU8 y, tU8 yLen) {
+
+    scrollTop = y;
+    scrollLines = yLen;
+
+    //select controller
+    selectLCD(TRUE);
+
+    lcdWrcmd(LCD_CMD_VSCRDEF); // top fixed, scrolled and bottom fixed lines
+    if (yLen) {
+        lcdWrdata(y + 2);
+        lcdWrdata(yLen);
+        lcdWrdata(LCD_RAM_LINES - y - 2 - yLen);
+    } else {
+        lcdWrdata(0);
+        lcdWrdata(LCD_RAM_LINES);
+        lcdWrdata(0);
+    }
+    lcdWrcmd(LCD_CMD_SEP); // line shown at the top of the area
+    lcdWrdata(yLen ? y + 2 : 0);
+
+    //deselect controller
+    selectLCD(FALSE);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Scroll the area of lcdScrollArea(): its first line shows the line
+ *    at given offset from its top, the lines above the offset follow
+ *    at its bottom. Nothing is redrawn.
+ *
+ ****************************************************************************/
+void lcdScroll(tU8 offset) {
+
+    //select controller
+    selectLCD(TRUE);
+
+    lcdWrcmd(LCD_CMD_SEP); // line shown at the top of the area
+    lcdWrdata(scrollTop + 2 + offset);
+
+    //deselect controller
+    selectLCD(FALSE);
+}
+
 /*****************************************************************************
  *
  * Description:
  *    Draw a rectangular area with specified color.
+ *    Within the scroll area lines are counted in the memory of the
+ *    controller: a rectangle reaching below the area continues at its top.
  *
  ****************************************************************************/
 void lcdRect(tU8 x, tU8 y, tU8 xLen, tU8 yLen, tU8 color) {
 
     tU32 i;
     tU32 len;
+    tU8 wrapped = 0;
+
+    // lines below the scroll area are the ones at its top
+    if (scrollLines && y >= scrollTop + scrollLines) {
+        y -= scrollLines;
+    }
+    if (scrollLines && y >= scrollTop && y + yLen > scrollTop + scrollLines) {
+        wrapped = y + yLen - scrollTop - scrollLines;
+        yLen -= wrapped;
+    }
 
     //select controller
     selectLCD(TRUE);
@@ -212,6 +305,40 @@ void lcdRect(tU8 x, tU8 y, tU8 xLen, tU8 yLen, tU8 color) {
 
     //deselect controller
     selectLCD(FALSE);
+
+    if (wrapped) {
+        lcdRect(x, scrollTop, xLen, wrapped, color);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Draw a rectangular area in a single window, row after row. The pixels
+ *    of each row are generated by the given function right before they
+ *    are sent, so no frame buffer is needed. At most 130 pixels per row.
+ *
+ ****************************************************************************/
+void lcdBlit(tU8 x, tU8 y, tU8 xLen, tU8 yLen,
+             void (*getRow)(tU8 row, tU8 *pixels, const void *context), const void *context) {
+    tU8 row, i;
+
+    //select controller
+    selectLCD(TRUE);
+
+    lcdWindowNoReset(x, y, x + xLen - 1, y + yLen - 1);
+
+    lcdWrcmd(LCD_CMD_RAMWR); // write memory
+
+    for (row = 0; row < yLen; row++) {
+        getRow(row, blitRow, context);
+        for (i = 0; i < xLen; i++) {
+            lcdWrdata(blitRow[i]);
+        }
+    }
+
+    //deselect controller
+    selectLCD(FALSE);
 }
 
 /*****************************************************************************
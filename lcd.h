@@ -16,6 +16,28 @@
 #ifndef _LCD_H_
 #define _LCD_H_
 
+/************/
+/* Includes */
+/************/
+
+#include "fastcode.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// entries of the RGBSET lookup table: 8 levels of red, 8 of green, 4 of blue
+#define LCD_PALETTE_RED     0
+#define LCD_PALETTE_GREEN   8
+#define LCD_PALETTE_BLUE    16
+#define LCD_PALETTE_SIZE    20
+
+/********************/
+/* Extern variables */
+/********************/
+
+extern const tU8 lcdDefaultPalette[LCD_PALETTE_SIZE];
+
 /*************/
 /* Functions */
 /*************/
@@ -23,16 +45,21 @@
 void lcdInit(void);
 void lcdOff(void);
 void lcdContrast(tU8 contr);
-void lcdClrscr(void);
+FASTCODE void lcdClrscr(void);
 void lcdPutchar(tU8 data);
 void lcdPuts(char s[]);
 void lcdGotoxy(tU8 x, tU8 y);
 void lcdWindow(tU8 xp, tU8 yp, tU8 xe, tU8 ye);
 void lcdColor(tU8 bkg, tU8 text);
-void lcdRect(tU8 x, tU8 y, tU8 xLen, tU8 yLen, tU8 color);
+void lcdPalette(const tU8 *levels);
+void lcdScrollArea(tU8 y, tU8 yLen);
+void lcdScroll(tU8 offset);
+FASTCODE void lcdRect(tU8 x, tU8 y, tU8 xLen, tU8 yLen, tU8 color);
+FASTCODE void lcdBlit(tU8 x, tU8 y, tU8 xLen, tU8 yLen,
+                      void (*getRow)(tU8 row, tU8 *pixels, const void *context), const void *context);
 void lcdIcon(tU8 x, tU8 y, tU8 xLen, tU8 yLen, tU8 compressionOn, tU8 escapeChar, const tU8* pData);
 
-void lcdWrdata(tU8 data);
-void lcdWrcmd(tU8 cmd);
+FASTCODE void lcdWrdata(tU8 data);
+FASTCODE void lcdWrcmd(tU8 cmd);
 
 #endif
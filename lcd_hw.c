@@ -22,6 +22,7 @@
 #include "pre_emptive_os/api/general.h"
 #include "lpc2xxx.h"
 #include "lcd_hw.h"
+#include "spibus.h"
 
 /*************/
 /* Functions */
@@ -30,7 +31,9 @@
 /*****************************************************************************
  *
  * Description:
- *    Send 9-bit data to LCD controller
+ *    Send 9-bit data to LCD controller. The first bit is clocked out
+ *    with the pins as GPIO, the mode of the SPI controller stays as set
+ *    by the bus manager.
  *
  ****************************************************************************/
 void sendToLCD(tU8 firstBit, tU8 data) {
@@ -51,14 +54,7 @@ void sendToLCD(tU8 firstBit, tU8 data) {
     // set clock low
     IOCLR = LCD_CLK;
 
-    /*
-     * Enable SPI again
-     */
-    // initialize SPI interface
-    SPI_SPCCR = 0x08;
-    SPI_SPCR = 0x20;
-
-    // connect SPI bus to IO-pins
+    // connect SPI bus to IO-pins again
     PINSEL0 |= 0x00001500;
 
     // send byte
@@ -69,7 +65,8 @@ void sendToLCD(tU8 firstBit, tU8 data) {
 /*****************************************************************************
  *
  * Description:
- *    Initialize the SPI interface for the LCD controller
+ *    Initialize the pins of the LCD controller, the SPI interface
+ *    itself is configured by the bus manager
  *
  ****************************************************************************/
 void initSpiForLcd(void) {
@@ -77,26 +74,22 @@ void initSpiForLcd(void) {
     IODIR |= (LCD_CS | LCD_CLK | LCD_MOSI);
 
     // deselect controller
-    selectLCD(FALSE);
-
-    // connect SPI bus to IO-pins
-    PINSEL0 |= 0x00001500;
-
-    // initialize SPI interface
-    SPI_SPCCR = 0x08;
-    SPI_SPCR = 0x20;
+    IOSET = LCD_CS;
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Select/deselect LCD controller (by controlling chip select signal)
+ *    Select/deselect LCD controller (by controlling chip select signal).
+ *    The controller owns the SPI bus while it is selected.
  *
  ****************************************************************************/
 void selectLCD(tBool select) {
     if (TRUE == select) {
+        spiBusAcquire(SPI_BUS_LCD);
         IOCLR = LCD_CS;
     } else {
         IOSET = LCD_CS;
+        spiBusRelease();
     }
 }
@@ -22,6 +22,7 @@
 
 #include "pre_emptive_os/api/general.h"
 #include "startup/lpc2xxx.h"
+#include "fastcode.h"
 
 /***********/
 /* Defines */
@@ -35,7 +36,7 @@
 /* Functions */
 /*************/
 
-void sendToLCD(tU8 firstBit, tU8 data);
+FASTCODE void sendToLCD(tU8 firstBit, tU8 data);
 void initSpiForLcd(void);
 void selectLCD(tBool select);
 
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * File:
+ *    log.c
+ *
+ * Description:
+ *    Output of the log events, either as formatted text
+ *    or as binary trace records.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "log.h"
+#include "startup/consol.h"
+
+/*************/
+/* Variables */
+/*************/
+
+#if !LOG_BINARY
+
+#define LOG_EVENT_FORMAT(id, format)    format,
+
+const char * const logFormats[LOG_EVENT_COUNT] = {
+    LOG_EVENTS(LOG_EVENT_FORMAT)
+};
+
+#undef LOG_EVENT_FORMAT
+
+#endif
+
+/*************/
+/* Functions */
+/*************/
+
+#if LOG_BINARY
+/*****************************************************************************
+ *
+ * Description:
+ *    Sends a binary trace record of the event to the consol.
+ *    The record is queued whole or not at all.
+ *    Record: sync, id, argc, argc * 4 bytes of arguments (little endian).
+ *
+ * Params:
+ *    [in] id   - id of the event
+ *    [in] argc - number of arguments, at most LOG_MAX_ARGS
+ *    [in] args - arguments of the event
+ *
+ ****************************************************************************/
+void logTrace(LogEvent id, tU8 argc, const int *args) {
+    unsigned char record[3 + 4 * LOG_MAX_ARGS];
+    unsigned int length = 0;
+    tU8 i;
+
+    if (argc > LOG_MAX_ARGS) {
+        argc = LOG_MAX_ARGS;
+    }
+
+    record[length++] = LOG_SYNC;
+    record[length++] = id;
+    record[length++] = argc;
+    for (i = 0; i < argc; ++i) {
+        tU32 arg = args[i];
+        record[length++] = arg;
+        record[length++] = arg >> 8;
+        record[length++] = arg >> 16;
+        record[length++] = arg >> 24;
+    }
+
+#if (UART_API_NONBLOCKING == 1)
+    consolQueueBytes(record, length);
+#else
+    for (i = 0; i < length; ++i) {
+        consolSendChar(record[i]);
+    }
+#endif
+}
+#endif
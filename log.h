@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * File:
+ *    log.h
+ *
+ * Description:
+ *    Logging macros filtered at compile time. Calls below LOG_LEVEL are
+ *    removed by the preprocessor together with their arguments.
+ *    With LOG_BINARY set the messages are not formatted on the device,
+ *    only (event id, arguments) records are sent to the consol
+ *    and decoded on the host by host/logdecode.py.
+ *
+ *****************************************************************************/
+
+#ifndef _LOG_H_
+#define _LOG_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "logevents.h"
+#include "startup/printf_P.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+// most detailed level compiled in, set to LOG_LEVEL_NONE for release builds
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// set to 1 to send binary trace records instead of formatted text
+#ifndef LOG_BINARY
+#define LOG_BINARY 0
+#endif
+
+// first byte of every binary trace record
+#define LOG_SYNC            0xA7
+
+// maximum number of arguments of a binary trace record
+#define LOG_MAX_ARGS        4
+
+#if LOG_BINARY
+
+// number of arguments passed to the macro
+#define LOG_ARGC(args...)   (sizeof((int[]){0, ## args}) / sizeof(int) - 1)
+
+#define LOG_EMIT(id, args...) \
+    logTrace(id, LOG_ARGC(args), (const int[]){0, ## args} + 1)
+
+#else
+
+#define LOG_EMIT(id, args...)   printf(logFormats[id], ## args)
+
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(id, args...)  LOG_EMIT(id, ## args)
+#else
+#define LOG_ERROR(id, args...)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(id, args...)   LOG_EMIT(id, ## args)
+#else
+#define LOG_WARN(id, args...)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(id, args...)   LOG_EMIT(id, ## args)
+#else
+#define LOG_INFO(id, args...)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(id, args...)  LOG_EMIT(id, ## args)
+#else
+#define LOG_DEBUG(id, args...)
+#endif
+
+/*********/
+/* Types */
+/*********/
+
+#define LOG_EVENT_ID(id, format)    id,
+
+typedef enum {
+    LOG_EVENTS(LOG_EVENT_ID)
+    LOG_EVENT_COUNT
+} LogEvent;
+
+#undef LOG_EVENT_ID
+
+/*************/
+/* Variables */
+/*************/
+
+#if !LOG_BINARY
+extern const char * const logFormats[LOG_EVENT_COUNT];
+#endif
+
+/*************/
+/* Functions */
+/*************/
+
+#if LOG_BINARY
+/*****************************************************************************
+ *
+ * Description:
+ *    Sends a binary trace record of the event to the consol.
+ *    The record is queued whole or not at all.
+ *
+ * Params:
+ *    [in] id   - id of the event
+ *    [in] argc - number of arguments, at most LOG_MAX_ARGS
+ *    [in] args - arguments of the event
+ *
+ ****************************************************************************/
+void logTrace(LogEvent id, tU8 argc, const int *args);
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/******************************************************************************
+ *
+ * File:
+ *    logevents.h
+ *
+ * Description:
+ *    Table of all log events of the firmware. Every event has an id and
+ *    the format of its message. The ids are numbered in the order of the
+ *    table, so host/logdecode.py reads this file to decode binary traces.
+ *    New events should be added at the end to keep old traces readable.
+ *    The arguments of the events are integers, "%s" can't be traced.
+ *
+ *****************************************************************************/
+
+#ifndef _LOGEVENTS_H_
+#define _LOGEVENTS_H_
+
+/***********/
+/* Defines */
+/***********/
+
+#define LOG_EVENTS(X) \
+    X(LOG_TEMPERATURE,          "\nTemperature: %d.%d") \
+    X(LOG_BT_UART_READY,        "\nZainicjalizowalem UART1\n") \
+    X(LOG_BT_CONFIGURED,        "\nZakonczylem inicjalizacje\n") \
+    X(LOG_BT_NO_RESPONSE,       "\nNie otrzymalem odpowiedzi w kroku %d\n") \
+    X(LOG_BT_CONNECTED,         "\nOtrzymalem BTSTATE:4\n") \
+    X(LOG_BT_RESULT_REQUESTED,  "\nOtrzymalem prosbe o wynik gry\n") \
+    X(LOG_BT_RESULT_PENDING,    "\nCzekam na prosbe o wynik gry\n") \
+    X(LOG_REMOTE_PLAYER,        "Gracz %d: odebrane %u, odrzucone %u, przewidziane %u\n") \
+    X(LOG_PACMAN_INIT,          "InitPacman rozpoczete\n") \
+    X(LOG_PACMAN_BOARD_LOADED,  "Plansza wczytana do odpowiedniej tablicy\n") \
+    X(LOG_SD_MOUNT_ERROR,       "Blad interfejsu") \
+    X(LOG_SD_NO_FILESYSTEM,     "Nieprawidlowy system plikow lub jego brak na karcie pamieci") \
+    X(LOG_SD_OPENING,           "Proba otwarcia pliku z plansza.\n") \
+    X(LOG_SD_OPEN_FAILED,       "Nie udalo sie otworzyc pliku.\n") \
+    X(LOG_SD_NO_FILE,           "Nie ma takiego pliku\n") \
+    X(LOG_SD_FILESYSTEM_ERROR,  "Problem z systemem plikow\n") \
+    X(LOG_SD_READING,           "Proba odczytu z pliku z plansza.\n") \
+    X(LOG_SD_READ_DONE,         "Odczyt zakonczony\n") \
+    X(LOG_SD_READ_SHORT,        "Nie udalo sie odczytac wszystkich danych z pliku. Odczytano %d bajtow\n") \
+    X(LOG_SD_READ_ALL,          "Odczytano wszystkie dane z pliku.\n") \
+    X(LOG_SD_BOARD_STORED,      "Wprowadzono dane do tablicy.\n") \
+    X(LOG_SD_ARGUMENT,          "Argument out of bounds.\n") \
+    X(LOG_SD_ADDRESS,           "Address out of bounds.\n") \
+    X(LOG_SD_ERASE_SEQUENCE,    "Error during erase sequence.\n") \
+    X(LOG_SD_CRC,               "CRC failed.\n") \
+    X(LOG_SD_ILLEGAL_COMMAND,   "Illegal command.\n") \
+    X(LOG_SD_ERASE_RESET,       "Erase reset (see SanDisk docs p5-13).\n") \
+    X(LOG_SD_IDLE,              "Card is initialising.\n") \
+    X(LOG_SD_R1_UNKNOWN,        "Unknown error 0x%x (see SanDisk docs p5-13).\n") \
+    X(LOG_SD_LOCKED,            "Card is Locked.\n") \
+    X(LOG_SD_LOCK_FAILED,       "WP Erase Skip, Lock/Unlock Cmd Failed.\n") \
+    X(LOG_SD_GENERAL,           "General / Unknown error -- card broken?.\n") \
+    X(LOG_SD_CONTROLLER,        "Internal card controller error.\n") \
+    X(LOG_SD_ECC,               "Card internal ECC was applied, but failed to correct the data.\n") \
+    X(LOG_SD_WRITE_PROTECT,     "Write protect violation.\n") \
+    X(LOG_SD_ERASE_PARAM,       "An invalid selection, sectors for erase.\n") \
+    X(LOG_SD_OUT_OF_RANGE,      "Out of Range, CSD_Overwrite.\n") \
+    X(LOG_SD_R2_UNKNOWN,        "Unknown error: 0x%x (see SanDisk docs).\n") \
+    X(LOG_HIGHSCORE_LOADED,     "Wczytano rekordy, zapis %u w slocie %d\n") \
+    X(LOG_HIGHSCORE_WRITE_ERROR, "Nie udalo sie zapisac rekordow w slocie %d\n") \
+    X(LOG_RENDER_DROPPED,       "Pominiete klatki: %u z %u\n") \
+    X(LOG_LCD_CLEAR_TIME,       "Czyszczenie ekranu: %u us\n") \
+    X(LOG_SD_BOARD_SIZE,        "Plansza %ux%u\n") \
+    X(LOG_SD_BOARD_INVALID,     "Nieprawidlowa plansza w wierszu %u\n")
+
+#endif
@@ -30,6 +30,13 @@
 #include "i2c.h"
 #include "pca9532.h"
 #include "bluetooth.h"
+#include "clock.h"
+#include "spibus.h"
+#include "palette.h"
+#include "highscore.h"
+#include "alphalcd.h"
+#include "log.h"
+#include "prof.h"
 #include "startup/ea_init.h"
 
 /***********/
@@ -99,8 +106,12 @@ static void initializationProcess(void *arg) {
 
 	// Initializes the consol for debugging and control messages
 	eaInit();
+	// Starts the free-running cycle clock (uses timer #1 after eaInit releases it)
+	initClock();
 	// Initializes I2C module by resetting it
 	i2cInit();
+	// Connects SPI0 shared by the LCD and the SD card
+	spiBusInit();
 
 	osCreateProcess(gameProcess, gameStack, GAME_STACK_SIZE, &gameProcPid, 2, NULL, &gameProcError);
   	osStartProcess(gameProcPid, &gameProcError);
@@ -118,17 +129,31 @@ static void initializationProcess(void *arg) {
  *
  ****************************************************************************/
 static void gameProcess(void *arg) {
+#if PROFILING
+	tU32 clearStart;
+#endif
 
 	// Initializes LCD
 	lcdInit();
 	lcdContrast(LCD_CONTRAST);
+	paletteInit();
+
+#if PROFILING
+	// Times a full screen clear, compare the builds with FASTCODE = 0 and 1
+	clearStart = CLOCK_NOW();
+	lcdClrscr();
+	LOG_INFO(LOG_LCD_CLEAR_TIME, CLOCK_SINCE(clearStart) / CLOCK_CYCLES_PER_US);
+#endif
 
 	// Initializes joystick
-	initKeyProc();
+	initKeys();
 
 	// Initializes PCA9532 for diodes around the screen
 	pca9532Init();
 
+	// Finds the newest high score table in the eeprom
+	loadHighScores();
+
 	displayMenu();
 
 	while (1) {
@@ -157,4 +182,8 @@ static void gameProcess(void *arg) {
  *
  ****************************************************************************/
 void appTick(tU32 elapsedTime) {
+	// samples and debounces joystick lines
+	keyTick();
+	// sends queued text to the alphanumeric display
+	alphaTick();
 }
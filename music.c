@@ -5,9 +5,7 @@
  *
  * Description:
  *    Contains procedures for playing sounds using DAC and timer.
- *    The procedure only plays the pacman beginning sound defined in
- *    beginning_sound.c file, but it could be easily generalized to play any sound
- *    had the need arose.
+ *    Plays the sounds of the asset blob (see assets/manifest.txt).
  *
  *****************************************************************************/
 
@@ -19,10 +17,21 @@
 #include "lpc2xxx.h"
 #include "startup/config.h"
 
+#include "clock.h"
 #include "music.h"
-#include "music/beginning_sound.h"
+#include "asset.h"
 
 
+/*************/
+/* Variables */
+/*************/
+
+// clock value at which the current timer delay started
+static tU32 timerStart;
+
+// length of the current timer delay in cycles
+static tU32 timerDelay;
+
 /*************/
 /* Functions */
 /*************/
@@ -43,51 +52,55 @@ void initDAC(void) {
 /*****************************************************************************
  *
  * Description:
- *    Writes to timer registers, reseting the counters and starting the timer.
- *    The timer is set to stop after the delay passed as the argument.
+ *    Starts measuring a delay on the free-running clock (see clock.c).
+ *    Timer #1 is shared with the profiler, so it is not reset or stopped here.
  *
  * Params:
- *      [in] delay - time in microseconds after which the timer will stop
+ *      [in] delay - time in microseconds after which the delay ends
  *
  ****************************************************************************/
 void setTimer(int delay) {
-  T1TCR = 0x02;          // sets the 2nd bit of TimerControlRegister to 1 resets the Timer and the Prescale Counter
-  T1PR  = 0x00;          // writes 0 to the Prescale Register - we don't need scaling
-  T1MR0 = (long) (delay * (long long) CORE_FREQ / 1000) / 1000;  // sets the Match Register to a value we expect after 90us
-  T1IR  = 0xff;          // resets all bits in the Interrupt Register, probably unnecessary, but I didn't get to test it
-  T1MCR = 0x04;          // sets the 3rd bit of MatchControlRegister - when the TC reaches the value in MR0, the timer
-  	  	  	  	  	  	 // will stop and the 0 bit in TCR will be set to 0
-  T1TCR = 0x01;          	// writes 1 to TCR[0] starting the timer
+	timerStart = CLOCK_NOW();
+	timerDelay = (tU32) delay * CLOCK_CYCLES_PER_US;
 }
 
 /*****************************************************************************
  *
  * Description:
- *    Busy-waits for the timer to stop.
+ *    Busy-waits for the delay to end.
  *
  ****************************************************************************/
 void waitForTimer(void) {
-	while (T1TCR & 0x01)		// The 1st bit of the TCR will be set to 0 when the timer reaches MR and stops.
-		;
+	waitCycles(timerStart, timerDelay);
 }
 
 
 /*****************************************************************************
  *
  * Description:
- *    Sequentially writes all contents of pacmanBeginningSound array (see file beginning_sound.c
- *    in music directory) into DAC register. Uses timer to delay the writes to match
- *    the sound frequency.
+ *    Sequentially writes all samples of a sound asset into DAC register.
+ *    Uses timer to delay the writes to match the sound frequency.
+ *
+ * Params:
+ *    [in] id - id of the sound asset (see assets/assetids.h)
  *
  ****************************************************************************/
-void playBeginningSound(void) {
-	int t;
+void playSound(tU16 id) {
+	const AssetEntry *sound = getAsset(id);
+	const tU8 *samples = getAssetData(id);
+	tU32 delay, t;
+
+	if (!sound || ASSET_SOUND != sound->kind) {
+		return;
+	}
+	// e.g. 11025Hz gives 1/f = ~90.7us before each sample, 90us is a fine approximation
+	delay = 1000000 / sound->rate;
 
-	for (t = 0; t < BEGINNING_SOUND_LEN; ++t) {
-		setTimer(BEGINNING_SOUND_DELAY);
+	for (t = 0; t < sound->size; ++t) {
+		setTimer(delay);
 
 		tS32 val;
-		val = pacmanBeginningSound[t] - 128;  		// transform 8 bit values from the array
+		val = samples[t] - 128;  					// transform 8 bit values from the array
 		val = val * 2;						  		// into 10 bits we must set in DAC register
 		if (val > 127) {
 			val = 127;
@@ -103,3 +116,13 @@ void playBeginningSound(void) {
 		waitForTimer();
 	}
 }
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Plays the pacman intro sound.
+ *
+ ****************************************************************************/
+void playBeginningSound(void) {
+	playSound(ASSET_BEGINNING_SOUND);
+}
@@ -5,14 +5,19 @@
  *
  * Description:
  *    Contains procedures for playing sounds using DAC and timer.
- *    The procedure only plays the pacman beginning sound defined in
- *    beginning_sound.c file, but it could be easily generalized to play any sound
- *    had the need arose.
+ *    Plays the sounds of the asset blob (see assets/manifest.txt).
  *
  *****************************************************************************/
 #ifndef MUSIC_H_
 #define MUSIC_H_
 
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "fastcode.h"
+
 /*************/
 /* Functions */
 /*************/
@@ -20,8 +25,11 @@
 // writes into PINSEL1 register, enabling P0.25 pin (AOUT)
 void initDAC(void);
 
-// writes all contents of pacmanBeginningSound array (see files in music directory) into
-// DAC register, using timer to delay subsequent writes in order to match the sound frequency
+// writes all samples of a sound asset into DAC register, using timer
+// to delay subsequent writes in order to match the sound frequency
+FASTCODE void playSound(tU16 id);
+
+// plays the pacman intro sound
 void playBeginningSound(void);
 
 #endif /* MUSIC_H_ */
@@ -1,2357 +0,0 @@
-/**
- * 
- * Generated with faliczek.py, by Michał Sośnicki
- * I learned about wave file format from:
- * http://pratikmhatre.wordpress.com/2012/11/05/play-wav-file-using-dac-on-lpc2148/
- * 
- * File pacman_beginning.wav
- * 4 ChunkID = b'RIFF' - Contains the letters “RIFF”.
- * 4 ChunkSize = 46570 - Size of the file in bytes minus 8
- * 4 Format = b'WAVE' -  Contains the letters “WAVE”.
- * 
- * 4 Subchunk1ID = b'fmt ' - Contains the letters “fmt”.
- * 4 Subchunk1Size = 16 - Size of the rest of the Subchunk.
- * 2 AudioFormat = 1 - Other than 1 indicate form of compression.
- * 2 NumChannels = 1 - Mono = 1, Stereo = 2, etc.
- * 4 SampleRate = 11025 - 8000, 44100, etc.
- * 4 ByteRate = 11025 - SampleRate * NumChannels * BitsPerSample/8
- * 2 BlockAlign = 1 - NumChannels * BitsPerSample/8
- * 2 BitsPerSample = 8 - 8 bits = 8, 16 bits = 16, etc.
- * 
- * 4 Subchunk2ID = b'data' - Contains the letters “data”.
- * 4 Subchunk2Size = 46490 - NumSamples * NumChannels * BitsPerSample/8
- *                           This is the number of bytes in the data.
- * 
- **/
-
-const char pacmanBeginningSound[46548] = {
-128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 
-128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 
-128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 126, 129, 125, 
-151, 167, 155, 172, 184, 194, 206, 218, 230, 239, 240, 241, 236, 233, 225, 214, 200, 184, 171, 158, 
-151, 145, 147, 146, 147, 155, 165, 179, 184, 180, 183, 186, 188, 176, 144, 127, 113, 91, 80, 100, 
-103, 98, 96, 104, 139, 161, 174, 192, 206, 193, 185, 190, 192, 189, 171, 150, 136, 117, 96, 76, 
-56, 50, 45, 50, 54, 61, 74, 90, 110, 123, 131, 138, 143, 142, 139, 136, 125, 111, 91, 76, 
-67, 59, 52, 49, 55, 72, 90, 104, 128, 147, 175, 190, 194, 195, 189, 191, 187, 175, 157, 137, 
-130, 125, 118, 112, 114, 122, 136, 148, 165, 184, 200, 214, 220, 224, 223, 216, 203, 189, 171, 148, 
-128, 110, 100, 94, 94, 98, 97, 105, 116, 134, 147, 148, 152, 157, 159, 156, 136, 115, 102, 83, 
-65, 45, 28, 23, 19, 24, 27, 35, 48, 66, 87, 104, 121, 128, 133, 132, 131, 133, 123, 111, 
-93, 85, 89, 84, 79, 77, 84, 108, 126, 141, 163, 181, 205, 218, 223, 224, 217, 213, 201, 184, 
-162, 142, 123, 105, 98, 92, 97, 96, 101, 112, 129, 150, 155, 151, 157, 159, 161, 140, 100, 79, 
-61, 37, 33, 56, 59, 58, 58, 73, 108, 128, 141, 161, 173, 160, 156, 159, 160, 156, 138, 121, 
-109, 91, 74, 56, 40, 36, 31, 37, 40, 49, 61, 79, 99, 110, 118, 124, 129, 128, 125, 122, 
-112, 99, 79, 68, 60, 54, 47, 46, 52, 69, 84, 99, 122, 142, 169, 182, 187, 187, 182, 186, 
-178, 166, 146, 128, 123, 116, 109, 104, 108, 116, 131, 143, 163, 183, 199, 213, 219, 223, 221, 213, 
-199, 184, 164, 139, 121, 103, 95, 89, 91, 94, 94, 104, 116, 135, 147, 149, 153, 158, 160, 155, 
-134, 114, 101, 81, 63, 42, 27, 23, 19, 26, 29, 39, 52, 73, 93, 112, 128, 134, 139, 137, 
-137, 136, 126, 114, 94, 89, 91, 86, 81, 80, 89, 114, 131, 147, 170, 189, 211, 221, 226, 225, 
-220, 214, 202, 185, 163, 142, 124, 110, 104, 99, 104, 103, 110, 122, 141, 159, 161, 159, 165, 167, 
-168, 142, 103, 84, 65, 40, 45, 64, 61, 61, 61, 80, 114, 134, 148, 170, 176, 163, 164, 168, 
-168, 162, 143, 126, 112, 92, 75, 55, 41, 36, 34, 40, 43, 54, 67, 87, 106, 117, 126, 133, 
-137, 134, 132, 127, 115, 101, 82, 72, 63, 56, 49, 50, 58, 76, 91, 110, 132, 152, 179, 189, 
-193, 192, 187, 189, 180, 167, 147, 131, 125, 118, 112, 109, 113, 123, 138, 150, 170, 188, 205, 217, 
-221, 225, 222, 214, 199, 185, 165, 142, 124, 106, 99, 93, 96, 98, 99, 110, 123, 143, 153, 156, 
-160, 165, 166, 158, 135, 119, 104, 82, 63, 42, 29, 24, 22, 29, 32, 44, 58, 81, 102, 120, 
-134, 140, 144, 141, 143, 140, 128, 114, 94, 91, 92, 87, 82, 82, 96, 120, 134, 153, 176, 194, 
-216, 224, 228, 226, 220, 215, 201, 184, 160, 142, 124, 112, 105, 102, 106, 106, 115, 128, 148, 164, 
-164, 164, 171, 173, 171, 139, 107, 89, 69, 45, 53, 70, 66, 66, 67, 90, 124, 142, 157, 179, 
-181, 168, 171, 174, 174, 165, 145, 129, 114, 93, 75, 54, 42, 37, 36, 42, 47, 59, 73, 95, 
-114, 125, 133, 140, 143, 140, 137, 130, 118, 101, 82, 71, 62, 56, 49, 51, 61, 80, 94, 115, 
-137, 160, 184, 191, 195, 192, 189, 189, 178, 164, 143, 129, 123, 116, 109, 107, 113, 123, 137, 152, 
-173, 190, 206, 217, 222, 224, 220, 211, 197, 182, 161, 138, 120, 104, 97, 92, 97, 98, 102, 114, 
-129, 149, 157, 161, 167, 171, 172, 161, 139, 123, 106, 84, 64, 42, 31, 25, 26, 32, 37, 50, 
-66, 90, 109, 128, 140, 146, 149, 145, 146, 141, 128, 112, 93, 91, 90, 84, 80, 82, 97, 120, 
-134, 155, 177, 197, 216, 223, 227, 223, 218, 211, 196, 179, 154, 136, 118, 108, 100, 100, 104, 105, 
-116, 129, 152, 167, 168, 169, 175, 177, 172, 139, 111, 94, 71, 49, 59, 70, 66, 66, 70, 98, 
-127, 142, 160, 182, 182, 171, 175, 178, 177, 165, 146, 131, 114, 92, 73, 51, 40, 32, 33, 38, 
-44, 58, 75, 100, 119, 130, 138, 145, 148, 150, 154, 155, 155, 154, 153, 155, 156, 156, 156, 156, 
-162, 167, 167, 167, 165, 172, 180, 179, 178, 176, 180, 187, 186, 185, 183, 185, 191, 191, 189, 188, 
-187, 189, 189, 188, 186, 186, 188, 188, 187, 186, 185, 181, 178, 178, 177, 176, 173, 169, 169, 168, 
-168, 160, 153, 152, 150, 150, 142, 133, 132, 130, 131, 122, 108, 106, 104, 105, 101, 93, 92, 92, 
-92, 91, 88, 87, 87, 88, 89, 94, 96, 97, 98, 99, 108, 113, 113, 114, 114, 129, 137, 137, 
-138, 137, 149, 159, 159, 159, 157, 162, 167, 166, 165, 164, 165, 167, 167, 166, 165, 162, 157, 156, 
-155, 155, 151, 143, 141, 139, 139, 134, 118, 114, 113, 113, 109, 81, 69, 68, 68, 72, 101, 116, 
-117, 119, 118, 142, 157, 159, 159, 159, 137, 118, 117, 114, 116, 107, 97, 96, 96, 97, 92, 85, 
-84, 84, 85, 84, 81, 81, 82, 83, 82, 79, 78, 79, 80, 81, 86, 89, 90, 90, 91, 96, 
-98, 99, 100, 100, 109, 114, 114, 116, 115, 125, 134, 134, 135, 133, 140, 147, 148, 148, 147, 150, 
-157, 157, 157, 156, 157, 160, 159, 159, 158, 158, 160, 160, 160, 159, 157, 153, 151, 150, 150, 149, 
-144, 142, 141, 141, 140, 132, 128, 127, 126, 126, 118, 111, 111, 110, 111, 100, 90, 89, 89, 91, 
-86, 80, 79, 79, 81, 79, 76, 77, 77, 78, 80, 86, 87, 89, 89, 92, 101, 104, 105, 105, 
-108, 123, 129, 130, 130, 131, 145, 151, 151, 151, 151, 156, 159, 159, 159, 158, 160, 161, 161, 160, 
-159, 156, 152, 151, 149, 149, 145, 138, 136, 135, 135, 129, 115, 113, 111, 112, 105, 79, 71, 71, 
-70, 77, 105, 115, 117, 118, 119, 143, 154, 156, 156, 154, 131, 117, 116, 114, 115, 106, 98, 98, 
-98, 99, 93, 88, 88, 88, 89, 88, 86, 86, 87, 89, 87, 84, 85, 85, 86, 88, 93, 95, 
-96, 96, 98, 102, 104, 104, 105, 106, 114, 118, 119, 120, 121, 131, 137, 138, 138, 138, 146, 152, 
-152, 152, 151, 157, 162, 162, 162, 160, 162, 164, 164, 163, 162, 162, 162, 162, 161, 160, 158, 154, 
-153, 152, 152, 150, 146, 145, 144, 144, 142, 134, 131, 130, 130, 129, 120, 116, 115, 115, 115, 103, 
-95, 95, 95, 96, 91, 85, 86, 86, 87, 85, 83, 83, 84, 85, 87, 92, 93, 95, 95, 99, 
-107, 109, 111, 111, 115, 128, 133, 134, 133, 136, 149, 153, 154, 154, 153, 159, 161, 161, 160, 160, 
-162, 163, 162, 162, 161, 158, 155, 154, 153, 153, 147, 142, 141, 140, 140, 133, 120, 119, 117, 119, 
-106, 84, 80, 79, 79, 87, 113, 119, 122, 121, 128, 149, 156, 157, 157, 153, 131, 121, 119, 118, 
-118, 108, 103, 103, 103, 103, 97, 93, 93, 93, 94, 92, 91, 91, 92, 93, 91, 89, 89, 90, 
-90, 93, 97, 98, 100, 100, 102, 106, 107, 108, 108, 111, 119, 122, 123, 123, 125, 136, 140, 140, 
-141, 141, 149, 153, 153, 153, 153, 159, 163, 162, 162, 161, 163, 165, 164, 164, 163, 164, 166, 165, 
-164, 164, 161, 158, 157, 156, 155, 153, 149, 148, 147, 147, 145, 137, 135, 132, 130, 128, 121, 118, 
-118, 118, 117, 107, 102, 101, 101, 102, 96, 94, 94, 94, 95, 93, 92, 92, 93, 93, 96, 99, 
-100, 101, 101, 105, 111, 112, 114, 113, 119, 129, 131, 132, 131, 135, 145, 148, 148, 148, 149, 153, 
-154, 154, 154, 154, 155, 156, 156, 156, 154, 152, 150, 149, 149, 148, 143, 140, 139, 139, 138, 130, 
-122, 122, 120, 122, 109, 93, 90, 90, 90, 102, 120, 123, 126, 124, 132, 148, 153, 153, 153, 149, 
-131, 124, 123, 123, 121, 113, 110, 109, 109, 109, 104, 101, 101, 101, 101, 99, 98, 99, 99, 100, 
-98, 96, 97, 97, 98, 100, 104, 104, 105, 105, 107, 110, 111, 112, 112, 115, 121, 122, 123, 123, 
-126, 134, 136, 137, 137, 138, 145, 147, 148, 147, 148, 153, 155, 155, 155, 155, 157, 158, 158, 158, 
-157, 158, 159, 159, 158, 158, 155, 153, 152, 151, 151, 149, 146, 145, 145, 144, 141, 135, 134, 133, 
-134, 131, 124, 123, 122, 123, 120, 110, 107, 108, 109, 109, 104, 103, 103, 103, 103, 101, 91, 67, 
-35, 11, 3, 14, 38, 74, 102, 120, 120, 102, 71, 44, 35, 45, 65, 99, 128, 147, 154, 141, 
-112, 83, 66, 67, 82, 112, 147, 170, 177, 164, 132, 96, 73, 64, 75, 105, 144, 170, 176, 164, 
-136, 97, 68, 49, 53, 79, 119, 150, 153, 136, 111, 72, 42, 37, 56, 79, 120, 152, 180, 191, 
-175, 138, 105, 78, 64, 79, 112, 149, 170, 167, 151, 117, 81, 56, 46, 58, 89, 129, 156, 163, 
-151, 122, 82, 54, 40, 50, 79, 120, 151, 167, 162, 138, 99, 68, 53, 59, 83, 124, 158, 178, 
-180, 160, 124, 90, 73, 79, 99, 137, 173, 196, 203, 188, 155, 118, 95, 94, 110, 143, 181, 206, 
-214, 203, 174, 135, 107, 97, 109, 137, 176, 203, 213, 204, 180, 140, 108, 91, 95, 119, 158, 189, 
-202, 196, 177, 137, 103, 79, 75, 94, 131, 167, 184, 178, 161, 123, 85, 59, 49, 65, 101, 141, 
-166, 170, 158, 126, 86, 58, 50, 65, 97, 138, 167, 182, 177, 153, 114, 83, 74, 88, 114, 155, 
-184, 205, 206, 185, 148, 113, 94, 98, 119, 158, 193, 213, 215, 198, 162, 124, 99, 93, 109, 143, 
-180, 202, 203, 190, 159, 120, 91, 74, 83, 114, 153, 179, 178, 163, 135, 93, 62, 59, 78, 106, 
-148, 178, 205, 209, 189, 149, 113, 85, 77, 98, 137, 172, 189, 185, 166, 128, 90, 65, 59, 75, 
-111, 151, 175, 178, 164, 131, 90, 61, 50, 64, 97, 140, 169, 181, 173, 145, 103, 72, 60, 70, 
-98, 141, 172, 189, 187, 165, 125, 91, 76, 84, 108, 149, 182, 202, 205, 187, 151, 114, 92, 94, 
-112, 149, 185, 207, 212, 198, 165, 126, 100, 94, 108, 139, 177, 203, 211, 200, 171, 130, 100, 85, 
-94, 121, 160, 189, 200, 192, 168, 127, 93, 71, 73, 96, 135, 169, 184, 176, 156, 116, 79, 54, 
-50, 69, 108, 147, 169, 171, 156, 121, 82, 56, 52, 68, 103, 145, 171, 183, 174, 144, 105, 77, 
-72, 86, 115, 157, 187, 205, 202, 177, 137, 105, 90, 98, 122, 162, 195, 214, 212, 192, 152, 116, 
-93, 90, 106, 143, 179, 199, 198, 182, 147, 107, 80, 68, 81, 115, 155, 178, 175, 159, 127, 85, 
-57, 56, 75, 106, 149, 179, 201, 200, 175, 133, 100, 75, 73, 97, 137, 171, 186, 179, 157, 116, 
-81, 58, 56, 76, 115, 153, 174, 175, 158, 122, 82, 55, 49, 66, 103, 144, 170, 179, 167, 136, 
-95, 66, 56, 69, 101, 144, 174, 188, 182, 155, 115, 82, 70, 80, 107, 150, 182, 201, 199, 178, 
-138, 102, 83, 88, 110, 150, 185, 205, 207, 190, 153, 114, 90, 87, 105, 141, 178, 202, 206, 193, 
-159, 118, 88, 77, 90, 121, 161, 188, 196, 185, 157, 115, 83, 64, 71, 97, 138, 170, 181, 172, 
-149, 107, 72, 50, 51, 73, 114, 151, 170, 169, 151, 113, 75, 51, 51, 70, 108, 147, 172, 181, 
-168, 135, 95, 70, 67, 83, 116, 158, 186, 202, 195, 167, 126, 95, 84, 94, 121, 163, 194, 211, 
-206, 181, 139, 104, 84, 87, 109, 148, 183, 200, 196, 177, 138, 101, 75, 67, 85, 121, 160, 180, 
-173, 155, 119, 78, 55, 57, 75, 110, 152, 181, 197, 191, 161, 118, 86, 66, 71, 99, 141, 174, 
-186, 178, 151, 110, 76, 56, 58, 81, 123, 159, 178, 176, 155, 115, 78, 54, 53, 72, 111, 151, 
-175, 180, 165, 128, 89, 62, 57, 72, 107, 149, 177, 188, 178, 147, 105, 75, 66, 78, 108, 151, 
-182, 199, 193, 168, 126, 91, 75, 82, 107, 149, 184, 202, 200, 179, 139, 102, 80, 80, 100, 140, 
-178, 199, 201, 185, 147, 107, 80, 73, 89, 123, 163, 189, 195, 183, 150, 108, 78, 63, 73, 104, 
-146, 175, 185, 174, 148, 105, 71, 51, 56, 83, 125, 159, 176, 172, 151, 110, 73, 52, 54, 76, 
-117, 155, 178, 182, 166, 130, 90, 65, 65, 83, 120, 161, 188, 198, 187, 154, 113, 83, 74, 87, 
-119, 161, 191, 204, 196, 168, 125, 91, 74, 81, 108, 150, 183, 199, 193, 170, 130, 93, 69, 67, 
-89, 129, 166, 183, 177, 157, 119, 78, 53, 59, 80, 119, 161, 191, 205, 193, 157, 113, 80, 61, 
-73, 107, 152, 184, 193, 180, 161, 154, 152, 149, 147, 146, 146, 145, 144, 143, 143, 142, 142, 141, 
-140, 139, 139, 138, 138, 139, 139, 139, 139, 138, 139, 139, 139, 138, 138, 140, 140, 140, 140, 140, 
-142, 143, 143, 142, 142, 144, 145, 145, 144, 144, 145, 146, 145, 145, 145, 145, 145, 145, 144, 144, 
-144, 144, 144, 144, 143, 143, 142, 141, 141, 141, 140, 139, 138, 138, 137, 137, 134, 134, 133, 133, 
-132, 130, 129, 129, 128, 128, 125, 123, 122, 122, 122, 120, 119, 119, 119, 119, 119, 118, 118, 118, 
-118, 119, 120, 120, 120, 120, 121, 122, 122, 123, 122, 124, 127, 127, 127, 127, 128, 131, 132, 132, 
-132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 133, 133, 132, 132, 131, 131, 131, 129, 128, 128, 
-128, 128, 125, 123, 122, 122, 122, 118, 113, 112, 112, 112, 115, 122, 123, 124, 124, 127, 132, 133, 
-134, 134, 132, 126, 124, 124, 124, 123, 121, 120, 119, 119, 119, 118, 117, 117, 117, 117, 116, 116, 
-116, 116, 116, 116, 115, 115, 115, 115, 118, 120, 120, 121, 121, 121, 121, 122, 122, 122, 122, 123, 
-123, 123, 123, 124, 125, 125, 125, 125, 125, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 
-125, 125, 125, 125, 124, 123, 123, 123, 124, 124, 122, 121, 121, 121, 121, 120, 120, 120, 120, 120, 
-120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 122, 123, 123, 123, 123, 124, 126, 126, 126, 126, 
-127, 128, 128, 129, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 127, 127, 127, 127, 
-127, 126, 126, 126, 125, 125, 124, 123, 123, 123, 123, 121, 119, 118, 118, 118, 121, 123, 123, 124, 
-124, 125, 128, 128, 128, 129, 127, 125, 124, 124, 124, 124, 123, 122, 122, 122, 122, 122, 122, 122, 
-123, 123, 123, 122, 122, 123, 123, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 124, 124, 124, 
-124, 124, 125, 126, 126, 126, 126, 127, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 
-127, 127, 127, 128, 128, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 
-127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 128, 129, 128, 129, 128, 129, 128, 129, 128, 129, 128, 129, 127, 138, 142, 116, 97, 82, 82, 
-92, 112, 141, 170, 189, 199, 197, 186, 165, 134, 106, 88, 77, 80, 94, 118, 148, 173, 189, 196, 
-190, 176, 151, 119, 95, 79, 73, 81, 98, 125, 155, 177, 190, 192, 183, 166, 137, 108, 86, 73, 
-72, 84, 104, 133, 162, 180, 190, 188, 176, 155, 125, 98, 79, 69, 74, 89, 112, 143, 169, 184, 
-191, 185, 170, 145, 114, 90, 74, 69, 78, 95, 122, 153, 174, 187, 189, 179, 162, 133, 103, 82, 
-70, 69, 82, 102, 132, 160, 178, 188, 186, 173, 152, 121, 94, 76, 67, 72, 87, 111, 142, 167, 
-182, 187, 181, 165, 140, 109, 85, 69, 65, 74, 92, 120, 149, 171, 183, 185, 175, 156, 128, 99, 
-78, 65, 66, 79, 100, 130, 158, 176, 185, 182, 169, 148, 117, 90, 73, 64, 69, 85, 110, 141, 
-165, 180, 186, 178, 163, 138, 107, 84, 69, 65, 76, 94, 122, 153, 173, 185, 186, 176, 158, 128, 
-99, 79, 67, 68, 81, 103, 134, 161, 178, 187, 183, 170, 148, 116, 91, 73, 65, 69, 84, 110, 
-142, 165, 180, 185, 178, 162, 135, 105, 81, 66, 63, 73, 92, 120, 151, 172, 183, 184, 173, 154, 
-124, 95, 75, 63, 65, 79, 100, 131, 159, 177, 185, 182, 168, 145, 114, 87, 70, 62, 69, 85, 
-111, 143, 167, 181, 185, 178, 161, 135, 103, 81, 66, 63, 74, 93, 123, 153, 173, 185, 184, 173, 
-154, 124, 95, 76, 65, 68, 81, 104, 135, 162, 179, 187, 183, 169, 146, 114, 89, 71, 64, 72, 
-88, 115, 146, 169, 183, 187, 179, 162, 134, 104, 82, 67, 65, 77, 96, 126, 155, 175, 186, 185, 
-174, 154, 124, 95, 75, 64, 67, 81, 104, 135, 162, 178, 186, 181, 167, 143, 111, 86, 69, 63, 
-71, 88, 114, 146, 169, 182, 186, 177, 161, 133, 102, 80, 66, 65, 77, 96, 126, 156, 175, 185, 
-184, 173, 152, 121, 94, 75, 64, 68, 83, 106, 138, 164, 180, 188, 183, 169, 144, 113, 88, 71, 
-65, 74, 91, 119, 150, 172, 185, 188, 179, 162, 133, 103, 82, 68, 67, 79, 100, 130, 158, 177, 
-187, 185, 173, 151, 121, 92, 73, 63, 68, 83, 107, 139, 165, 181, 188, 182, 167, 142, 110, 85, 
-69, 63, 72, 89, 117, 149, 171, 184, 186, 177, 159, 130, 99, 78, 65, 65, 77, 98, 129, 158, 
-176, 187, 185, 172, 151, 119, 92, 73, 63, 68, 83, 109, 140, 165, 182, 188, 182, 167, 140, 109, 
-85, 69, 64, 73, 92, 120, 151, 173, 187, 188, 179, 160, 130, 100, 79, 66, 66, 79, 101, 131, 
-161, 179, 189, 186, 173, 151, 120, 92, 74, 65, 71, 86, 111, 143, 168, 183, 189, 183, 167, 141, 
-109, 85, 69, 65, 75, 93, 122, 153, 174, 187, 187, 177, 158, 128, 97, 77, 65, 65, 79, 100, 
-132, 160, 178, 187, 184, 171, 148, 116, 90, 71, 63, 70, 85, 111, 143, 167, 183, 188, 181, 165, 
-138, 107, 83, 68, 64, 75, 94, 123, 153, 174, 187, 188, 177, 157, 128, 98, 78, 66, 68, 82, 
-105, 136, 164, 181, 190, 186, 173, 150, 118, 91, 74, 66, 72, 89, 114, 146, 171, 185, 189, 182, 
-166, 137, 104, 80, 65, 63, 73, 92, 122, 154, 175, 186, 187, 176, 157, 126, 96, 75, 63, 66, 
-79, 102, 135, 163, 180, 188, 184, 171, 146, 113, 87, 70, 62, 69, 86, 113, 145, 169, 184, 188, 
-180, 164, 135, 104, 80, 65, 63, 74, 94, 124, 155, 176, 187, 187, 176, 155, 124, 95, 75, 64, 
-67, 81, 104, 136, 164, 181, 189, 185, 171, 147, 115, 88, 71, 64, 72, 89, 116, 149, 172, 187, 
-190, 182, 164, 136, 104, 81, 67, 65, 77, 97, 128, 158, 178, 189, 188, 177, 156, 124, 95, 75, 
-65, 69, 82, 107, 139, 166, 183, 190, 185, 171, 146, 113, 87, 70, 64, 71, 89, 117, 148, 171, 
-186, 188, 180, 162, 134, 102, 79, 65, 64, 76, 97, 128, 157, 177, 188, 186, 175, 154, 122, 93, 
-73, 63, 67, 82, 107, 139, 166, 182, 189, 184, 169, 144, 111, 86, 69, 64, 73, 91, 118, 151, 
-174, 187, 190, 182, 164, 135, 104, 82, 69, 69, 81, 101, 132, 161, 179, 189, 187, 176, 154, 122, 
-95, 76, 66, 68, 70, 71, 73, 74, 75, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 
-88, 89, 90, 91, 92, 93, 94, 94, 95, 96, 97, 97, 98, 99, 99, 100, 101, 102, 102, 103, 
-104, 104, 105, 106, 106, 107, 108, 108, 109, 109, 110, 110, 111, 112, 112, 113, 113, 114, 114, 115, 
-115, 116, 116, 117, 117, 118, 118, 118, 119, 119, 120, 120, 121, 121, 122, 122, 123, 123, 123, 124, 
-124, 124, 125, 125, 125, 126, 126, 126, 126, 127, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129, 
-129, 129, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 
-133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 
-135, 135, 135, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 
-137, 137, 137, 137, 137, 135, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 
-134, 134, 134, 134, 134, 134, 135, 135, 135, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 
-134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 
-134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 
-135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 
-135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134, 
-134, 134, 133, 133, 133, 133, 133, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 
-134, 134, 134, 133, 133, 133, 133, 132, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 130, 131, 128, 124, 122, 122, 122, 122, 123, 123, 123, 123, 123, 
-123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 
-125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 
-128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 
-128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 
-131, 131, 130, 131, 130, 131, 130, 131, 130, 131, 130, 136, 151, 155, 173, 195, 195, 195, 202, 194, 
-179, 165, 146, 117, 95, 81, 76, 79, 86, 102, 126, 148, 167, 191, 208, 209, 212, 214, 202, 183, 
-171, 159, 149, 146, 151, 159, 169, 182, 198, 209, 212, 209, 206, 189, 165, 144, 123, 84, 61, 51, 
-67, 102, 116, 141, 186, 208, 219, 204, 182, 175, 157, 129, 104, 86, 64, 51, 51, 58, 68, 87, 
-108, 122, 133, 140, 144, 142, 131, 117, 97, 79, 64, 63, 69, 77, 97, 126, 149, 171, 196, 211, 
-213, 214, 209, 192, 170, 152, 137, 126, 124, 131, 140, 153, 170, 190, 203, 209, 208, 204, 187, 165, 
-143, 119, 92, 74, 67, 58, 54, 70, 86, 101, 115, 126, 127, 124, 116, 107, 93, 71, 54, 50, 
-47, 47, 69, 98, 118, 147, 183, 202, 210, 218, 214, 202, 184, 162, 141, 126, 111, 107, 113, 120, 
-128, 155, 172, 170, 171, 175, 139, 104, 84, 75, 86, 77, 68, 93, 114, 128, 130, 123, 144, 154, 
-152, 150, 148, 129, 107, 84, 59, 38, 25, 20, 22, 33, 49, 75, 105, 122, 135, 144, 146, 137, 
-130, 119, 97, 83, 83, 80, 81, 99, 120, 138, 165, 192, 210, 219, 223, 216, 200, 181, 158, 138, 
-124, 110, 107, 113, 121, 133, 156, 172, 177, 183, 183, 168, 150, 135, 103, 66, 48, 33, 21, 24, 
-39, 54, 76, 98, 115, 129, 135, 132, 132, 124, 103, 89, 89, 79, 78, 96, 114, 127, 154, 182, 
-201, 216, 228, 228, 219, 198, 172, 143, 120, 96, 87, 85, 80, 83, 108, 114, 105, 114, 128, 161, 
-165, 151, 154, 150, 134, 113, 71, 62, 66, 68, 79, 106, 122, 129, 138, 139, 130, 116, 99, 71, 
-45, 29, 19, 24, 34, 50, 72, 100, 121, 141, 159, 165, 163, 165, 157, 134, 119, 112, 100, 98, 
-109, 123, 136, 162, 189, 207, 222, 232, 228, 214, 192, 167, 142, 122, 106, 98, 97, 98, 107, 126, 
-140, 150, 162, 162, 146, 135, 123, 97, 67, 47, 29, 15, 14, 26, 47, 71, 96, 122, 144, 153, 
-159, 169, 164, 148, 139, 130, 116, 110, 114, 120, 131, 148, 169, 189, 201, 208, 211, 204, 185, 166, 
-144, 113, 85, 75, 59, 37, 42, 56, 102, 141, 155, 179, 204, 205, 193, 157, 129, 106, 82, 60, 
-53, 52, 54, 66, 86, 105, 120, 132, 137, 133, 126, 115, 100, 80, 60, 49, 43, 44, 57, 80, 
-102, 126, 154, 177, 186, 194, 197, 187, 169, 152, 136, 120, 112, 112, 118, 130, 150, 174, 197, 211, 
-218, 220, 211, 194, 174, 151, 122, 99, 87, 75, 70, 80, 94, 102, 118, 134, 139, 137, 135, 125, 
-108, 87, 63, 48, 37, 30, 37, 58, 77, 101, 141, 168, 180, 196, 207, 199, 187, 173, 153, 134, 
-123, 117, 116, 122, 130, 147, 169, 182, 191, 201, 191, 169, 156, 133, 83, 55, 39, 47, 68, 75, 
-98, 139, 168, 188, 180, 172, 174, 162, 141, 124, 102, 73, 53, 41, 36, 39, 52, 67, 85, 106, 
-121, 135, 144, 142, 135, 126, 106, 83, 75, 67, 61, 72, 94, 109, 132, 164, 187, 199, 214, 219, 
-210, 197, 178, 154, 135, 125, 118, 118, 124, 133, 151, 173, 189, 200, 207, 201, 186, 173, 151, 116, 
-92, 76, 52, 38, 47, 57, 69, 93, 116, 126, 135, 138, 136, 130, 115, 95, 81, 66, 55, 63, 
-79, 91, 114, 152, 180, 198, 219, 228, 226, 217, 203, 176, 148, 123, 107, 98, 96, 100, 117, 134, 
-147, 162, 176, 155, 136, 123, 121, 128, 107, 91, 102, 103, 105, 97, 87, 110, 132, 144, 154, 164, 
-155, 143, 128, 106, 73, 50, 33, 18, 17, 29, 49, 75, 101, 126, 144, 156, 158, 160, 155, 139, 
-121, 110, 96, 86, 91, 102, 112, 133, 163, 187, 206, 222, 229, 224, 213, 197, 172, 147, 126, 112, 
-104, 104, 111, 126, 143, 159, 174, 184, 181, 174, 166, 144, 111, 85, 61, 38, 25, 26, 35, 50, 
-73, 100, 124, 139, 148, 156, 154, 142, 132, 121, 102, 91, 95, 99, 106, 125, 145, 170, 192, 211, 
-222, 226, 217, 201, 181, 152, 121, 105, 89, 72, 69, 83, 81, 84, 103, 129, 167, 179, 176, 186, 
-185, 164, 133, 91, 74, 64, 57, 63, 79, 97, 115, 132, 144, 148, 145, 136, 120, 96, 70, 52, 
-44, 42, 43, 47, 51, 52, 57, 66, 67, 71, 84, 91, 92, 101, 110, 111, 115, 124, 127, 127, 
-131, 133, 134, 135, 139, 139, 139, 135, 134, 133, 131, 127, 128, 125, 117, 114, 114, 106, 98, 99, 
-92, 77, 76, 75, 68, 64, 66, 64, 62, 62, 65, 71, 74, 75, 84, 92, 93, 99, 116, 121, 
-123, 138, 147, 147, 152, 158, 159, 159, 163, 163, 163, 160, 157, 156, 154, 145, 144, 142, 130, 117, 
-120, 103, 78, 74, 77, 106, 122, 122, 141, 163, 166, 163, 135, 125, 123, 113, 105, 106, 102, 94, 
-93, 93, 91, 89, 91, 89, 86, 86, 88, 94, 96, 97, 101, 105, 106, 110, 119, 122, 123, 134, 
-143, 142, 148, 158, 160, 161, 169, 172, 171, 173, 175, 175, 175, 177, 178, 177, 173, 170, 169, 166, 
-162, 161, 159, 151, 146, 145, 138, 129, 128, 124, 109, 103, 103, 97, 91, 91, 90, 87, 87, 88, 
-93, 97, 97, 103, 112, 114, 117, 133, 141, 141, 154, 166, 166, 169, 175, 177, 177, 180, 181, 181, 
-178, 174, 171, 166, 159, 154, 154, 145, 131, 131, 122, 95, 88, 87, 110, 130, 130, 142, 165, 171, 
-170, 146, 133, 132, 124, 115, 113, 112, 104, 102, 102, 99, 98, 98, 97, 94, 94, 95, 99, 103, 
-103, 106, 110, 111, 113, 121, 125, 125, 133, 143, 143, 148, 157, 160, 160, 166, 171, 170, 172, 174, 
-174, 174, 176, 177, 176, 173, 169, 169, 167, 163, 160, 160, 153, 146, 146, 141, 131, 129, 128, 115, 
-106, 107, 102, 95, 95, 94, 91, 91, 91, 95, 100, 100, 104, 113, 116, 117, 131, 140, 140, 148, 
-161, 163, 164, 170, 173, 172, 174, 176, 175, 174, 169, 168, 166, 161, 154, 155, 146, 133, 129, 127, 
-100, 88, 86, 102, 127, 129, 138, 162, 170, 171, 151, 131, 131, 124, 114, 110, 110, 102, 98, 98, 
-97, 94, 95, 95, 92, 90, 91, 94, 99, 100, 102, 106, 108, 109, 116, 122, 122, 128, 139, 141, 
-143, 152, 157, 156, 162, 168, 168, 168, 171, 172, 171, 173, 175, 174, 172, 168, 167, 165, 162, 159, 
-159, 154, 146, 145, 142, 131, 126, 126, 116, 105, 105, 101, 95, 93, 94, 91, 90, 90, 93, 97, 
-98, 101, 109, 113, 113, 123, 135, 135, 140, 153, 158, 158, 163, 166, 166, 167, 169, 169, 168, 164, 
-162, 161, 157, 150, 150, 144, 132, 125, 126, 105, 89, 85, 94, 119, 126, 129, 151, 163, 165, 152, 
-130, 128, 124, 115, 109, 110, 103, 99, 99, 98, 95, 95, 96, 93, 91, 92, 94, 99, 100, 102, 
-105, 108, 108, 113, 120, 121, 125, 136, 139, 140, 147, 154, 154, 157, 163, 165, 165, 167, 168, 167, 
-168, 170, 170, 169, 165, 163, 162, 158, 155, 155, 151, 144, 141, 140, 132, 126, 126, 119, 106, 105, 
-103, 96, 93, 94, 91, 89, 89, 91, 96, 98, 99, 106, 112, 112, 119, 132, 134, 136, 148, 155, 
-155, 159, 163, 164, 164, 166, 166, 166, 162, 160, 159, 156, 148, 147, 144, 133, 123, 126, 110, 89, 
-84, 90, 115, 125, 125, 144, 160, 163, 157, 132, 127, 124, 115, 108, 109, 104, 99, 98, 98, 95, 
-95, 95, 93, 92, 93, 94, 99, 101, 103, 105, 108, 108, 112, 118, 119, 121, 129, 134, 134, 138, 
-145, 145, 147, 152, 154, 154, 156, 157, 156, 157, 159, 159, 158, 155, 153, 153, 151, 148, 147, 145, 
-139, 136, 136, 131, 125, 125, 120, 110, 107, 106, 101, 98, 98, 97, 95, 95, 96, 99, 101, 102, 
-107, 112, 113, 116, 127, 132, 133, 142, 149, 149, 151, 155, 156, 156, 158, 158, 158, 156, 153, 153, 
-151, 145, 143, 142, 135, 125, 126, 117, 98, 94, 94, 113, 125, 125, 136, 153, 156, 155, 137, 128, 
-127, 120, 114, 113, 111, 106, 104, 104, 103, 101, 102, 101, 99, 99, 100, 103, 105, 106, 108, 111, 
-111, 114, 120, 122, 123, 130, 136, 136, 139, 146, 148, 148, 154, 156, 156, 157, 159, 158, 158, 159, 
-160, 159, 156, 154, 153, 151, 148, 147, 146, 141, 137, 136, 132, 125, 124, 122, 112, 107, 107, 103, 
-98, 98, 98, 95, 95, 96, 99, 102, 102, 105, 112, 114, 115, 125, 132, 132, 139, 147, 148, 149, 
-153, 155, 154, 155, 156, 156, 155, 152, 156, 173, 179, 185, 209, 232, 243, 240, 211, 182, 151, 130, 
-121, 103, 113, 141, 159, 168, 186, 181, 150, 131, 118, 148, 181, 212, 232, 245, 224, 184, 150, 120, 
-107, 101, 108, 138, 164, 179, 173, 149, 116, 85, 68, 66, 78, 107, 137, 155, 158, 141, 108, 70, 
-46, 41, 62, 96, 135, 157, 164, 158, 136, 100, 76, 64, 83, 115, 150, 175, 184, 186, 176, 143, 
-118, 102, 115, 143, 175, 201, 212, 213, 204, 175, 146, 128, 129, 148, 176, 204, 219, 222, 212, 185, 
-153, 132, 126, 133, 156, 186, 205, 210, 196, 169, 136, 112, 103, 103, 120, 150, 172, 182, 167, 138, 
-105, 79, 67, 61, 67, 99, 124, 139, 130, 105, 71, 43, 27, 26, 40, 72, 103, 122, 125, 117, 
-89, 61, 41, 40, 63, 94, 127, 146, 153, 159, 143, 112, 90, 81, 106, 140, 175, 199, 208, 206, 
-188, 153, 126, 112, 120, 144, 178, 204, 217, 209, 186, 152, 121, 104, 102, 111, 141, 169, 185, 179, 
-147, 114, 80, 62, 53, 36, 54, 86, 106, 118, 140, 126, 93, 73, 66, 104, 143, 176, 198, 206, 
-174, 135, 102, 76, 66, 64, 76, 106, 130, 144, 134, 109, 78, 52, 38, 40, 54, 84, 113, 129, 
-128, 109, 80, 50, 32, 31, 51, 83, 115, 135, 140, 133, 109, 78, 56, 50, 69, 100, 134, 157, 
-166, 169, 153, 120, 96, 83, 99, 130, 166, 193, 203, 204, 190, 156, 127, 109, 114, 138, 173, 203, 
-217, 218, 204, 170, 136, 115, 112, 123, 152, 184, 203, 206, 188, 156, 121, 99, 92, 96, 117, 149, 
-170, 177, 159, 129, 95, 70, 61, 56, 69, 102, 125, 138, 127, 100, 66, 39, 25, 27, 44, 79, 
-108, 124, 125, 115, 85, 58, 40, 44, 69, 102, 133, 150, 157, 160, 138, 109, 88, 85, 113, 145, 
-180, 203, 210, 206, 183, 147, 122, 111, 123, 148, 182, 208, 218, 208, 182, 146, 116, 101, 102, 122, 
-155, 178, 189, 171, 136, 102, 71, 61, 44, 41, 73, 102, 116, 130, 143, 113, 87, 67, 83, 125, 
-161, 192, 210, 202, 160, 123, 90, 72, 66, 66, 89, 121, 142, 148, 130, 101, 69, 47, 39, 46, 
-68, 103, 127, 138, 128, 105, 70, 44, 31, 41, 66, 102, 131, 145, 145, 131, 100, 71, 54, 59, 
-84, 119, 152, 168, 173, 171, 143, 113, 92, 90, 114, 148, 183, 202, 208, 204, 179, 145, 121, 111, 
-125, 153, 188, 212, 220, 215, 192, 155, 128, 113, 117, 136, 170, 195, 209, 202, 180, 145, 113, 97, 
-95, 105, 135, 163, 180, 176, 151, 119, 86, 67, 60, 60, 86, 118, 138, 142, 121, 91, 56, 33, 
-26, 35, 61, 98, 123, 132, 129, 110, 77, 52, 40, 55, 86, 120, 147, 159, 166, 159, 128, 102, 
-85, 96, 128, 164, 194, 209, 211, 202, 170, 138, 117, 116, 134, 166, 198, 217, 219, 201, 171, 136, 
-111, 103, 108, 131, 164, 185, 192, 170, 136, 101, 73, 63, 47, 51, 85, 111, 123, 138, 145, 110, 
-85, 67, 91, 132, 169, 197, 213, 200, 158, 120, 87, 72, 66, 70, 98, 128, 148, 150, 128, 97, 
-65, 45, 40, 49, 76, 110, 132, 140, 127, 100, 65, 42, 31, 45, 73, 111, 139, 152, 149, 132, 
-98, 71, 55, 65, 93, 128, 160, 174, 177, 171, 139, 110, 90, 94, 120, 154, 188, 205, 209, 202, 
-173, 139, 116, 111, 127, 158, 192, 214, 220, 212, 186, 150, 124, 112, 118, 140, 175, 199, 211, 201, 
-176, 139, 110, 95, 95, 109, 142, 169, 185, 177, 150, 115, 83, 66, 60, 64, 95, 126, 146, 145, 
-123, 90, 55, 33, 29, 41, 71, 108, 131, 138, 132, 108, 74, 51, 42, 60, 92, 128, 154, 163, 
-168, 156, 123, 98, 83, 99, 131, 169, 198, 211, 212, 198, 162, 132, 113, 116, 136, 170, 201, 219, 
-217, 198, 164, 130, 108, 102, 109, 138, 170, 189, 192, 167, 134, 98, 72, 63, 49, 62, 97, 121, 
-134, 150, 145, 108, 84, 68, 96, 137, 175, 202, 217, 195, 154, 117, 85, 70, 66, 74, 106, 136, 
-154, 151, 128, 95, 63, 44, 42, 54, 84, 118, 139, 143, 128, 98, 63, 40, 33, 50, 81, 118, 
-144, 153, 148, 126, 93, 68, 56, 70, 99, 135, 164, 177, 181, 168, 134, 106, 89, 96, 117, 141, 
-170, 191, 208, 219, 213, 198, 173, 145, 126, 113, 109, 118, 135, 164, 192, 210, 219, 217, 202, 184, 
-156, 130, 111, 97, 96, 107, 127, 157, 175, 184, 189, 184, 172, 146, 111, 88, 71, 65, 61, 62, 
-85, 115, 139, 149, 145, 137, 122, 97, 68, 46, 34, 33, 43, 62, 92, 121, 140, 151, 153, 152, 
-137, 109, 84, 68, 72, 83, 96, 116, 143, 178, 200, 208, 206, 194, 178, 153, 129, 112, 104, 113, 
-131, 155, 183, 202, 212, 211, 203, 187, 163, 131, 105, 91, 89, 99, 112, 125, 148, 164, 174, 167, 
-133, 107, 80, 55, 42, 56, 71, 84, 106, 137, 183, 208, 214, 208, 196, 156, 112, 89, 73, 69, 
-68, 74, 98, 125, 145, 153, 150, 143, 128, 103, 75, 54, 42, 41, 50, 67, 91, 117, 136, 147, 
-148, 141, 123, 94, 67, 52, 48, 55, 69, 92, 120, 151, 170, 178, 174, 162, 149, 125, 102, 88, 
-82, 97, 120, 145, 173, 192, 208, 217, 210, 195, 168, 140, 122, 110, 109, 120, 139, 169, 196, 210, 
-216, 212, 198, 178, 149, 123, 106, 92, 95, 108, 130, 160, 177, 186, 190, 183, 169, 139, 106, 84, 
-68, 63, 60, 66, 92, 121, 144, 151, 148, 139, 122, 95, 66, 45, 34, 35, 47, 68, 101, 128, 
-146, 156, 157, 153, 135, 107, 81, 68, 74, 83, 98, 119, 148, 182, 202, 208, 204, 191, 173, 146, 
-122, 106, 101, 112, 131, 157, 185, 203, 211, 209, 200, 182, 156, 123, 99, 88, 87, 98, 112, 127, 
-151, 166, 176, 164, 131, 106, 77, 54, 42, 57, 71, 85, 109, 143, 187, 208, 213, 206, 191, 149, 
-108, 86, 71, 67, 67, 78, 104, 131, 150, 157, 153, 144, 127, 100, 72, 53, 42, 42, 54, 72, 
-98, 125, 143, 153, 152, 144, 122, 91, 67, 52, 50, 58, 74, 98, 129, 159, 175, 181, 175, 162, 
-146, 120, 98, 84, 82, 100, 121, 147, 176, 193, 209, 216, 207, 190, 160, 134, 116, 105, 106, 118, 
-140, 172, 196, 211, 217, 210, 195, 173, 143, 120, 102, 91, 95, 109, 134, 163, 177, 187, 189, 181, 
-165, 132, 100, 79, 64, 61, 59, 69, 98, 127, 149, 155, 150, 140, 121, 93, 64, 44, 35, 38, 
-51, 75, 108, 134, 152, 159, 159, 153, 132, 103, 78, 67, 73, 83, 100, 123, 154, 186, 203, 208, 
-202, 188, 168, 139, 116, 102, 99, 111, 132, 160, 187, 204, 211, 208, 197, 178, 149, 117, 95, 84, 
-87, 99, 112, 131, 156, 169, 178, 162, 130, 105, 75, 52, 46, 61, 71, 89, 113, 149, 190, 209, 
-210, 203, 183, 137, 102, 81, 67, 65, 67, 81, 109, 135, 153, 158, 154, 144, 125, 97, 69, 50, 
-41, 44, 58, 77, 105, 132, 149, 156, 154, 144, 120, 89, 65, 52, 51, 61, 78, 103, 135, 163, 
-178, 183, 175, 160, 142, 115, 95, 82, 83, 102, 124, 153, 179, 197, 212, 214, 205, 185, 154, 128, 
-112, 102, 106, 118, 143, 175, 198, 211, 216, 208, 191, 166, 136, 113, 96, 88, 94, 110, 138, 165, 
-178, 188, 188, 179, 161, 127, 97, 76, 64, 61, 59, 74, 104, 131, 150, 154, 149, 137, 116, 88, 
-59, 41, 34, 40, 56, 82, 115, 141, 158, 164, 163, 154, 129, 99, 75, 66, 70, 81, 99, 125, 
-158, 187, 202, 205, 197, 181, 157, 127, 105, 91, 91, 106, 127, 158, 185, 202, 208, 205, 193, 171, 
-139, 108, 88, 79, 83, 97, 114, 138, 162, 175, 182, 164, 136, 108, 78, 56, 50, 61, 71, 91, 
-118, 156, 191, 206, 207, 198, 175, 131, 98, 76, 64, 63, 68, 86, 116, 143, 160, 165, 160, 149, 
-127, 97, 70, 51, 43, 49, 63, 85, 116, 142, 158, 164, 160, 146, 120, 88, 65, 53, 52, 64, 
-82, 111, 143, 169, 183, 185, 176, 161, 137, 108, 89, 77, 80, 99, 123, 153, 180, 197, 211, 210, 
-198, 176, 143, 118, 101, 93, 99, 114, 141, 174, 196, 209, 213, 204, 187, 160, 129, 106, 89, 83, 
-92, 110, 141, 167, 182, 192, 190, 180, 158, 122, 94, 74, 62, 61, 63, 82, 113, 141, 158, 162, 
-156, 143, 120, 88, 60, 43, 37, 45, 62, 90, 122, 146, 160, 164, 161, 150, 125, 98, 77, 70, 
-76, 87, 105, 130, 161, 185, 191, 192, 192, 194, 197, 197, 195, 194, 193, 194, 194, 193, 192, 190, 
-187, 186, 185, 184, 182, 177, 174, 172, 172, 171, 163, 157, 157, 156, 156, 140, 129, 127, 126, 125, 
-137, 152, 152, 154, 151, 162, 173, 175, 174, 174, 166, 150, 146, 144, 144, 140, 133, 130, 130, 129, 
-128, 122, 120, 120, 119, 119, 117, 116, 115, 115, 115, 113, 111, 111, 111, 112, 114, 116, 116, 116, 
-116, 118, 120, 120, 120, 120, 124, 128, 128, 129, 128, 132, 138, 139, 139, 139, 141, 147, 147, 147, 
-147, 148, 152, 153, 153, 152, 152, 153, 154, 153, 153, 152, 154, 154, 153, 152, 152, 149, 147, 146, 
-145, 145, 142, 140, 139, 139, 138, 135, 130, 129, 128, 128, 124, 119, 118, 117, 117, 113, 104, 102, 
-102, 102, 100, 95, 94, 94, 95, 95, 93, 92, 92, 92, 93, 96, 97, 98, 98, 99, 104, 108, 
-108, 109, 109, 117, 124, 124, 125, 124, 131, 138, 139, 139, 138, 141, 144, 144, 144, 143, 144, 145, 
-145, 145, 144, 143, 140, 139, 139, 138, 135, 129, 128, 127, 127, 125, 117, 114, 114, 114, 113, 100, 
-92, 92, 92, 93, 107, 116, 117, 119, 118, 129, 138, 140, 140, 140, 130, 119, 118, 116, 117, 113, 
-108, 107, 106, 107, 106, 101, 101, 101, 101, 101, 99, 99, 100, 100, 100, 98, 98, 98, 99, 99, 
-102, 103, 104, 104, 105, 107, 108, 109, 109, 109, 113, 116, 117, 118, 117, 122, 127, 127, 128, 127, 
-131, 135, 136, 136, 135, 137, 141, 141, 141, 141, 141, 143, 143, 143, 142, 142, 143, 144, 143, 143, 
-142, 140, 139, 138, 138, 138, 135, 134, 134, 133, 133, 129, 127, 126, 126, 126, 122, 118, 117, 117, 
-117, 112, 106, 105, 104, 105, 103, 99, 99, 99, 100, 99, 97, 97, 98, 98, 99, 102, 103, 104, 
-104, 106, 111, 113, 113, 114, 115, 123, 127, 127, 128, 128, 135, 139, 140, 140, 139, 141, 143, 143, 
-143, 142, 143, 144, 144, 143, 143, 142, 140, 139, 138, 138, 136, 133, 131, 131, 131, 128, 120, 118, 
-117, 118, 115, 101, 95, 94, 94, 97, 111, 119, 120, 121, 121, 131, 138, 139, 139, 139, 130, 122, 
-121, 120, 121, 117, 114, 114, 114, 114, 112, 109, 109, 109, 109, 109, 107, 107, 108, 108, 108, 106, 
-106, 106, 107, 108, 110, 111, 111, 112, 112, 114, 115, 116, 116, 116, 120, 122, 123, 123, 123, 128, 
-131, 132, 132, 132, 135, 138, 138, 139, 138, 140, 143, 143, 143, 142, 143, 144, 144, 143, 143, 143, 
-144, 144, 144, 143, 143, 141, 140, 139, 139, 138, 137, 136, 135, 135, 135, 131, 129, 129, 128, 128, 
-124, 121, 121, 121, 121, 116, 111, 111, 110, 111, 109, 106, 106, 106, 107, 106, 105, 105, 106, 106, 
-107, 110, 110, 111, 111, 113, 117, 118, 119, 119, 120, 127, 130, 131, 131, 131, 138, 141, 141, 141, 
-141, 143, 145, 145, 144, 144, 145, 146, 145, 145, 145, 143, 141, 141, 140, 140, 138, 135, 134, 133, 
-133, 130, 123, 122, 121, 122, 116, 105, 102, 101, 101, 104, 117, 122, 124, 123, 126, 137, 141, 142, 
-142, 141, 130, 124, 123, 122, 122, 118, 115, 114, 114, 115, 114, 113, 113, 113, 114, 113, 113, 113, 
-113, 113, 113, 112, 112, 113, 113, 114, 117, 118, 118, 118, 118, 120, 120, 121, 121, 121, 124, 125, 
-126, 126, 126, 130, 131, 132, 132, 132, 134, 136, 136, 137, 136, 138, 140, 140, 140, 139, 140, 141, 
-140, 140, 140, 140, 141, 141, 141, 140, 140, 138, 138, 137, 137, 136, 135, 134, 134, 134, 133, 131, 
-129, 129, 129, 128, 125, 124, 124, 123, 123, 119, 117, 116, 116, 116, 114, 113, 113, 113, 113, 113, 
-112, 112, 112, 112, 114, 115, 115, 116, 116, 118, 120, 121, 122, 122, 124, 128, 130, 130, 130, 131, 
-136, 138, 138, 138, 138, 140, 141, 141, 140, 140, 141, 141, 141, 141, 140, 139, 138, 138, 138, 138, 
-136, 134, 133, 133, 133, 130, 126, 126, 125, 126, 121, 113, 111, 111, 111, 114, 123, 126, 127, 126, 
-129, 136, 139, 139, 139, 137, 129, 125, 124, 124, 124, 120, 118, 118, 118, 118, 116, 115, 115, 115, 
-115, 114, 114, 114, 114, 115, 114, 113, 113, 114, 114, 115, 116, 117, 118, 120, 121, 122, 123, 123, 
-123, 124, 126, 126, 127, 127, 127, 130, 131, 131, 132, 132, 135, 136, 136, 136, 136, 137, 138, 138, 
-138, 138, 138, 138, 138, 138, 138, 138, 139, 138, 138, 138, 137, 137, 136, 136, 136, 135, 134, 134, 
-134, 134, 133, 131, 131, 130, 130, 130, 127, 127, 126, 126, 126, 123, 121, 121, 121, 121, 119, 118, 
-118, 118, 118, 118, 117, 117, 117, 118, 118, 119, 120, 120, 120, 121, 123, 123, 124, 124, 126, 129, 
-129, 130, 129, 131, 134, 134, 135, 135, 135, 136, 136, 137, 136, 136, 137, 137, 137, 137, 136, 136, 
-135, 135, 135, 135, 134, 133, 132, 132, 132, 129, 127, 127, 126, 127, 123, 118, 117, 117, 117, 120, 
-126, 127, 128, 127, 130, 135, 136, 136, 137, 135, 129, 127, 127, 127, 126, 124, 123, 123, 123, 122, 
-121, 120, 120, 120, 120, 119, 119, 119, 119, 119, 118, 117, 117, 117, 118, 118, 119, 120, 120, 120, 
-121, 121, 122, 122, 122, 123, 125, 125, 126, 126, 127, 129, 130, 130, 130, 131, 132, 131, 131, 131, 
-131, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 133, 133, 
-133, 133, 132, 132, 132, 132, 131, 131, 130, 130, 130, 130, 129, 128, 128, 128, 128, 126, 126, 126, 
-126, 125, 125, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 126, 127, 127, 
-127, 126, 127, 129, 129, 129, 129, 130, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 132, 131, 131, 131, 131, 131, 130, 130, 129, 129, 129, 128, 127, 127, 127, 127, 124, 122, 
-122, 122, 122, 124, 127, 127, 128, 128, 130, 132, 133, 133, 133, 131, 129, 128, 128, 128, 127, 126, 
-126, 126, 126, 126, 125, 125, 125, 125, 125, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 
-125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 127, 127, 126, 127, 128, 128, 128, 128, 128, 
-129, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 128, 
-127, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 
-129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 
-128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 
-127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 124, 102, 92, 87, 79, 68, 50, 36, 26, 19, 19, 26, 38, 53, 74, 93, 105, 115, 
-118, 116, 109, 97, 82, 66, 55, 48, 45, 50, 59, 71, 89, 108, 122, 132, 138, 136, 128, 116, 
-97, 77, 62, 52, 47, 50, 60, 74, 94, 117, 134, 148, 156, 156, 148, 134, 115, 91, 72, 59, 
-51, 52, 62, 77, 98, 123, 144, 161, 171, 172, 165, 152, 132, 105, 83, 68, 57, 56, 65, 80, 
-99, 126, 150, 167, 179, 182, 177, 165, 147, 121, 96, 79, 66, 62, 69, 82, 101, 127, 153, 172, 
-184, 189, 186, 176, 159, 134, 108, 89, 75, 68, 72, 85, 102, 127, 154, 174, 188, 195, 194, 184, 
-170, 147, 120, 98, 84, 75, 76, 86, 102, 125, 151, 173, 189, 198, 198, 190, 177, 156, 129, 106, 
-90, 79, 77, 86, 101, 120, 147, 171, 187, 198, 201, 195, 182, 164, 138, 113, 95, 83, 79, 85, 
-97, 116, 142, 167, 184, 196, 200, 196, 185, 168, 143, 118, 98, 84, 77, 81, 94, 110, 135, 162, 
-180, 193, 200, 198, 188, 174, 153, 126, 104, 89, 80, 81, 91, 108, 130, 157, 178, 193, 202, 201, 
-193, 179, 159, 132, 110, 93, 82, 80, 89, 104, 126, 153, 175, 190, 201, 203, 196, 184, 166, 140, 
-115, 97, 84, 80, 86, 101, 119, 144, 169, 186, 198, 202, 198, 187, 170, 145, 119, 100, 85, 79, 
-83, 95, 112, 137, 163, 182, 195, 201, 199, 189, 173, 151, 124, 103, 87, 78, 79, 90, 106, 129, 
-156, 177, 191, 199, 199, 190, 176, 155, 128, 105, 89, 78, 76, 85, 100, 122, 149, 171, 187, 198, 
-200, 193, 179, 160, 133, 109, 91, 79, 75, 82, 96, 115, 141, 166, 184, 195, 200, 195, 183, 165, 
-140, 114, 95, 81, 75, 80, 92, 109, 135, 161, 180, 193, 199, 197, 186, 170, 147, 119, 98, 83, 
-74, 76, 87, 103, 127, 154, 176, 190, 198, 197, 188, 174, 152, 125, 101, 85, 75, 74, 83, 98, 
-120, 147, 170, 186, 196, 197, 190, 176, 156, 128, 104, 86, 74, 71, 77, 92, 111, 138, 163, 180, 
-191, 195, 191, 178, 160, 135, 109, 90, 76, 70, 75, 88, 106, 132, 158, 177, 191, 197, 195, 183, 
-167, 144, 115, 94, 79, 70, 72, 84, 101, 124, 152, 173, 188, 197, 196, 188, 172, 150, 122, 99, 
-83, 73, 72, 81, 96, 119, 146, 169, 186, 195, 197, 189, 175, 155, 127, 103, 85, 73, 70, 77, 
-92, 111, 138, 164, 181, 192, 196, 191, 178, 159, 134, 107, 88, 74, 69, 74, 86, 105, 131, 157, 
-176, 189, 195, 192, 180, 164, 138, 111, 91, 75, 67, 69, 81, 98, 122, 150, 171, 186, 193, 192, 
-183, 167, 145, 117, 94, 78, 68, 67, 77, 93, 115, 143, 166, 183, 192, 193, 185, 171, 151, 123, 
-99, 82, 69, 67, 74, 89, 109, 137, 162, 179, 191, 194, 189, 176, 157, 131, 104, 85, 72, 67, 
-72, 85, 103, 130, 156, 176, 188, 193, 190, 179, 162, 136, 109, 89, 74, 66, 69, 81, 98, 123, 
-150, 171, 185, 192, 191, 181, 166, 143, 115, 92, 76, 66, 65, 75, 91, 114, 141, 164, 180, 189, 
-190, 182, 168, 147, 119, 96, 78, 67, 64, 72, 88, 108, 136, 162, 179, 191, 194, 189, 175, 156, 
-129, 103, 83, 69, 64, 70, 84, 103, 129, 156, 175, 188, 194, 190, 179, 161, 136, 109, 89, 73, 
-66, 68, 81, 98, 124, 152, 172, 187, 194, 193, 182, 166, 143, 115, 92, 76, 66, 66, 76, 93, 
-116, 144, 166, 183, 193, 193, 184, 170, 148, 120, 97, 79, 67, 64, 73, 88, 108, 136, 161, 179, 
-190, 193, 187, 173, 154, 127, 101, 82, 67, 63, 69, 82, 102, 128, 155, 174, 187, 192, 188, 176, 
-159, 133, 106, 85, 69, 62, 65, 79, 96, 122, 149, 169, 184, 191, 190, 179, 163, 140, 111, 89, 
-73, 63, 64, 74, 92, 115, 143, 166, 182, 191, 191, 183, 168, 146, 118, 95, 77, 66, 63, 72, 
-88, 109, 137, 161, 178, 190, 192, 186, 172, 152, 126, 99, 81, 67, 63, 69, 84, 103, 129, 156, 
-175, 187, 192, 188, 176, 158, 132, 105, 84, 69, 62, 66, 79, 96, 121, 149, 169, 183, 190, 188, 
-177, 161, 137, 109, 87, 71, 61, 62, 73, 91, 114, 142, 166, 182, 191, 191, 183, 167, 145, 117, 
-93, 75, 64, 62, 71, 87, 109, 137, 161, 178, 190, 193, 185, 171, 151, 123, 98, 80, 66, 62, 
-69, 85, 104, 131, 157, 176, 189, 194, 189, 177, 158, 132, 105, 85, 69, 63, 67, 80, 98, 124, 
-151, 171, 186, 193, 190, 179, 163, 139, 110, 89, 72, 62, 64, 75, 93, 116, 145, 167, 183, 192, 
-191, 182, 167, 145, 116, 92, 75, 64, 62, 71, 87, 110, 137, 161, 179, 190, 192, 184, 170, 150, 
-122, 97, 78, 65, 61, 68, 83, 103, 130, 156, 174, 187, 192, 187, 174, 155, 129, 103, 82, 67, 
-60, 65, 79, 97, 123, 150, 170, 185, 192, 189, 178, 161, 137, 109, 88, 71, 62, 64, 76, 93, 
-117, 145, 167, 183, 192, 191, 182, 166, 143, 115, 92, 74, 63, 62, 72, 88, 111, 139, 162, 180, 
-190, 192, 184, 170, 149, 121, 97, 78, 65, 61, 69, 84, 104, 131, 157, 175, 187, 191, 186, 172, 
-153, 127, 100, 80, 65, 59, 65, 78, 97, 123, 150, 169, 183, 191, 189, 178, 161, 136, 108, 87, 
-70, 61, 63, 76, 93, 117, 145, 168, 183, 192, 191, 181, 165, 143, 115, 91, 74, 63, 62, 72, 
-89, 111, 139, 163, 181, 192, 194, 186, 171, 151, 122, 98, 79, 66, 62, 70, 86, 106, 133, 159, 
-177, 190, 194, 188, 175, 155, 129, 102, 82, 67, 61, 67, 80, 99, 126, 153, 173, 187, 193, 190, 
-178, 161, 135, 108, 87, 70, 61, 64, 76, 94, 119, 147, 168, 183, 192, 191, 180, 164, 141, 113, 
-90, 73, 62, 61, 72, 88, 111, 139, 163, 180, 190, 191, 183, 169, 147, 119, 95, 77, 63, 60, 
-68, 84, 104, 132, 158, 176, 189, 192, 186, 173, 153, 127, 100, 80, 66, 60, 66, 80, 100, 126, 
-153, 173, 186, 193, 189, 177, 160, 134, 106, 85, 69, 61, 64, 77, 94, 120, 148, 169, 184, 192, 
-190, 180, 164, 141, 112, 90, 73, 63, 62, 73, 90, 113, 140, 164, 181, 191, 192, 183, 168, 146, 
-118, 94, 76, 62, 59, 68, 83, 104, 132, 157, 175, 187, 191, 184, 170, 151, 126, 100, 80, 65, 
-60, 66, 80, 100, 127, 154, 174, 187, 193, 189, 177, 159, 133, 106, 84, 68, 60, 63, 77, 94, 
-120, 148, 169, 185, 193, 191, 181, 164, 141, 113, 91, 74, 63, 63, 74, 91, 115, 143, 166, 183, 
-193, 193, 184, 169, 147, 119, 95, 77, 64, 61, 70, 86, 108, 136, 160, 178, 190, 194, 187, 173, 
-153, 126, 100, 80, 66, 61, 67, 82, 101, 128, 155, 174, 187, 193, 189, 176, 158, 132, 105, 83, 
-67, 60, 64, 77, 94, 120, 148, 169, 184, 192, 190, 179, 162, 139, 110, 88, 71, 60, 61, 72, 
-90, 113, 142, 165, 181, 191, 191, 182, 167, 145, 117, 92, 74, 63, 60, 69, 85, 108, 136, 160, 
-178, 190, 193, 186, 172, 152, 124, 98, 79, 65, 61, 67, 82, 102, 129, 155, 175, 187, 193, 189, 
-176, 157, 131, 104, 83, 68, 60, 65, 78, 96, 122, 150, 170, 185, 193, 190, 179, 163, 139, 110, 
-88, 71, 60, 61, 73, 90, 114, 142, 164, 180, 189, 189, 180, 165, 143, 115, 91, 73, 63, 62, 
-71, 87, 110, 139, 163, 182, 194, 197, 189, 175, 154, 125, 100, 80, 66, 61, 68, 83, 103, 131, 
-157, 177, 190, 195, 191, 178, 159, 133, 105, 84, 68, 61, 66, 80, 99, 125, 152, 173, 188, 195, 
-193, 182, 165, 141, 112, 89, 72, 62, 63, 75, 93, 116, 145, 168, 184, 194, 193, 184, 169, 146, 
-117, 93, 75, 63, 61, 71, 87, 109, 138, 162, 181, 192, 194, 187, 172, 151, 123, 97, 78, 64, 
-59, 67, 82, 102, 129, 156, 175, 188, 193, 188, 175, 156, 130, 102, 81, 66, 59, 64, 77, 96, 
-122, 150, 170, 185, 193, 190, 179, 161, 136, 108, 86, 69, 59, 61, 73, 91, 115, 143, 167, 183, 
-192, 192, 182, 166, 144, 115, 91, 74, 62, 60, 70, 86, 109, 138, 162, 180, 191, 193, 185, 171, 
-150, 121, 96, 77, 64, 60, 67, 82, 102, 130, 157, 176, 189, 194, 188, 175, 155, 129, 101, 81, 
-66, 60, 65, 78, 96, 123, 152, 173, 188, 195, 192, 180, 161, 134, 104, 82, 65, 55, 58, 70, 
-82, 88, 89, 92, 104, 109, 109, 125, 141, 140, 151, 169, 172, 173, 181, 185, 184, 185, 188, 187, 
-186, 179, 177, 175, 168, 158, 160, 151, 132, 124, 124, 86, 69, 65, 86, 122, 127, 133, 167, 181, 
-183, 162, 130, 129, 121, 107, 101, 102, 92, 86, 85, 84, 80, 80, 80, 76, 74, 75, 79, 86, 
-87, 89, 94, 98, 98, 108, 116, 116, 123, 139, 142, 143, 155, 163, 162, 169, 177, 177, 178, 181, 
-182, 181, 183, 185, 184, 182, 176, 174, 172, 167, 162, 162, 156, 145, 143, 140, 126, 120, 120, 106, 
-89, 89, 85, 76, 72, 73, 68, 67, 67, 71, 77, 80, 82, 93, 101, 100, 112, 132, 133, 139, 
-158, 166, 165, 172, 178, 178, 178, 182, 182, 182, 176, 173, 171, 166, 155, 155, 149, 132, 119, 122, 
-92, 66, 61, 72, 111, 123, 123, 153, 174, 177, 162, 127, 124, 119, 105, 96, 98, 90, 82, 81, 
-81, 76, 76, 77, 74, 71, 72, 74, 81, 83, 85, 90, 94, 93, 101, 111, 112, 115, 131, 138, 
-138, 149, 157, 156, 159, 168, 171, 170, 173, 175, 174, 175, 179, 178, 177, 171, 169, 168, 164, 159, 
-158, 155, 144, 140, 139, 127, 118, 119, 110, 92, 89, 88, 79, 73, 75, 71, 69, 69, 71, 78, 
-82, 83, 92, 102, 102, 111, 130, 134, 136, 153, 164, 163, 169, 175, 176, 176, 180, 179, 179, 175, 
-171, 169, 166, 155, 153, 150, 134, 120, 123, 104, 72, 66, 69, 103, 123, 122, 147, 171, 175, 167, 
-133, 124, 122, 110, 98, 99, 93, 84, 83, 83, 79, 78, 79, 77, 73, 74, 75, 82, 85, 86, 
-90, 95, 95, 100, 111, 114, 115, 129, 139, 138, 146, 157, 159, 160, 169, 173, 172, 175, 178, 177, 
-178, 181, 181, 180, 175, 171, 170, 167, 162, 160, 158, 148, 142, 143, 134, 122, 122, 117, 98, 91, 
-91, 82, 76, 77, 75, 71, 71, 72, 78, 83, 83, 91, 101, 103, 108, 127, 135, 135, 149, 164, 
-164, 168, 175, 177, 176, 179, 180, 180, 177, 171, 170, 168, 159, 152, 152, 138, 122, 121, 111, 75, 
-66, 64, 93, 120, 119, 135, 163, 169, 167, 138, 121, 121, 111, 99, 98, 95, 86, 83, 84, 81, 
-79, 80, 79, 75, 75, 76, 82, 86, 86, 90, 95, 96, 98, 109, 114, 115, 126, 137, 137, 142, 
-154, 158, 157, 166, 172, 172, 174, 177, 176, 176, 179, 180, 179, 176, 171, 170, 167, 162, 160, 159, 
-150, 142, 142, 137, 124, 122, 120, 104, 93, 94, 87, 79, 79, 79, 74, 74, 74, 79, 84, 85, 
-90, 101, 104, 106, 122, 135, 134, 144, 160, 163, 164, 172, 174, 173, 175, 178, 177, 175, 170, 168, 
-166, 159, 151, 152, 142, 125, 121, 119, 86, 70, 68, 90, 120, 122, 131, 161, 171, 172, 149, 125, 
-125, 115, 103, 100, 100, 90, 86, 86, 85, 81, 82, 81, 78, 77, 78, 83, 88, 89, 92, 97, 
-99, 100, 110, 116, 116, 124, 138, 140, 142, 153, 159, 158, 165, 172, 172, 173, 177, 177, 176, 178, 
-180, 179, 177, 172, 170, 168, 164, 160, 160, 153, 144, 142, 139, 127, 122, 121, 106, 93, 93, 89, 
-80, 77, 78, 74, 72, 72, 77, 83, 84, 87, 97, 103, 103, 115, 130, 130, 137, 153, 158, 158, 
-164, 168, 168, 169, 172, 171, 171, 166, 164, 162, 157, 149, 149, 143, 128, 120, 121, 92, 75, 71, 
-84, 115, 122, 126, 152, 167, 170, 156, 129, 126, 120, 109, 102, 104, 96, 90, 90, 90, 86, 86, 
-86, 83, 81, 82, 85, 91, 92, 94, 98, 101, 101, 109, 117, 117, 122, 135, 139, 140, 149, 157, 
-156, 161, 168, 169, 169, 172, 174, 173, 174, 176, 176, 174, 169, 167, 166, 162, 158, 157, 153, 143, 
-141, 139, 128, 121, 122, 112, 97, 96, 93, 85, 81, 83, 79, 77, 77, 80, 86, 88, 89, 98, 
-105, 105, 114, 131, 133, 137, 153, 161, 160, 165, 171, 171, 171, 174, 174, 174, 169, 166, 165, 162, 
-153, 152, 149, 135, 122, 125, 103, 79, 74, 80, 112, 125, 125, 147, 168, 171, 161, 132, 126, 123, 
-112, 103, 104, 99, 92, 90, 90, 87, 86, 87, 84, 81, 82, 84, 90, 92, 93, 97, 101, 101, 
-107, 115, 117, 119, 131, 138, 138, 146, 154, 153, 155, 162, 165, 164, 167, 169, 168, 169, 171, 171, 
-170, 166, 163, 162, 159, 155, 154, 152, 143, 139, 138, 130, 121, 122, 116, 100, 96, 96, 89, 84, 
-85, 82, 80, 80, 81, 86, 90, 90, 97, 106, 107, 113, 130, 135, 136, 149, 160, 159, 163, 169, 
-170, 169, 172, 173, 173, 169, 165, 164, 162, 154, 150, 149, 136, 124, 125, 112, 85, 78, 79, 105, 
-124, 124, 142, 164, 168, 164, 137, 126, 125, 116, 106, 106, 102, 94, 92, 92, 90, 88, 89, 87, 
-84, 84, 85, 90, 93, 94, 97, 101, 102, 105, 114, 118, 118, 128, 138, 137, 143, 153, 155, 155, 
-163, 167, 166, 168, 170, 170, 170, 173, 173, 173, 169, 165, 164, 162, 158, 156, 154, 146, 141, 141, 
-134, 124, 123, 121, 106, 98, 99, 92, 86, 86, 85, 82, 81, 82, 87, 91, 91, 97, 106, 108, 
-111, 126, 135, 134, 145, 158, 159, 162, 168, 170, 169, 171, 173, 172, 170, 166, 164, 162, 156, 150, 
-150, 139, 126, 124, 118, 89, 78, 76, 96, 121, 122, 132, 155, 160, 161, 139, 123, 122, 115, 105, 
-103, 102, 94, 92, 92, 90, 88, 89, 88, 85, 84, 85, 89, 93, 94, 97, 101, 102, 103, 111, 
-116, 117, 125, 135, 135, 139, 148, 152, 151, 157, 163, 163, 164, 167, 167, 167, 170, 171, 170, 168, 
-164, 163, 161, 157, 154, 154, 147, 141, 140, 137, 127, 123, 122, 109, 100, 101, 96, 89, 89, 89, 
-85, 84, 85, 88, 93, 94, 97, 106, 109, 110, 122, 133, 133, 140, 153, 157, 158, 164, 166, 166, 
-167, 169, 168, 168, 163, 161, 160, 154, 147, 148, 141, 128, 122, 122, 97, 82, 79, 94, 120, 123, 
-129, 153, 163, 165, 149, 127, 126, 119, 109, 105, 106, 98, 94, 94, 93, 90, 91, 91, 88, 86, 
-87, 90, 95, 96, 98, 102, 104, 105, 113, 119, 119, 124, 136, 138, 139, 148, 154, 153, 157, 164, 
-165, 165, 168, 168, 168, 169, 171, 170, 169, 164, 163, 161, 158, 155, 155, 150, 142, 140, 138, 129, 
-123, 123, 113, 101, 101, 98, 91, 88, 89, 85, 84, 83, 86, 91, 93, 94, 102, 107, 107, 116, 
-129, 130, 134, 147, 152, 152, 157, 161, 161, 161, 164, 164, 163, 159, 157, 156, 153, 145, 145, 141, 
-129, 121, 123, 102, 85, 82, 90, 115, 123, 125, 145, 159, 161, 153, 129, 126, 122, 113, 107, 109, 
-104, 98, 98, 97, 95, 94, 95, 92, 90, 91, 93, 98, 99, 100, 103, 106, 107, 112, 119, 120, 
-122, 133, 137, 138, 144, 151, 151, 154, 161, 162, 162, 164, 166, 165, 166, 168, 168, 166, 163, 161, 
-160, 157, 153, 152, 150, 142, 139, 138, 129, 123, 123, 117, 104, 102, 101, 94, 90, 91, 89, 87, 
-87, 89, 93, 95, 96, 103, 109, 109, 116, 130, 132, 135, 147, 154, 154, 158, 162, 163, 163, 165, 
-166, 165, 162, 159, 158, 156, 148, 147, 145, 135, 124, 126, 111, 89, 85, 88, 112, 125, 125, 141, 
-159, 163, 157, 133, 127, 125, 116, 108, 109, 105, 99, 97, 97, 95, 94, 95, 93, 90, 91, 92, 
-96, 98, 100, 103, 106, 106, 110, 117, 120, 121, 130, 137, 137, 142, 150, 146, 144, 149, 151, 150, 
-152, 153, 153, 154, 155, 155, 155, 152, 150, 150, 148, 145, 144, 143, 137, 134, 134, 129, 122, 122, 
-119, 109, 105, 105, 100, 96, 96, 95, 93, 93, 94, 97, 100, 101, 105, 111, 112, 115, 126, 131, 
-131, 140, 148, 149, 152, 155, 157, 156, 158, 159, 159, 157, 154, 153, 152, 147, 144, 143, 135, 126, 
-126, 120, 100, 94, 93, 110, 125, 125, 136, 152, 155, 154, 137, 127, 127, 121, 114, 113, 111, 105, 
-104, 104, 102, 101, 101, 101, 98, 98, 98, 101, 104, 104, 107, 109, 110, 112, 118, 121, 121, 127, 
-134, 135, 138, 145, 147, 147, 151, 155, 155, 155, 157, 157, 157, 159, 159, 159, 157, 154, 153, 152, 
-149, 147, 147, 142, 137, 137, 133, 126, 125, 124, 114, 108, 108, 104, 99, 100, 99, 97, 96, 97, 
-99, 103, 103, 106, 113, 115, 116, 126, 133, 133, 139, 148, 150, 151, 156, 157, 157, 158, 159, 159, 
-158, 155, 153, 151, 146, 142, 143, 137, 128, 126, 124, 107, 99, 97, 108, 124, 126, 137, 180, 217, 
-233, 246, 248, 224, 210, 203, 193, 178, 146, 120, 103, 91, 80, 66, 67, 73, 84, 95, 109, 129, 
-141, 153, 155, 156, 153, 147, 135, 125, 108, 88, 73, 62, 59, 60, 67, 77, 93, 121, 149, 165, 
-176, 185, 201, 202, 197, 186, 179, 173, 155, 142, 128, 125, 128, 132, 137, 148, 162, 183, 200, 211, 
-219, 225, 229, 224, 218, 206, 188, 163, 146, 131, 122, 112, 109, 114, 122, 131, 136, 152, 164, 175, 
-177, 171, 168, 162, 154, 132, 97, 74, 58, 46, 33, 21, 27, 35, 50, 62, 81, 100, 114, 124, 
-134, 138, 134, 128, 118, 114, 97, 84, 71, 68, 79, 84, 91, 99, 118, 154, 179, 195, 207, 216, 
-228, 223, 217, 202, 189, 170, 149, 135, 124, 114, 108, 112, 119, 130, 136, 151, 165, 176, 182, 171, 
-165, 159, 152, 132, 84, 53, 39, 27, 35, 63, 71, 82, 89, 118, 158, 178, 190, 201, 188, 169, 
-163, 155, 145, 122, 95, 78, 67, 59, 46, 40, 45, 52, 64, 75, 94, 109, 123, 128, 130, 128, 
-125, 115, 105, 94, 75, 61, 50, 44, 44, 47, 54, 65, 86, 116, 136, 152, 162, 178, 187, 182, 
-175, 163, 158, 143, 127, 113, 105, 106, 110, 115, 125, 139, 161, 185, 200, 213, 220, 228, 225, 218, 
-206, 189, 163, 140, 123, 111, 101, 95, 100, 106, 119, 124, 138, 154, 166, 174, 169, 166, 160, 153, 
-138, 105, 77, 60, 47, 37, 22, 23, 30, 42, 55, 71, 93, 108, 121, 129, 138, 136, 131, 121, 
-116, 103, 87, 75, 65, 72, 80, 85, 93, 106, 137, 168, 187, 202, 210, 223, 225, 218, 207, 192, 
-176, 153, 138, 124, 115, 105, 107, 112, 124, 131, 142, 160, 172, 182, 177, 167, 163, 155, 144, 104, 
-64, 46, 32, 29, 54, 68, 76, 85, 101, 142, 171, 186, 198, 197, 176, 168, 161, 152, 134, 106, 
-86, 73, 63, 53, 41, 44, 49, 61, 72, 90, 108, 122, 132, 135, 134, 130, 124, 112, 103, 84, 
-69, 57, 49, 47, 48, 54, 64, 81, 109, 134, 152, 164, 175, 191, 189, 184, 172, 165, 155, 137, 
-123, 110, 108, 110, 114, 122, 134, 152, 177, 195, 208, 216, 225, 226, 220, 212, 196, 175, 148, 130, 
-115, 106, 96, 98, 103, 114, 122, 132, 150, 162, 174, 174, 170, 165, 158, 148, 123, 89, 68, 52, 
-42, 28, 22, 28, 38, 53, 66, 88, 106, 121, 130, 141, 142, 138, 130, 121, 114, 96, 84, 71, 
-70, 79, 84, 92, 102, 125, 160, 182, 198, 209, 220, 228, 222, 214, 199, 185, 164, 145, 129, 120, 
-109, 107, 111, 120, 131, 139, 157, 170, 182, 183, 173, 169, 162, 155, 126, 82, 57, 42, 31, 43, 
-66, 73, 84, 94, 127, 163, 182, 195, 203, 186, 173, 167, 159, 146, 119, 94, 79, 67, 59, 45, 
-43, 48, 58, 70, 83, 105, 120, 133, 137, 139, 135, 131, 120, 111, 94, 76, 63, 52, 48, 48, 
-53, 61, 75, 98, 128, 148, 163, 172, 189, 192, 187, 178, 167, 162, 143, 129, 115, 110, 112, 115, 
-121, 131, 147, 170, 191, 205, 215, 223, 228, 224, 217, 204, 187, 160, 140, 124, 113, 103, 99, 104, 
-112, 124, 130, 145, 159, 171, 176, 173, 169, 163, 155, 137, 103, 76, 59, 46, 35, 23, 27, 34, 
-49, 62, 81, 102, 119, 130, 139, 145, 141, 136, 124, 119, 103, 87, 74, 66, 74, 79, 85, 94, 
-111, 144, 172, 189, 203, 212, 224, 222, 215, 202, 188, 170, 147, 132, 119, 110, 102, 106, 113, 126, 
-134, 150, 166, 178, 187, 180, 174, 168, 160, 146, 104, 69, 51, 38, 37, 60, 70, 80, 89, 112, 
-151, 176, 190, 203, 195, 179, 174, 165, 156, 134, 106, 86, 73, 63, 51, 43, 48, 54, 68, 79, 
-101, 118, 133, 141, 143, 142, 138, 129, 117, 105, 85, 69, 56, 50, 47, 50, 57, 69, 88, 118, 
-142, 158, 170, 183, 194, 190, 183, 170, 165, 150, 132, 117, 107, 106, 109, 114, 123, 137, 157, 181, 
-197, 211, 218, 226, 224, 218, 208, 193, 168, 144, 128, 114, 105, 96, 100, 106, 118, 126, 139, 157, 
-169, 179, 177, 174, 169, 163, 149, 119, 87, 66, 49, 38, 22, 20, 28, 41, 56, 73, 97, 115, 
-130, 141, 151, 149, 144, 132, 127, 131, 132, 132, 131, 142, 153, 153, 155, 154, 166, 176, 177, 176, 
-175, 181, 184, 183, 182, 181, 184, 184, 183, 182, 179, 174, 173, 171, 171, 167, 159, 156, 155, 154, 
-146, 130, 129, 126, 129, 107, 84, 82, 82, 83, 108, 128, 129, 131, 133, 159, 170, 171, 171, 167, 
-141, 129, 128, 127, 124, 111, 108, 107, 108, 104, 96, 95, 95, 96, 94, 91, 92, 92, 93, 90, 
-88, 88, 89, 89, 94, 97, 98, 99, 100, 104, 106, 107, 108, 109, 119, 122, 123, 123, 127, 139, 
-142, 143, 142, 146, 155, 157, 157, 156, 160, 167, 167, 167, 165, 168, 169, 169, 168, 167, 169, 170, 
-170, 169, 167, 163, 160, 159, 158, 157, 152, 150, 149, 149, 146, 137, 134, 133, 133, 128, 117, 116, 
-115, 116, 108, 93, 92, 91, 92, 86, 80, 80, 80, 82, 79, 77, 78, 79, 80, 86, 88, 90, 
-90, 93, 103, 106, 107, 107, 112, 129, 133, 134, 133, 140, 155, 157, 158, 156, 161, 166, 166, 166, 
-164, 167, 168, 168, 167, 166, 162, 159, 155, 153, 152, 145, 141, 140, 139, 137, 121, 116, 114, 116, 
-106, 79, 73, 73, 72, 86, 113, 116, 120, 118, 133, 154, 157, 157, 158, 139, 120, 118, 116, 117, 
-106, 100, 99, 99, 99, 92, 88, 89, 89, 90, 87, 86, 87, 88, 87, 84, 84, 85, 85, 88, 
-93, 94, 96, 96, 100, 104, 105, 106, 106, 112, 119, 120, 121, 121, 131, 138, 139, 139, 140, 149, 
-153, 153, 153, 154, 161, 163, 163, 162, 163, 166, 166, 165, 164, 165, 167, 167, 166, 165, 163, 159, 
-158, 157, 156, 153, 149, 149, 148, 147, 139, 134, 133, 133, 132, 122, 117, 116, 117, 114, 99, 95, 
-94, 95, 92, 85, 84, 84, 85, 83, 81, 81, 82, 82, 86, 90, 91, 93, 93, 100, 107, 108, 
-109, 110, 123, 132, 133, 134, 135, 149, 155, 156, 155, 157, 163, 164, 164, 163, 164, 166, 167, 166, 
-165, 163, 159, 158, 156, 156, 151, 145, 144, 143, 142, 130, 120, 120, 118, 119, 95, 79, 77, 77, 
-80, 107, 121, 123, 123, 129, 153, 161, 162, 163, 152, 127, 122, 119, 121, 114, 105, 104, 103, 104, 
-100, 93, 93, 93, 94, 91, 90, 90, 91, 91, 89, 87, 88, 88, 90, 94, 97, 98, 98, 100, 
-104, 105, 106, 106, 109, 117, 119, 120, 120, 126, 136, 137, 138, 137, 144, 151, 151, 151, 151, 157, 
-161, 161, 161, 160, 162, 164, 163, 163, 163, 165, 167, 166, 165, 163, 160, 158, 157, 156, 154, 150, 
-149, 148, 148, 144, 137, 136, 134, 135, 129, 121, 120, 119, 120, 109, 100, 99, 99, 99, 92, 89, 
-89, 90, 90, 87, 86, 87, 88, 89, 94, 96, 97, 97, 101, 109, 111, 112, 112, 120, 132, 134, 
-135, 134, 144, 154, 155, 155, 154, 159, 162, 162, 162, 161, 163, 164, 164, 163, 162, 158, 156, 155, 
-155, 152, 145, 143, 142, 142, 138, 123, 121, 118, 121, 107, 85, 81, 81, 81, 99, 121, 122, 126, 
-125, 145, 159, 161, 161, 159, 136, 125, 123, 122, 121, 111, 107, 106, 107, 105, 98, 96, 96, 97, 
-96, 94, 94, 94, 95, 93, 91, 91, 92, 92, 96, 99, 102, 106, 106, 109, 111, 112, 113, 113, 
-119, 123, 123, 123, 125, 133, 136, 136, 136, 138, 145, 146, 147, 146, 148, 153, 154, 154, 153, 154, 
-156, 156, 155, 155, 156, 157, 157, 156, 156, 153, 151, 150, 150, 149, 146, 144, 144, 143, 142, 136, 
-134, 133, 133, 131, 123, 122, 121, 122, 117, 107, 105, 105, 106, 104, 99, 98, 98, 99, 98, 96, 
-96, 97, 97, 100, 103, 104, 105, 106, 112, 116, 116, 117, 119, 130, 134, 135, 135, 137, 148, 151, 
-151, 151, 152, 157, 157, 157, 156, 157, 158, 158, 158, 157, 155, 152, 151, 151, 150, 146, 142, 141, 
-140, 139, 129, 123, 122, 122, 119, 99, 92, 91, 90, 97, 118, 123, 126, 124, 134, 150, 154, 154, 
-154, 144, 127, 125, 123, 124, 117, 111, 110, 110, 110, 106, 102, 102, 102, 103, 101, 100, 101, 101, 
-101, 99, 98, 99, 100, 102, 105, 107, 107, 108, 109, 112, 113, 114, 114, 118, 124, 124, 125, 125, 
-131, 137, 138, 139, 139, 145, 149, 149, 149, 149, 154, 156, 157, 156, 155, 131, 92, 66, 63, 86, 
-130, 171, 193, 193, 167, 122, 83, 64, 69, 96, 137, 172, 185, 177, 142, 98, 68, 58, 70, 97, 
-134, 160, 166, 151, 110, 67, 42, 40, 60, 92, 128, 148, 148, 126, 86, 50, 34, 40, 69, 112, 
-145, 158, 150, 126, 91, 61, 53, 66, 105, 152, 179, 186, 171, 144, 110, 86, 85, 106, 148, 188, 
-210, 208, 183, 144, 108, 91, 97, 123, 160, 192, 205, 197, 164, 120, 87, 75, 90, 119, 152, 178, 
-182, 167, 118, 67, 39, 37, 60, 114, 164, 185, 185, 162, 136, 107, 90, 97, 122, 148, 176, 187, 
-178, 144, 97, 65, 54, 69, 101, 138, 165, 171, 154, 114, 71, 45, 44, 69, 108, 145, 165, 163, 
-139, 102, 66, 49, 57, 88, 132, 165, 178, 170, 140, 103, 75, 66, 81, 118, 165, 192, 198, 181, 
-148, 114, 91, 90, 111, 153, 193, 211, 210, 185, 148, 114, 97, 103, 131, 173, 204, 215, 206, 174, 
-132, 101, 92, 106, 139, 176, 199, 203, 187, 148, 105, 81, 79, 101, 138, 168, 184, 181, 157, 112, 
-69, 51, 58, 89, 128, 157, 169, 160, 128, 85, 51, 41, 58, 96, 139, 166, 171, 154, 118, 83, 
-60, 60, 84, 127, 171, 192, 191, 164, 128, 99, 83, 91, 121, 165, 200, 213, 202, 167, 127, 98, 
-89, 104, 139, 177, 201, 205, 187, 149, 106, 80, 79, 103, 141, 170, 186, 182, 158, 112, 63, 42, 
-50, 82, 131, 177, 190, 182, 147, 115, 95, 87, 103, 141, 171, 187, 191, 171, 132, 87, 61, 59, 
-83, 124, 158, 175, 173, 145, 102, 64, 46, 54, 89, 131, 161, 172, 162, 128, 87, 59, 51, 69, 
-108, 150, 176, 181, 162, 123, 87, 67, 67, 93, 134, 175, 196, 194, 167, 126, 97, 82, 91, 123, 
-165, 199, 210, 200, 166, 125, 97, 89, 105, 141, 182, 207, 211, 192, 153, 113, 89, 88, 111, 151, 
-186, 202, 198, 171, 130, 91, 73, 81, 112, 153, 179, 187, 176, 143, 99, 61, 51, 68, 107, 146, 
-166, 169, 149, 111, 70, 45, 46, 72, 115, 153, 172, 168, 142, 101, 70, 57, 68, 100, 143, 181, 
-195, 184, 149, 109, 85, 80, 98, 135, 176, 205, 209, 188, 148, 109, 87, 88, 112, 152, 187, 203, 
-198, 170, 129, 90, 72, 81, 114, 156, 182, 187, 175, 140, 98, 56, 43, 60, 98, 142, 179, 186, 
-167, 128, 92, 79, 84, 110, 152, 184, 191, 184, 154, 113, 75, 56, 65, 98, 140, 170, 178, 164, 
-129, 87, 55, 48, 68, 108, 149, 171, 174, 153, 113, 73, 53, 56, 83, 126, 163, 182, 177, 150, 
-107, 73, 62, 74, 107, 150, 183, 197, 185, 150, 108, 82, 79, 98, 136, 176, 202, 206, 186, 146, 
-106, 86, 88, 115, 156, 192, 209, 204, 174, 132, 97, 81, 91, 124, 166, 194, 201, 188, 152, 110, 
-80, 71, 89, 126, 167, 187, 185, 164, 125, 84, 57, 56, 82, 124, 161, 173, 166, 138, 95, 59, 
-43, 55, 89, 132, 164, 174, 162, 128, 85, 58, 57, 78, 117, 157, 185, 191, 171, 132, 92, 76, 
-84, 111, 153, 189, 208, 203, 173, 130, 96, 84, 96, 128, 170, 200, 206, 191, 155, 113, 83, 75, 
-93, 128, 167, 189, 186, 163, 122, 83, 55, 51, 78, 120, 158, 181, 181, 152, 110, 74, 66, 82, 
-117, 161, 191, 193, 174, 137, 94, 65, 56, 75, 114, 155, 178, 178, 154, 113, 74, 52, 55, 83, 
-125, 162, 177, 170, 140, 97, 62, 50, 64, 99, 142, 173, 182, 169, 132, 90, 62, 60, 81, 122, 
-162, 186, 191, 170, 129, 90, 70, 77, 106, 149, 185, 201, 197, 166, 123, 89, 76, 89, 124, 167, 
-196, 205, 190, 153, 111, 82, 77, 96, 136, 176, 198, 198, 174, 132, 93, 72, 73, 101, 143, 179, 
-193, 183, 151, 108, 74, 59, 67, 102, 145, 174, 180, 163, 126, 83, 55, 50, 71, 112, 152, 175, 
-177, 154, 113, 74, 54, 61, 92, 135, 171, 187, 184, 154, 112, 78, 67, 84, 121, 164, 193, 202, 
-188, 150, 108, 80, 77, 99, 139, 179, 202, 201, 175, 133, 93, 72, 76, 104, 147, 182, 196, 184, 
-150, 107, 74, 60, 66, 100, 140, 168, 176, 169, 135, 97, 71, 72, 99, 139, 175, 195, 190, 162, 
-122, 86, 68, 65, 65, 65, 66, 67, 67, 67, 69, 70, 71, 72, 73, 73, 74, 75, 76, 76, 
-76, 77, 78, 80, 81, 81, 81, 82, 83, 83, 85, 86, 88, 90, 92, 93, 94, 97, 99, 100, 
-102, 102, 105, 107, 108, 109, 110, 112, 113, 114, 115, 116, 117, 118, 118, 119, 119, 120, 121, 122, 
-122, 122, 122, 122, 122, 123, 123, 122, 123, 123, 124, 123, 123, 123, 123, 123, 122, 121, 121, 121, 
-121, 118, 117, 117, 118, 118, 116, 116, 116, 117, 117, 116, 117, 117, 118, 119, 120, 120, 121, 121, 
-123, 125, 126, 126, 127, 130, 132, 133, 133, 134, 137, 139, 139, 139, 140, 141, 142, 142, 142, 142, 
-142, 143, 143, 142, 142, 141, 141, 141, 141, 140, 139, 138, 138, 138, 136, 133, 133, 133, 133, 128, 
-124, 123, 123, 124, 130, 134, 135, 135, 136, 142, 144, 144, 145, 143, 137, 136, 135, 135, 134, 132, 
-131, 131, 132, 131, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 128, 129, 129, 129, 130, 131, 
-131, 131, 132, 132, 133, 133, 133, 134, 135, 135, 135, 135, 136, 137, 138, 138, 138, 139, 140, 140, 
-140, 140, 140, 141, 141, 141, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 139, 139, 139, 
-139, 139, 138, 138, 138, 138, 138, 137, 137, 136, 136, 136, 135, 135, 135, 135, 133, 132, 132, 132, 
-132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 133, 133, 134, 135, 135, 136, 135, 
-136, 138, 138, 138, 138, 139, 140, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 
-141, 140, 140, 140, 140, 139, 138, 138, 138, 138, 136, 135, 135, 135, 134, 131, 130, 130, 130, 132, 
-134, 135, 135, 135, 137, 139, 139, 139, 139, 137, 134, 134, 134, 134, 132, 132, 132, 132, 131, 131, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 130, 130, 130, 130, 130, 131, 131, 
-131, 131, 131, 132, 133, 133, 133, 134, 135, 136, 136, 136, 136, 137, 137, 137, 137, 137, 138, 138, 
-138, 138, 138, 138, 139, 138, 138, 136, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 132, 132, 132, 132, 
-132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 
-129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 128, 129, 128, 129, 128, 129, 128, 136, 164, 185, 210, 228, 239, 241, 232, 215, 
-190, 165, 148, 138, 140, 150, 166, 189, 206, 215, 216, 208, 193, 169, 147, 131, 123, 125, 136, 155, 
-180, 199, 211, 212, 202, 184, 157, 132, 116, 108, 112, 126, 149, 177, 197, 209, 208, 197, 176, 147, 
-120, 103, 95, 101, 116, 142, 172, 193, 204, 203, 190, 167, 134, 108, 90, 84, 92, 109, 138, 168, 
-188, 198, 195, 181, 156, 125, 99, 82, 76, 85, 104, 134, 165, 184, 193, 189, 175, 149, 116, 90, 
-73, 70, 81, 101, 133, 162, 180, 188, 183, 167, 140, 107, 83, 67, 66, 77, 99, 130, 158, 176, 
-183, 177, 161, 134, 101, 78, 63, 63, 76, 98, 130, 157, 174, 180, 172, 155, 126, 94, 72, 59, 
-61, 75, 99, 131, 156, 172, 177, 169, 151, 122, 90, 69, 56, 59, 74, 99, 131, 157, 172, 175, 
-166, 147, 116, 86, 65, 54, 59, 75, 101, 134, 158, 172, 173, 164, 144, 113, 84, 64, 54, 60, 
-77, 104, 136, 159, 172, 172, 162, 141, 110, 81, 62, 54, 61, 78, 106, 138, 160, 172, 171, 159, 
-137, 104, 77, 59, 51, 60, 78, 108, 140, 161, 172, 171, 159, 136, 103, 76, 58, 52, 62, 81, 
-112, 143, 162, 172, 169, 155, 131, 97, 71, 55, 51, 62, 83, 113, 143, 162, 172, 168, 154, 129, 
-96, 71, 55, 52, 64, 86, 118, 147, 165, 173, 168, 153, 126, 93, 70, 55, 54, 67, 91, 123, 
-151, 168, 175, 169, 153, 125, 93, 70, 55, 56, 71, 95, 128, 155, 172, 177, 170, 153, 123, 91, 
-69, 56, 59, 74, 99, 132, 158, 174, 177, 169, 150, 121, 90, 69, 57, 60, 75, 101, 135, 160, 
-174, 177, 168, 149, 118, 87, 67, 57, 62, 78, 106, 139, 162, 176, 177, 167, 146, 114, 84, 65, 
-56, 62, 80, 108, 141, 164, 177, 177, 166, 144, 112, 83, 64, 56, 64, 83, 112, 145, 166, 178, 
-177, 165, 141, 108, 81, 63, 57, 67, 86, 117, 147, 168, 179, 177, 164, 140, 107, 81, 63, 59, 
-69, 89, 121, 151, 171, 181, 178, 163, 138, 105, 79, 63, 60, 72, 93, 125, 154, 173, 181, 177, 
-162, 136, 102, 77, 61, 59, 71, 94, 127, 156, 175, 182, 177, 161, 132, 99, 75, 60, 60, 74, 
-98, 131, 160, 176, 182, 175, 157, 127, 95, 73, 59, 60, 74, 99, 132, 159, 176, 181, 173, 155, 
-125, 93, 72, 59, 62, 77, 103, 137, 163, 178, 182, 173, 153, 122, 91, 70, 59, 65, 80, 106, 
-140, 165, 180, 183, 173, 153, 121, 91, 70, 60, 66, 83, 112, 146, 170, 184, 185, 174, 152, 119, 
-90, 70, 61, 69, 88, 117, 150, 172, 184, 184, 172, 150, 117, 88, 69, 62, 71, 89, 120, 152, 
-173, 185, 183, 170, 146, 113, 86, 68, 63, 73, 93, 124, 155, 175, 186, 182, 168, 144, 111, 84, 
-66, 62, 73, 94, 125, 156, 176, 186, 182, 167, 140, 107, 81, 65, 62, 75, 97, 130, 159, 178, 
-186, 180, 164, 136, 103, 79, 64, 64, 76, 99, 132, 161, 179, 186, 180, 163, 134, 102, 78, 64, 
-65, 79, 103, 137, 164, 181, 187, 180, 161, 132, 99, 77, 64, 67, 82, 108, 141, 167, 183, 187, 
-179, 160, 128, 96, 74, 61, 65, 81, 108, 142, 168, 184, 187, 177, 157, 125, 93, 72, 61, 67, 
-84, 112, 146, 171, 185, 187, 176, 155, 122, 91, 70, 60, 67, 84, 113, 147, 170, 184, 184, 173, 
-150, 117, 88, 68, 60, 69, 87, 118, 151, 173, 185, 184, 171, 147, 114, 86, 68, 61, 70, 90, 
-121, 153, 175, 187, 185, 171, 146, 112, 85, 67, 62, 73, 94, 126, 158, 178, 189, 185, 171, 145, 
-110, 84, 67, 64, 76, 97, 130, 160, 180, 190, 185, 170, 142, 108, 83, 67, 65, 78, 100, 134, 
-163, 182, 190, 184, 167, 138, 105, 81, 66, 66, 80, 104, 138, 166, 183, 190, 183, 166, 136, 103, 
-79, 64, 66, 80, 105, 139, 167, 184, 189, 181, 162, 131, 99, 76, 63, 66, 82, 109, 143, 169, 
-185, 189, 179, 160, 129, 97, 75, 63, 68, 84, 111, 145, 170, 186, 188, 178, 157, 125, 94, 73, 
-63, 70, 87, 116, 149, 173, 186, 187, 175, 154, 122, 92, 73, 64, 72, 90, 119, 152, 175, 189, 
-189, 184, 182, 181, 180, 179, 178, 176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 
-163, 163, 162, 161, 160, 159, 159, 158, 157, 156, 155, 154, 153, 152, 151, 151, 150, 149, 148, 148, 
-147, 146, 146, 145, 145, 144, 143, 143, 142, 142, 141, 141, 141, 140, 140, 139, 139, 138, 138, 137, 
-137, 137, 136, 136, 136, 135, 135, 135, 134, 134, 134, 133, 133, 133, 133, 132, 132, 132, 132, 132, 
-132, 132, 132, 132, 131, 131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 128, 128, 128, 128, 127, 
-127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 124, 124, 124, 124, 
-124, 124, 124, 123, 123, 123, 123, 123, 122, 122, 122, 122, 122, 122, 122, 121, 121, 121, 121, 121, 
-121, 121, 121, 121, 121, 121, 121, 121, 121, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
-120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 
-121, 121, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 
-120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 119, 119, 119, 119, 
-119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 
-119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 
-121, 121, 121, 121, 122, 122, 123, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 
-122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 
-123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 122, 122, 122, 122, 122, 122, 122, 122, 
-122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 
-123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 
-124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 
-124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 124, 124, 
-124, 124, 124, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 
-124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 
-125, 125, 125, 125, 125, 125, 125, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 126, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 
-125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-128, 127, 128, 128, 128, 128, 129, 127, 134, 154, 148, 132, 114, 96, 80, 75, 78, 88, 100, 118, 
-145, 159, 162, 166, 157, 132, 114, 91, 45, 19, 10, 30, 59, 69, 104, 146, 168, 170, 152, 148, 
-138, 115, 95, 75, 52, 38, 34, 36, 44, 59, 77, 92, 105, 115, 123, 120, 110, 99, 79, 61, 
-56, 56, 58, 75, 100, 120, 146, 172, 188, 195, 202, 196, 181, 161, 141, 125, 116, 116, 122, 133, 
-147, 170, 190, 199, 205, 203, 185, 165, 143, 110, 83, 70, 55, 43, 56, 70, 86, 107, 121, 127, 
-128, 123, 117, 102, 79, 67, 62, 53, 63, 90, 108, 134, 176, 198, 212, 225, 227, 216, 203, 181, 
-155, 135, 119, 115, 121, 124, 143, 167, 171, 175, 184, 153, 120, 103, 100, 107, 89, 90, 113, 126, 
-134, 121, 134, 158, 160, 162, 164, 148, 126, 104, 72, 47, 31, 24, 25, 39, 58, 87, 114, 133, 
-147, 156, 152, 148, 141, 117, 102, 100, 93, 94, 113, 130, 148, 180, 204, 217, 227, 228, 218, 204, 
-184, 161, 143, 127, 121, 124, 132, 144, 168, 182, 187, 195, 190, 173, 159, 136, 96, 71, 55, 39, 
-37, 49, 61, 84, 107, 127, 142, 147, 147, 146, 132, 113, 107, 98, 89, 103, 119, 133, 159, 188, 
-207, 224, 236, 236, 224, 205, 177, 149, 122, 105, 98, 89, 88, 110, 112, 110, 122, 143, 176, 171, 
-167, 173, 157, 140, 101, 71, 72, 72, 78, 103, 127, 135, 147, 149, 141, 127, 108, 76, 51, 35, 
-31, 38, 51, 70, 95, 121, 143, 164, 173, 173, 177, 167, 146, 132, 121, 109, 112, 124, 136, 156, 
-185, 206, 221, 233, 233, 223, 203, 181, 155, 133, 117, 109, 107, 108, 123, 141, 152, 166, 173, 160, 
-149, 138, 114, 83, 62, 43, 30, 28, 41, 62, 85, 113, 142, 158, 165, 177, 177, 161, 150, 140, 
-125, 117, 120, 126, 139, 156, 179, 197, 207, 213, 213, 199, 180, 160, 129, 96, 85, 66, 42, 46, 
-66, 117, 150, 166, 199, 213, 210, 181, 144, 123, 94, 70, 59, 57, 56, 69, 90, 110, 125, 138, 
-140, 135, 125, 113, 95, 73, 59, 52, 51, 60, 82, 107, 131, 161, 183, 191, 199, 200, 187, 169, 
-151, 134, 121, 118, 122, 133, 152, 177, 201, 214, 220, 221, 211, 194, 173, 146, 117, 99, 88, 78, 
-82, 97, 105, 121, 138, 144, 142, 139, 127, 108, 84, 62, 49, 39, 36, 54, 73, 93, 134, 167, 
-181, 195, 207, 200, 188, 174, 151, 132, 122, 118, 121, 129, 142, 165, 181, 190, 200, 196, 173, 157, 
-135, 85, 54, 40, 54, 74, 82, 118, 159, 187, 194, 179, 179, 170, 149, 129, 104, 74, 54, 43, 
-39, 46, 62, 79, 101, 121, 135, 147, 148, 141, 131, 110, 87, 77, 70, 65, 80, 103, 119, 147, 
-179, 196, 208, 219, 215, 201, 184, 161, 139, 127, 121, 122, 129, 140, 162, 184, 197, 207, 209, 196, 
-179, 162, 130, 99, 83, 62, 46, 54, 64, 78, 102, 120, 130, 136, 135, 130, 119, 99, 80, 71, 
-57, 60, 81, 95, 120, 161, 188, 206, 223, 230, 223, 214, 192, 163, 137, 117, 107, 106, 109, 124, 
-146, 157, 168, 181, 155, 130, 116, 115, 118, 95, 92, 106, 112, 116, 101, 112, 140, 151, 159, 166, 
-157, 140, 121, 93, 62, 40, 26, 19, 29, 46, 72, 102, 126, 145, 158, 159, 157, 150, 131, 110, 
-100, 88, 84, 96, 110, 127, 158, 185, 203, 219, 225, 218, 206, 189, 163, 139, 120, 108, 106, 110, 
-122, 142, 160, 173, 186, 186, 175, 164, 144, 105, 78, 57, 36, 28, 35, 47, 65, 91, 118, 137, 
-146, 151, 152, 140, 123, 113, 98, 85, 92, 102, 114, 135, 163, 187, 206, 221, 227, 221, 205, 182, 
-154, 121, 101, 89, 75, 74, 92, 94, 101, 117, 144, 178, 177, 174, 181, 165, 141, 102, 73, 67, 
-62, 67, 88, 113, 127, 143, 151, 149, 138, 124, 96, 66, 46, 37, 35, 42, 58, 81, 106, 133, 
-158, 170, 176, 182, 175, 156, 139, 123, 107, 103, 108, 118, 135, 159, 186, 207, 223, 228, 223, 206, 
-186, 160, 133, 113, 101, 92, 92, 105, 119, 135, 155, 165, 159, 153, 145, 124, 97, 72, 48, 29, 
-19, 23, 40, 61, 94, 131, 154, 168, 187, 190, 173, 164, 148, 124, 112, 108, 109, 118, 124, 127, 
-126, 123, 121, 122, 115, 111, 111, 102, 87, 89, 75, 50, 44, 50, 81, 93, 97, 123, 137, 140, 
-120, 100, 100, 91, 82, 81, 79, 70, 70, 70, 68, 67, 69, 66, 65, 66, 70, 75, 77, 79, 
-85, 86, 89, 98, 102, 104, 115, 124, 124, 132, 141, 141, 146, 154, 155, 156, 160, 161, 160, 163, 
-165, 164, 161, 158, 157, 154, 150, 150, 146, 137, 136, 133, 123, 118, 118, 104, 95, 95, 89, 82, 
-83, 81, 79, 79, 81, 87, 89, 92, 101, 107, 108, 121, 135, 135, 144, 158, 161, 163, 170, 172, 
-172, 175, 176, 175, 171, 168, 167, 162, 155, 154, 147, 131, 129, 122, 93, 82, 84, 110, 129, 128, 
-151, 169, 174, 161, 135, 132, 126, 114, 110, 109, 101, 98, 98, 95, 93, 94, 92, 89, 89, 92, 
-97, 99, 101, 105, 107, 109, 117, 123, 123, 133, 143, 143, 148, 158, 160, 162, 170, 173, 173, 176, 
-177, 176, 178, 180, 179, 177, 172, 171, 169, 165, 163, 161, 152, 148, 146, 137, 130, 130, 119, 106, 
-105, 101, 94, 93, 93, 90, 89, 90, 95, 98, 99, 106, 114, 114, 123, 137, 138, 144, 159, 162, 
-163, 169, 172, 171, 174, 175, 174, 171, 168, 167, 164, 156, 154, 151, 136, 129, 129, 104, 88, 87, 
-104, 128, 128, 143, 165, 170, 164, 139, 131, 128, 117, 111, 110, 104, 99, 99, 97, 95, 95, 94, 
-91, 91, 92, 97, 100, 101, 105, 108, 108, 115, 122, 122, 128, 139, 141, 144, 154, 157, 158, 165, 
-168, 168, 171, 173, 172, 173, 175, 175, 173, 169, 167, 166, 162, 160, 159, 153, 147, 146, 139, 130, 
-130, 124, 109, 107, 104, 97, 94, 94, 91, 90, 90, 94, 98, 99, 104, 113, 114, 119, 134, 138, 
-141, 155, 161, 162, 167, 171, 171, 173, 174, 174, 172, 168, 166, 164, 156, 154, 151, 138, 128, 129, 
-107, 88, 85, 98, 125, 127, 135, 159, 168, 167, 144, 130, 129, 119, 111, 110, 106, 99, 99, 97, 
-95, 94, 95, 91, 90, 91, 95, 98, 100, 102, 107, 107, 111, 119, 121, 124, 136, 140, 142, 150, 
-156, 155, 159, 163, 163, 165, 167, 167, 168, 170, 170, 169, 165, 163, 162, 159, 156, 155, 149, 143, 
-142, 137, 128, 127, 123, 109, 105, 104, 98, 94, 94, 92, 90, 90, 92, 97, 98, 101, 110, 112, 
-115, 128, 135, 136, 147, 156, 157, 160, 165, 165, 166, 167, 168, 166, 162, 160, 159, 152, 148, 147, 
-138, 125, 126, 112, 90, 85, 91, 117, 125, 129, 151, 162, 163, 144, 128, 127, 119, 110, 109, 106, 
-99, 98, 97, 95, 94, 95, 92, 91, 91, 94, 98, 100, 102, 106, 107, 109, 117, 121, 122, 133, 
-139, 139, 146, 153, 153, 157, 164, 164, 165, 167, 168, 167, 170, 170, 169, 166, 163, 162, 159, 156, 
-155, 151, 143, 142, 139, 130, 126, 125, 112, 105, 105, 99, 93, 94, 92, 89, 89, 91, 96, 97, 
-100, 108, 112, 112, 123, 134, 134, 142, 154, 155, 158, 163, 164, 165, 167, 167, 166, 163, 160, 160, 
-155, 149, 148, 141, 127, 126, 119, 94, 86, 87, 110, 125, 125, 146, 160, 164, 151, 130, 127, 121, 
-112, 109, 108, 100, 99, 98, 97, 96, 97, 95, 94, 94, 96, 100, 101, 103, 106, 107, 108, 114, 
-118, 118, 125, 132, 132, 136, 143, 144, 146, 151, 153, 153, 155, 156, 155, 157, 158, 158, 156, 153, 
-152, 151, 148, 147, 145, 139, 136, 135, 129, 124, 124, 116, 107, 106, 103, 97, 97, 96, 94, 93, 
-94, 97, 100, 101, 106, 111, 112, 119, 129, 130, 135, 145, 147, 149, 153, 155, 155, 156, 157, 157, 
-155, 152, 152, 149, 144, 143, 140, 129, 125, 123, 105, 94, 93, 107, 124, 124, 136, 151, 155, 151, 
-133, 128, 126, 118, 114, 113, 108, 105, 105, 103, 102, 102, 101, 99, 99, 100, 104, 105, 106, 109, 
-111, 112, 117, 122, 122, 127, 135, 136, 139, 146, 147, 148, 154, 156, 156, 158, 159, 158, 159, 161, 
-160, 159, 156, 155, 154, 151, 149, 148, 142, 138, 138, 132, 126, 126, 120, 110, 108, 106, 101, 99, 
-99, 96, 96, 96, 99, 102, 102, 106, 113, 113, 118, 129, 132, 134, 144, 148, 149, 153, 155, 155, 
-156, 157, 158, 156, 153, 154, 180, 207, 227, 241, 240, 225, 182, 140, 122, 120, 138, 140, 150, 161, 
-156, 141, 139, 125, 116, 121, 150, 207, 235, 242, 235, 202, 141, 111, 102, 116, 138, 159, 175, 176, 
-161, 123, 83, 66, 66, 87, 116, 142, 154, 152, 130, 90, 53, 38, 48, 79, 124, 153, 161, 151, 
-123, 90, 66, 62, 78, 115, 159, 178, 181, 164, 140, 120, 103, 106, 124, 164, 202, 214, 210, 187, 
-160, 139, 127, 134, 159, 195, 219, 226, 215, 187, 157, 134, 129, 142, 170, 196, 212, 212, 194, 161, 
-126, 108, 108, 129, 155, 174, 185, 179, 158, 117, 82, 70, 76, 103, 121, 134, 140, 129, 102, 59, 
-29, 23, 41, 74, 103, 121, 123, 106, 76, 50, 35, 39, 62, 100, 138, 152, 149, 126, 102, 92, 
-84, 93, 118, 163, 200, 210, 199, 168, 141, 123, 118, 132, 164, 201, 222, 223, 202, 166, 128, 109, 
-109, 131, 162, 181, 189, 184, 161, 120, 75, 62, 67, 99, 113, 108, 112, 101, 73, 65, 69, 64, 
-85, 114, 171, 207, 210, 191, 156, 100, 69, 70, 89, 120, 135, 143, 137, 115, 81, 49, 38, 46, 
-72, 104, 123, 130, 119, 93, 57, 31, 27, 44, 76, 112, 134, 136, 120, 89, 62, 49, 52, 75, 
-109, 147, 163, 159, 136, 103, 89, 84, 94, 121, 159, 195, 204, 194, 162, 130, 116, 113, 129, 161, 
-198, 220, 221, 200, 162, 131, 116, 118, 141, 177, 203, 211, 204, 176, 139, 107, 95, 104, 131, 163, 
-177, 179, 166, 138, 101, 68, 63, 77, 110, 135, 137, 134, 116, 85, 48, 23, 26, 50, 87, 112, 
-122, 117, 94, 61, 39, 33, 45, 75, 109, 141, 152, 142, 114, 85, 81, 84, 101, 131, 167, 201, 
-205, 187, 153, 125, 116, 120, 143, 177, 211, 226, 217, 188, 152, 121, 108, 117, 145, 178, 193, 192, 
-180, 149, 114, 75, 64, 80, 114, 140, 126, 116, 97, 63, 41, 58, 70, 97, 130, 173, 209, 207, 
-181, 147, 104, 71, 80, 104, 140, 151, 147, 134, 105, 74, 48, 40, 56, 87, 119, 131, 130, 112, 
-80, 47, 27, 31, 57, 93, 123, 139, 134, 110, 77, 53, 49, 61, 92, 126, 154, 167, 155, 127, 
-92, 81, 88, 106, 139, 172, 199, 204, 185, 151, 119, 111, 120, 143, 178, 207, 222, 216, 189, 151, 
-123, 118, 129, 158, 193, 215, 214, 198, 166, 131, 106, 101, 118, 149, 181, 190, 182, 162, 128, 97, 
-73, 72, 94, 128, 155, 149, 135, 109, 74, 44, 27, 37, 68, 105, 126, 128, 114, 84, 50, 30, 
-35, 56, 91, 123, 145, 152, 134, 103, 73, 71, 88, 112, 146, 174, 200, 201, 175, 140, 114, 112, 
-127, 156, 192, 217, 225, 208, 175, 139, 116, 110, 128, 160, 192, 202, 194, 172, 138, 107, 81, 73, 
-98, 131, 161, 148, 119, 90, 54, 29, 48, 80, 113, 150, 175, 206, 202, 171, 137, 110, 80, 91, 
-122, 155, 167, 153, 129, 95, 67, 50, 47, 70, 104, 133, 140, 130, 104, 68, 41, 29, 40, 73, 
-110, 133, 142, 131, 99, 65, 46, 50, 73, 108, 140, 157, 165, 147, 113, 82, 74, 93, 120, 156, 
-182, 198, 199, 172, 137, 110, 109, 128, 159, 194, 214, 221, 206, 171, 135, 114, 115, 136, 171, 203, 
-218, 211, 186, 150, 119, 103, 106, 130, 164, 191, 197, 180, 151, 115, 90, 76, 80, 110, 144, 167, 
-160, 133, 100, 64, 43, 35, 52, 89, 122, 138, 133, 109, 73, 41, 28, 41, 72, 110, 138, 150, 
-150, 125, 91, 65, 65, 93, 126, 162, 182, 193, 191, 159, 126, 105, 108, 134, 170, 204, 221, 219, 
-195, 157, 126, 111, 113, 138, 173, 198, 205, 189, 158, 122, 96, 85, 83, 112, 145, 168, 161, 118, 
-79, 44, 22, 38, 87, 126, 163, 176, 193, 187, 153, 123, 109, 95, 105, 140, 165, 176, 154, 119, 
-83, 60, 52, 58, 87, 122, 144, 147, 126, 91, 56, 35, 34, 54, 92, 126, 142, 142, 123, 87, 
-57, 43, 55, 87, 125, 153, 162, 160, 136, 100, 75, 70, 97, 134, 169, 190, 194, 188, 158, 124, 
-104, 106, 135, 172, 203, 217, 214, 194, 157, 126, 113, 122, 151, 187, 214, 221, 208, 174, 137, 111, 
-106, 116, 144, 177, 195, 196, 173, 137, 102, 82, 82, 94, 126, 155, 169, 162, 136, 109, 77, 56, 
-39, 32, 43, 64, 95, 120, 134, 141, 136, 122, 100, 75, 55, 44, 45, 65, 91, 121, 146, 162, 
-181, 182, 168, 141, 114, 107, 99, 102, 115, 140, 176, 199, 212, 214, 208, 195, 168, 139, 119, 105, 
-105, 118, 141, 172, 191, 200, 203, 192, 173, 131, 92, 72, 60, 62, 50, 63, 95, 118, 139, 169, 
-168, 151, 119, 97, 103, 101, 108, 126, 141, 147, 165, 175, 176, 159, 130, 97, 69, 50, 35, 37, 
-56, 85, 118, 137, 147, 147, 136, 114, 80, 54, 39, 34, 45, 67, 96, 126, 146, 158, 160, 149, 
-128, 98, 79, 71, 68, 78, 95, 129, 166, 185, 196, 192, 187, 171, 140, 117, 101, 105, 119, 138, 
-167, 193, 212, 220, 216, 202, 178, 151, 129, 113, 111, 120, 136, 164, 189, 204, 208, 199, 184, 158, 
-130, 103, 83, 82, 93, 114, 136, 155, 170, 175, 169, 141, 106, 76, 56, 45, 39, 47, 68, 99, 
-124, 137, 142, 135, 118, 93, 69, 52, 43, 47, 64, 94, 125, 149, 163, 175, 179, 163, 136, 106, 
-97, 95, 100, 115, 140, 175, 199, 212, 214, 205, 191, 163, 134, 114, 103, 104, 118, 144, 177, 197, 
-205, 204, 192, 170, 132, 90, 70, 58, 68, 66, 74, 105, 128, 141, 160, 169, 149, 119, 90, 93, 
-98, 108, 126, 153, 161, 171, 180, 178, 164, 131, 96, 67, 50, 41, 44, 63, 94, 125, 144, 151, 
-148, 135, 112, 79, 53, 39, 35, 46, 68, 100, 130, 149, 159, 159, 148, 124, 93, 71, 63, 65, 
-77, 97, 129, 166, 186, 195, 190, 179, 162, 132, 110, 95, 98, 116, 137, 167, 192, 210, 219, 213, 
-199, 172, 143, 122, 109, 109, 121, 140, 169, 193, 206, 210, 199, 181, 154, 125, 103, 83, 83, 95, 
-118, 146, 161, 174, 177, 171, 147, 107, 77, 56, 46, 44, 52, 75, 107, 132, 145, 147, 138, 119, 
-90, 66, 51, 43, 49, 65, 98, 131, 154, 168, 173, 176, 161, 133, 104, 91, 94, 102, 118, 144, 
-176, 201, 213, 214, 203, 186, 158, 130, 111, 103, 107, 122, 150, 180, 201, 207, 202, 189, 164, 128, 
-88, 66, 57, 66, 79, 85, 110, 132, 144, 151, 163, 143, 112, 83, 79, 92, 105, 126, 158, 173, 
-175, 183, 178, 165, 131, 92, 64, 47, 43, 49, 68, 101, 130, 149, 156, 151, 137, 112, 80, 54, 
-40, 38, 50, 72, 107, 136, 155, 163, 159, 147, 121, 90, 68, 60, 66, 79, 102, 133, 166, 188, 
-195, 189, 175, 155, 127, 105, 91, 92, 112, 137, 169, 194, 209, 217, 210, 193, 164, 134, 114, 102, 
-104, 118, 141, 170, 193, 206, 208, 197, 176, 146, 117, 98, 81, 80, 94, 118, 149, 165, 175, 177, 
-168, 147, 105, 73, 54, 45, 48, 57, 82, 114, 139, 152, 150, 139, 118, 88, 63, 50, 44, 52, 
-68, 99, 135, 158, 171, 172, 172, 158, 128, 101, 83, 87, 102, 120, 148, 178, 202, 214, 213, 202, 
-181, 151, 125, 106, 100, 108, 124, 154, 184, 205, 211, 202, 187, 161, 129, 94, 66, 61, 69, 89, 
-100, 117, 136, 145, 144, 152, 138, 107, 82, 70, 89, 108, 131, 164, 187, 183, 184, 176, 162, 131, 
-89, 62, 45, 43, 54, 73, 107, 136, 155, 161, 154, 139, 111, 80, 56, 40, 41, 54, 78, 113, 
-143, 161, 168, 161, 147, 118, 87, 65, 55, 63, 78, 103, 135, 165, 188, 194, 188, 170, 143, 117, 
-96, 84, 87, 106, 135, 168, 193, 207, 212, 204, 185, 154, 123, 103, 93, 98, 113, 140, 170, 192, 
-205, 206, 195, 172, 140, 110, 90, 77, 77, 92, 120, 153, 172, 180, 179, 168, 147, 107, 73, 53, 
-45, 53, 65, 91, 123, 147, 160, 157, 144, 121, 89, 63, 49, 45, 54, 71, 103, 140, 162, 175, 
-173, 165, 151, 120, 94, 76, 77, 95, 116, 147, 176, 199, 212, 209, 196, 171, 140, 115, 96, 92, 
-102, 121, 153, 183, 203, 212, 202, 185, 156, 122, 93, 66, 62, 72, 96, 120, 134, 150, 158, 152, 
-148, 135, 102, 80, 63, 76, 101, 127, 162, 190, 193, 189, 181, 163, 133, 91, 64, 48, 49, 63, 
-83, 116, 143, 160, 165, 155, 137, 109, 79, 58, 44, 47, 61, 86, 120, 147, 163, 168, 160, 145, 
-116, 85, 63, 50, 53, 56, 58, 59, 61, 69, 74, 75, 75, 77, 85, 88, 90, 90, 93, 99, 
-102, 103, 104, 106, 109, 110, 111, 111, 113, 115, 116, 117, 117, 116, 115, 115, 115, 116, 114, 113, 
-113, 114, 113, 109, 107, 107, 108, 107, 102, 100, 100, 101, 99, 90, 88, 88, 90, 88, 84, 84, 
-85, 86, 85, 84, 85, 86, 87, 90, 93, 94, 95, 96, 101, 105, 107, 108, 109, 119, 124, 126, 
-126, 129, 139, 142, 143, 143, 145, 149, 150, 150, 150, 151, 152, 153, 152, 152, 151, 149, 148, 148, 
-148, 144, 141, 140, 140, 140, 131, 126, 125, 126, 123, 106, 99, 99, 99, 104, 123, 130, 132, 132, 
-138, 154, 158, 159, 159, 150, 135, 133, 131, 132, 127, 121, 121, 120, 121, 117, 114, 114, 114, 115, 
-113, 112, 113, 113, 113, 111, 111, 111, 112, 113, 116, 118, 119, 119, 120, 123, 124, 125, 125, 128, 
-133, 134, 135, 134, 140, 146, 147, 147, 147, 152, 156, 157, 157, 157, 161, 163, 163, 163, 163, 165, 
-165, 165, 164, 164, 166, 163, 159, 158, 157, 155, 154, 153, 153, 152, 150, 149, 149, 149, 146, 142, 
-141, 140, 141, 136, 132, 132, 132, 132, 124, 120, 120, 120, 119, 115, 114, 114, 114, 114, 112, 112, 
-112, 113, 114, 117, 118, 119, 119, 122, 126, 127, 128, 128, 134, 141, 142, 142, 142, 149, 154, 155, 
-155, 154, 158, 159, 159, 159, 159, 160, 160, 160, 159, 158, 155, 154, 153, 153, 151, 147, 145, 145, 
-145, 140, 132, 132, 130, 132, 121, 109, 107, 107, 107, 120, 131, 133, 134, 135, 148, 155, 155, 156, 
-153, 139, 134, 132, 132, 130, 124, 122, 122, 122, 121, 117, 116, 116, 117, 116, 115, 115, 115, 116, 
-115, 114, 114, 115, 115, 117, 119, 120, 120, 121, 123, 124, 125, 125, 126, 131, 132, 133, 133, 135, 
-141, 143, 144, 143, 146, 151, 151, 152, 151, 153, 157, 157, 157, 156, 157, 158, 158, 158, 157, 158, 
-159, 158, 158, 157, 155, 153, 153, 152, 151, 149, 148, 147, 147, 145, 140, 139, 138, 138, 135, 130, 
-129, 128, 129, 124, 117, 116, 115, 116, 112, 110, 110, 110, 111, 109, 108, 109, 109, 110, 112, 114, 
-114, 115, 116, 120, 122, 123, 123, 125, 132, 134, 135, 135, 138, 144, 146, 146, 146, 147, 150, 150, 
-150, 149, 150, 151, 151, 150, 150, 148, 147, 146, 146, 145, 142, 140, 140, 139, 138, 131, 128, 127, 
-128, 124, 112, 108, 108, 107, 114, 126, 128, 130, 129, 138, 146, 148, 148, 148, 139, 129, 128, 127, 
-127, 122, 119, 118, 118, 118, 115, 113, 113, 113, 113, 112, 112, 112, 113, 112, 111, 111, 111, 111, 
-112, 115, 115, 116, 116, 118, 119, 120, 120, 121, 124, 127, 127, 128, 128, 133, 136, 137, 137, 137, 
-142, 144, 144, 145, 146, 149, 150, 150, 150, 150, 151, 151, 151, 150, 151, 152, 151, 151, 151, 149, 
-148, 147, 146, 146, 144, 143, 142, 142, 142, 138, 136, 135, 135, 134, 129, 127, 127, 127, 126, 119, 
-116, 116, 116, 115, 112, 111, 111, 111, 110, 109, 109, 109, 109, 111, 113, 113, 114, 114, 118, 121, 
-121, 122, 122, 128, 133, 133, 134, 134, 141, 142, 138, 137, 136, 139, 139, 139, 139, 139, 140, 140, 
-140, 140, 139, 138, 138, 137, 137, 136, 134, 133, 133, 133, 129, 126, 126, 125, 125, 117, 112, 112, 
-111, 113, 122, 126, 127, 127, 129, 137, 140, 141, 141, 138, 130, 128, 127, 127, 125, 122, 121, 121, 
-121, 119, 117, 117, 117, 118, 117, 116, 116, 117, 117, 116, 115, 116, 116, 116, 118, 118, 119, 119, 
-119, 120, 121, 121, 121, 122, 125, 125, 126, 126, 128, 131, 132, 132, 132, 134, 137, 137, 137, 137, 
-139, 141, 141, 141, 140, 141, 142, 142, 141, 141, 142, 142, 142, 142, 142, 140, 140, 139, 139, 139, 
-137, 137, 136, 137, 135, 133, 133, 133, 133, 131, 128, 128, 127, 127, 124, 120, 120, 120, 120, 117, 
-116, 116, 116, 116, 115, 115, 115, 115, 116, 118, 118, 119, 119, 120, 123, 124, 124, 124, 127, 131, 
-132, 133, 132, 136, 139, 140, 140, 140, 141, 143, 142, 142, 142, 142, 143, 142, 142, 142, 140, 140, 
-139, 139, 138, 136, 135, 134, 134, 132, 127, 126, 126, 126, 120, 114, 113, 113, 113, 117, 123, 124, 
-125, 124, 129, 133, 134, 134, 134, 128, 125, 125, 125, 124, 122, 121, 121, 121, 121, 119, 119, 119, 
-119, 119, 119, 119, 119, 119, 119, 118, 118, 118, 118, 119, 120, 121, 121, 121, 122, 123, 123, 123, 
-123, 125, 126, 127, 127, 127, 130, 131, 131, 131, 132, 134, 135, 135, 135, 135, 137, 137, 137, 137, 
-137, 137, 137, 137, 136, 137, 137, 137, 136, 136, 135, 135, 134, 134, 134, 133, 133, 132, 132, 132, 
-130, 129, 129, 129, 128, 126, 125, 125, 125, 124, 121, 120, 120, 120, 119, 118, 118, 118, 118, 117, 
-117, 117, 117, 118, 119, 120, 120, 120, 121, 123, 125, 126, 126, 126, 130, 131, 132, 131, 133, 136, 
-137, 137, 137, 137, 138, 139, 139, 138, 139, 139, 139, 139, 139, 138, 137, 137, 136, 136, 135, 134, 
-133, 133, 133, 130, 128, 127, 127, 126, 120, 118, 117, 117, 119, 125, 127, 128, 128, 131, 135, 137, 
-137, 137, 133, 128, 127, 127, 127, 125, 123, 123, 122, 123, 121, 120, 120, 120, 120, 120, 120, 120, 
-120, 120, 120, 120, 120, 120, 120, 121, 121, 122, 122, 122, 123, 123, 123, 123, 124, 125, 125, 125, 
-126, 127, 128, 128, 129, 129, 130, 130, 130, 130, 130, 131, 132, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 132, 132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 130, 130, 130, 129, 129, 129, 129, 
-128, 127, 127, 127, 126, 125, 124, 123, 123, 123, 122, 122, 122, 122, 122, 121, 121, 121, 121, 122, 
-122, 123, 123, 123, 124, 125, 125, 125, 125, 126, 128, 128, 128, 128, 130, 131, 131, 131, 131, 132, 
-132, 132, 132, 132, 132, 133, 132, 132, 132, 132, 132, 132, 132, 132, 131, 132, 132, 131, 130, 129, 
-129, 128, 129, 126, 124, 124, 123, 124, 126, 128, 129, 129, 129, 132, 133, 133, 133, 133, 130, 129, 
-129, 129, 128, 127, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 125, 125, 125, 124, 124, 124, 
-124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126, 127, 127, 127, 127, 127, 126, 126, 126, 
-126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 129, 129, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 130, 
-130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 
-128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 
-124, 126, 136, 153, 176, 200, 217, 227, 230, 223, 211, 191, 163, 140, 122, 111, 109, 117, 131, 150, 
-173, 192, 203, 208, 205, 195, 180, 156, 133, 115, 101, 96, 101, 115, 133, 159, 182, 196, 205, 204, 
-195, 181, 159, 133, 110, 95, 86, 88, 99, 116, 143, 169, 187, 199, 201, 195, 180, 160, 133, 108, 
-90, 78, 77, 87, 103, 127, 155, 176, 190, 196, 193, 181, 163, 136, 109, 89, 75, 70, 76, 90, 
-112, 139, 163, 179, 188, 188, 179, 164, 139, 110, 89, 72, 64, 68, 81, 99, 125, 153, 172, 183, 
-186, 179, 166, 144, 115, 92, 74, 63, 63, 74, 90, 114, 143, 164, 178, 184, 180, 169, 150, 124, 
-97, 77, 65, 61, 69, 83, 106, 135, 158, 174, 183, 183, 173, 157, 134, 104, 82, 67, 60, 64, 
-77, 96, 124, 150, 168, 180, 182, 175, 162, 141, 111, 87, 71, 60, 60, 71, 89, 114, 141, 162, 
-176, 181, 177, 166, 148, 119, 93, 74, 61, 58, 66, 82, 102, 131, 156, 171, 179, 178, 169, 153, 
-127, 99, 79, 64, 57, 62, 76, 95, 123, 150, 167, 179, 182, 175, 160, 138, 109, 85, 68, 58, 
-59, 70, 87, 114, 142, 162, 176, 182, 178, 165, 146, 119, 91, 73, 60, 58, 66, 82, 106, 135, 
-158, 174, 182, 181, 170, 154, 129, 100, 79, 64, 57, 62, 77, 97, 125, 151, 169, 180, 182, 174, 
-160, 137, 108, 85, 68, 58, 60, 72, 90, 115, 144, 164, 177, 182, 178, 166, 145, 117, 92, 72, 
-59, 57, 67, 82, 105, 135, 157, 172, 180, 179, 169, 151, 127, 98, 76, 62, 56, 62, 76, 97, 
-126, 151, 169, 179, 181, 173, 158, 136, 106, 83, 67, 58, 60, 72, 90, 118, 145, 165, 178, 183, 
-177, 164, 145, 116, 91, 73, 61, 59, 69, 86, 109, 138, 162, 177, 184, 182, 171, 155, 127, 99, 
-80, 65, 60, 66, 81, 101, 130, 156, 173, 183, 184, 176, 161, 136, 108, 85, 69, 60, 63, 76, 
-94, 121, 149, 168, 181, 185, 180, 166, 146, 118, 92, 73, 62, 61, 71, 87, 112, 141, 162, 177, 
-184, 182, 170, 153, 127, 99, 79, 65, 60, 67, 81, 104, 133, 158, 175, 185, 186, 176, 161, 137, 
-107, 85, 69, 60, 63, 76, 96, 122, 150, 171, 183, 186, 180, 167, 146, 116, 92, 73, 62, 61, 
-72, 90, 114, 144, 166, 181, 187, 184, 173, 155, 126, 99, 79, 65, 61, 69, 84, 105, 135, 160, 
-176, 186, 187, 178, 161, 137, 108, 85, 69, 61, 65, 78, 97, 126, 153, 172, 184, 188, 181, 167, 
-146, 117, 91, 73, 62, 62, 72, 89, 115, 143, 165, 180, 186, 182, 170, 152, 124, 96, 77, 63, 
-60, 67, 83, 105, 134, 160, 176, 185, 185, 175, 160, 134, 105, 83, 67, 60, 64, 79, 98, 126, 
-154, 172, 184, 187, 180, 166, 144, 115, 90, 72, 62, 63, 75, 93, 119, 149, 169, 183, 189, 185, 
-173, 154, 127, 98, 79, 66, 63, 71, 86, 110, 140, 163, 179, 188, 187, 177, 160, 136, 106, 84, 
-69, 62, 67, 81, 102, 129, 156, 175, 186, 189, 181, 166, 145, 114, 91, 73, 63, 64, 76, 94, 
-119, 148, 169, 183, 188, 184, 172, 154, 124, 98, 78, 65, 62, 71, 88, 111, 141, 165, 181, 190, 
-189, 179, 161, 135, 106, 84, 69, 62, 67, 82, 102, 132, 158, 176, 188, 190, 182, 166, 144, 115, 
-90, 72, 63, 64, 76, 95, 123, 151, 172, 186, 191, 187, 172, 153, 124, 97, 78, 65, 63, 72, 
-89, 113, 142, 166, 182, 190, 189, 177, 160, 133, 104, 84, 68, 62, 67, 83, 104, 132, 159, 178, 
-188, 190, 182, 167, 142, 113, 89, 71, 61, 63, 76, 95, 121, 150, 171, 184, 189, 183, 170, 149, 
-121, 94, 75, 63, 61, 71, 88, 112, 142, 165, 181, 189, 187, 175, 157, 131, 102, 80, 66, 60, 
-67, 82, 104, 133, 158, 177, 188, 189, 180, 164, 141, 111, 87, 71, 62, 65, 78, 98, 126, 153, 
-174, 187, 191, 185, 172, 151, 121, 95, 77, 64, 63, 73, 91, 115, 145, 168, 184, 191, 188, 177, 
-158, 130, 103, 82, 67, 62, 69, 85, 106, 136, 162, 179, 189, 190, 181, 164, 140, 111, 87, 71, 
-62, 65, 79, 98, 126, 154, 173, 186, 190, 185, 171, 150, 121, 94, 75, 63, 63, 73, 91, 117, 
-146, 168, 185, 192, 189, 176, 157, 130, 101, 80, 66, 61, 69, 85, 108, 137, 162, 180, 190, 190, 
-180, 164, 139, 109, 87, 70, 61, 65, 80, 100, 128, 156, 176, 189, 192, 185, 171, 148, 119, 94, 
-75, 63, 63, 75, 93, 118, 148, 170, 185, 192, 188, 176, 156, 128, 101, 80, 66, 62, 70, 86, 
-109, 139, 163, 181, 191, 191, 180, 163, 138, 108, 85, 69, 61, 65, 79, 99, 128, 155, 174, 187, 
-190, 182, 167, 145, 115, 90, 72, 61, 62, 73, 92, 118, 147, 169, 184, 190, 186, 173, 154, 125, 
-98, 78, 64, 60, 69, 86, 109, 138, 164, 180, 190, 189, 179, 161, 135, 106, 84, 68, 61, 67, 
-82, 102, 131, 159, 177, 190, 192, 184, 169, 146, 117, 92, 74, 63, 64, 77, 94, 122, 150, 171, 
-186, 192, 188, 174, 154, 126, 98, 78, 65, 62, 71, 88, 113, 142, 165, 182, 191, 190, 178, 162, 
-135, 105, 84, 68, 62, 68, 82, 104, 132, 158, 177, 190, 193, 184, 169, 145, 115, 91, 73, 62, 
-64, 77, 96, 122, 151, 173, 187, 193, 187, 174, 153, 123, 98, 77, 64, 62, 72, 89, 112, 143, 
-167, 183, 191, 189, 179, 160, 134, 105, 83, 68, 62, 68, 83, 105, 135, 160, 179, 191, 192, 184, 
-167, 144, 114, 89, 72, 63, 65, 77, 97, 125, 153, 174, 188, 193, 187, 173, 153, 123, 97, 78, 
-64, 63, 72, 90, 115, 144, 168, 184, 192, 189, 178, 160, 132, 104, 82, 66, 60, 67, 83, 104, 
-133, 160, 178, 189, 190, 181, 165, 139, 110, 87, 69, 60, 63, 77, 95, 123, 152, 172, 186, 191, 
-185, 170, 148, 120, 94, 74, 62, 61, 72, 89, 115, 144, 167, 183, 191, 189, 176, 158, 131, 101, 
-80, 66, 61, 68, 84, 108, 138, 162, 181, 191, 192, 182, 166, 141, 111, 88, 71, 62, 66, 79, 
-100, 127, 155, 176, 188, 192, 186, 172, 150, 119, 95, 75, 63, 63, 74, 92, 116, 147, 170, 185, 
-192, 189, 177, 157, 128, 101, 81, 66, 61, 70, 85, 107, 137, 163, 181, 192, 192, 182, 165, 139, 
-110, 86, 70, 62, 66, 79, 99, 129, 156, 176, 189, 193, 186, 170, 149, 119, 92, 74, 63, 63, 
-74, 92, 119, 148, 170, 186, 192, 189, 175, 157, 128, 100, 80, 65, 61, 69, 86, 111, 139, 165, 
-182, 192, 191, 181, 165, 138, 108, 86, 69, 61, 66, 81, 101, 129, 158, 177, 189, 192, 185, 170, 
-147, 117, 93, 73, 62, 63, 75, 93, 120, 150, 171, 186, 193, 189, 175, 155, 127, 99, 78, 64, 
-60, 69, 85, 109, 139, 163, 180, 190, 189, 178, 161, 135, 105, 83, 67, 59, 65, 79, 101, 130, 
-156, 176, 188, 191, 183, 167, 145, 114, 90, 72, 61, 62, 74, 93, 119, 149, 171, 185, 191, 187, 
-174, 153, 124, 97, 77, 63, 61, 71, 89, 112, 142, 167, 183, 192, 191, 180, 162, 134, 106, 84, 
-68, 61, 68, 83, 103, 133, 160, 178, 190, 193, 184, 168, 145, 116, 90, 72, 62, 64, 77, 95, 
-123, 152, 172, 187, 192, 187, 173, 153, 124, 97, 78, 64, 62, 72, 88, 115, 145, 169, 187, 196, 
-194, 182, 164, 136, 106, 85, 68, 62, 67, 83, 105, 134, 161, 181, 192, 194, 185, 169, 145, 114, 
-91, 72, 62, 64, 77, 96, 123, 153, 174, 189, 194, 188, 175, 153, 123, 97, 77, 63, 62, 73, 
-90, 115, 146, 169, 185, 194, 192, 180, 161, 135, 105, 82, 67, 61, 68, 83, 105, 136, 161, 180, 
-192, 193, 184, 167, 143, 113, 88, 71, 61, 64, 77, 97, 126, 154, 175, 189, 193, 187, 173, 152, 
-121, 95, 75, 62, 60, 70, 89, 113, 143, 167, 183, 191, 188, 176, 158, 129, 101, 79, 64, 58, 
-66, 82, 104, 134, 161, 179, 190, 190, 182, 165, 139, 110, 86, 68, 59, 63, 77, 96, 125, 154, 
-174, 188, 192, 186, 171, 149, 120, 93, 73, 62, 61, 73, 91, 118, 147, 170, 186, 193, 190, 177, 
-158, 130, 101, 80, 65, 61, 68, 84, 108, 137, 163, 181, 192, 192, 182, 165, 140, 109, 88, 71, 
-62, 66, 80, 99, 127, 155, 176, 189, 193, 187, 173, 149, 118, 92, 72, 59, 60, 66, 65, 66, 
-68, 75, 77, 78, 90, 98, 98, 114, 131, 131, 142, 160, 163, 166, 174, 176, 176, 179, 180, 179, 
-175, 170, 170, 163, 154, 153, 146, 125, 120, 115, 79, 62, 63, 93, 122, 119, 145, 171, 177, 164, 
-129, 124, 118, 103, 98, 98, 87, 82, 82, 80, 77, 78, 76, 72, 72, 75, 82, 84, 86, 92, 
-95, 96, 106, 114, 114, 126, 139, 140, 147, 159, 161, 163, 174, 177, 177, 180, 182, 181, 184, 185, 
-185, 181, 176, 175, 172, 166, 163, 161, 150, 143, 142, 131, 120, 121, 109, 91, 89, 85, 75, 73, 
-73, 68, 67, 68, 74, 79, 80, 89, 100, 100, 111, 131, 134, 140, 160, 166, 167, 175, 179, 178, 
-181, 183, 183, 179, 174, 173, 168, 158, 156, 151, 131, 122, 122, 87, 66, 65, 90, 124, 123, 143, 
-173, 180, 175, 140, 126, 124, 109, 100, 100, 92, 84, 85, 82, 79, 79, 79, 74, 74, 75, 82, 
-85, 87, 91, 96, 96, 104, 115, 115, 122, 138, 141, 145, 158, 163, 163, 173, 178, 177, 180, 182, 
-178, 179, 181, 181, 179, 174, 171, 170, 164, 161, 160, 151, 143, 143, 134, 122, 122, 113, 94, 92, 
-89, 79, 76, 77, 73, 71, 71, 75, 81, 82, 88, 100, 102, 107, 127, 135, 136, 154, 164, 164, 
-171, 177, 176, 178, 181, 181, 178, 174, 172, 170, 159, 155, 153, 137, 123, 125, 99, 72, 67, 81, 
-118, 123, 133, 165, 176, 174, 144, 125, 125, 112, 102, 101, 95, 86, 86, 84, 81, 81, 81, 76, 
-76, 76, 82, 86, 88, 91, 97, 97, 102, 113, 115, 118, 133, 139, 140, 151, 159, 158, 166, 173, 
-173, 175, 178, 178, 178, 181, 182, 180, 175, 172, 171, 166, 162, 161, 154, 144, 143, 137, 124, 122, 
-118, 99, 92, 91, 82, 76, 77, 74, 71, 71, 75, 81, 83, 87, 99, 103, 106, 125, 136, 136, 
-151, 166, 166, 170, 178, 178, 179, 182, 183, 181, 176, 172, 172, 163, 156, 155, 143, 125, 126, 110, 
-76, 68, 74, 110, 125, 127, 158, 175, 177, 154, 127, 127, 116, 103, 101, 98, 88, 86, 85, 82, 
-80, 82, 78, 76, 76, 81, 86, 87, 90, 95, 97, 100, 110, 115, 116, 130, 138, 138, 146, 157, 
-157, 161, 170, 171, 172, 175, 176, 175, 178, 179, 178, 174, 170, 169, 166, 161, 160, 156, 145, 142, 
-139, 127, 121, 121, 105, 93, 94, 87, 79, 79, 78, 74, 74, 76, 83, 85, 87, 98, 105, 105, 
-120, 135, 134, 146, 162, 163, 166, 174, 175, 175, 178, 179, 178, 174, 170, 169, 162, 154, 154, 146, 
-128, 124, 118, 84, 71, 72, 100, 124, 123, 148, 170, 175, 161, 130, 125, 119, 105, 100, 99, 90, 
-85, 85, 83, 80, 82, 79, 76, 76, 79, 85, 87, 89, 94, 97, 98, 108, 115, 115, 126, 137, 
-138, 144, 156, 157, 160, 169, 171, 172, 175, 176, 175, 178, 180, 179, 176, 171, 170, 167, 162, 160, 
-158, 148, 143, 143, 133, 124, 124, 112, 96, 96, 91, 82, 80, 80, 76, 75, 76, 82, 86, 87, 
-95, 105, 105, 115, 133, 135, 141, 159, 164, 165, 173, 176, 175, 178, 179, 179, 175, 171, 170, 165, 
-156, 154, 149, 130, 121, 119, 89, 73, 72, 94, 120, 119, 138, 162, 168, 162, 133, 123, 121, 108, 
-101, 101, 94, 87, 88, 86, 83, 84, 83, 79, 79, 80, 86, 89, 90, 94, 98, 98, 105, 114, 
-115, 121, 134, 136, 140, 151, 155, 155, 164, 168, 167, 170, 172, 172, 173, 176, 176, 174, 169, 167, 
-165, 161, 158, 157, 148, 142, 141, 133, 123, 123, 115, 99, 97, 95, 86, 82, 83, 79, 78, 78, 
-83, 87, 88, 94, 104, 106, 111, 128, 134, 136, 152, 160, 161, 167, 172, 171, 173, 174, 174, 171, 
-167, 165, 162, 153, 150, 148, 133, 121, 123, 99, 76, 72, 86, 118, 121, 132, 159, 168, 166, 139, 
-124, 123, 111, 103, 102, 97, 89, 89, 88, 85, 85, 85, 81, 81, 81, 86, 90, 91, 95, 99, 
-100, 105, 114, 117, 120, 134, 139, 141, 151, 158, 157, 164, 170, 170, 172, 175, 174, 175, 177, 177, 
-176, 171, 169, 168, 163, 160, 159, 152, 144, 143, 137, 126, 124, 120, 103, 98, 96, 88, 83, 84, 
-81, 79, 79, 82, 88, 89, 93, 103, 106, 109, 125, 133, 133, 145, 157, 157, 161, 167, 167, 168, 
-171, 171, 170, 166, 163, 162, 154, 149, 148, 138, 123, 124, 109, 83, 76, 82, 112, 123, 126, 152, 
-165, 167, 146, 126, 125, 116, 106, 104, 101, 93, 92, 91, 88, 87, 88, 85, 84, 84, 88, 93, 
-94, 97, 101, 102, 105, 115, 118, 120, 132, 138, 138, 146, 154, 154, 159, 166, 167, 168, 171, 171, 
-171, 173, 174, 173, 170, 166, 165, 162, 158, 157, 153, 144, 142, 139, 128, 123, 122, 108, 99, 99, 
-92, 85, 85, 83, 80, 80, 82, 87, 89, 91, 101, 106, 107, 120, 132, 132, 143, 156, 157, 160, 
-167, 167, 168, 170, 171, 170, 166, 163, 163, 157, 150, 149, 142, 126, 124, 116, 88, 77, 78, 105, 
-124, 123, 146, 164, 168, 155, 129, 126, 120, 109, 105, 105, 97, 93, 93, 91, 89, 90, 87, 85, 
-85, 88, 93, 94, 96, 101, 103, 104, 113, 118, 119, 129, 138, 138, 145, 154, 155, 158, 166, 167, 
-168, 171, 172, 171, 173, 174, 174, 171, 164, 161, 159, 154, 153, 151, 142, 138, 137, 129, 122, 122, 
-111, 99, 99, 95, 88, 87, 86, 83, 82, 83, 88, 91, 92, 99, 107, 107, 116, 130, 131, 137, 
-151, 155, 156, 162, 165, 164, 167, 168, 167, 165, 161, 160, 156, 149, 148, 143, 128, 123, 120, 94, 
-82, 81, 102, 124, 123, 141, 161, 165, 159, 134, 126, 123, 112, 107, 106, 100, 95, 95, 93, 91, 
-91, 90, 87, 87, 88, 93, 96, 97, 101, 104, 104, 111, 118, 118, 124, 135, 137, 140, 150, 153, 
-154, 161, 164, 164, 166, 167, 166, 168, 169, 169, 167, 162, 161, 159, 155, 153, 152, 144, 139, 138, 
-131, 122, 123, 114, 101, 99, 97, 90, 87, 87, 84, 83, 83, 87, 92, 92, 98, 106, 107, 113, 
-128, 132, 135, 149, 156, 156, 162, 166, 165, 167, 169, 169, 167, 163, 162, 161, 153, 150, 147, 134, 
-125, 126, 103, 85, 82, 95, 122, 124, 135, 158, 166, 163, 138, 127, 126, 115, 108, 107, 102, 96, 
-96, 94, 92, 92, 92, 88, 88, 88, 93, 96, 97, 100, 104, 105, 109, 116, 118, 121, 132, 135, 
-137, 145, 150, 150, 156, 160, 160, 162, 164, 163, 164, 166, 166, 165, 161, 159, 158, 155, 152, 151, 
-146, 139, 138, 133, 124, 123, 119, 105, 102, 100, 94, 90, 91, 88, 86, 87, 90, 94, 95, 99, 
-107, 109, 113, 126, 133, 133, 145, 154, 155, 159, 164, 163, 164, 166, 167, 165, 162, 160, 159, 152, 
-148, 147, 137, 125, 126, 111, 90, 85, 91, 117, 124, 129, 151, 162, 162, 144, 127, 127, 118, 110, 
-108, 106, 98, 98, 97, 95, 93, 94, 91, 89, 89, 93, 96, 97, 99, 103, 104, 107, 115, 117, 
-119, 130, 135, 135, 142, 149, 149, 153, 159, 160, 161, 163, 164, 163, 166, 166, 166, 162, 160, 159, 
-156, 152, 152, 148, 140, 139, 136, 127, 123, 122, 109, 102, 102, 96, 91, 92, 90, 88, 88, 91, 
-95, 97, 99, 107, 111, 112, 124, 134, 134, 144, 154, 155, 158, 164, 164, 165, 167, 167, 166, 163, 
-160, 160, 154, 148, 148, 141, 127, 126, 118, 94, 85, 87, 109, 120, 120, 136, 148, 151, 141, 125, 
-123, 118, 110, 108, 107, 101, 99, 99, 97, 96, 97, 95, 93, 94, 96, 99, 100, 102, 105, 106, 
-108, 114, 117, 118, 125, 131, 132, 136, 143, 143, 146, 151, 152, 152, 154, 155, 155, 156, 157, 157, 
-155, 152, 152, 150, 147, 146, 144, 138, 136, 135, 129, 124, 124, 116, 108, 107, 104, 99, 98, 98, 
-95, 95, 96, 99, 101, 102, 108, 113, 113, 121, 131, 131, 137, 147, 149, 150, 155, 156, 156, 158, 
-159, 158, 156, 153, 153, 150, 144, 144, 140, 129, 126, 122, 102, 93, 93, 109, 124, 123, 137, 151, 
-154, 149, 131, 126, 123, 115, 111, 111, 105, 102, 102, 101, 99, 99, 99, 96, 96, 97, 101, 103, 
-104, 107, 109, 109, 115, 120, 120, 125, 133, 134, 137, 144, 146, 147, 152, 154, 155, 156, 158, 157, 
-159, 160, 161, 159, 156, 155, 154, 151, 149, 148, 142, 139, 138, 132, 127, 126, 120, 110, 109, 107, 
-103, 103, 105, 103, 103, 104, 107, 109, 109, 112, 117, 117, 122, 129, 135, 149, 163, 194, 211, 221, 
-227, 231, 239, 237, 230, 221, 209, 198, 181, 168, 156, 149, 140, 138, 142, 148, 157, 162, 172, 181, 
-190, 196, 190, 180, 177, 169, 163, 135, 92, 72, 59, 49, 59, 85, 93, 103, 111, 130, 171, 193, 
-205, 215, 213, 191, 180, 174, 164, 150, 122, 96, 83, 71, 65, 51, 48, 54, 64, 76, 88, 105, 
-120, 132, 140, 142, 140, 135, 129, 117, 106, 91, 74, 62, 51, 48, 48, 53, 59, 72, 90, 124, 
-146, 160, 170, 179, 194, 192, 186, 175, 164, 159, 143, 130, 118, 111, 113, 119, 124, 133, 145, 164, 
-188, 201, 212, 218, 225, 227, 221, 214, 201, 182, 155, 137, 122, 112, 104, 97, 102, 108, 119, 127, 
-136, 149, 160, 170, 172, 165, 159, 153, 144, 128, 92, 67, 54, 42, 36, 23, 22, 29, 40, 53, 
-65, 85, 100, 113, 121, 130, 134, 130, 125, 113, 109, 98, 84, 74, 64, 68, 79, 85, 92, 103, 
-124, 162, 183, 197, 206, 213, 224, 220, 213, 201, 188, 172, 150, 136, 123, 117, 106, 105, 109, 118, 
-128, 136, 152, 164, 174, 180, 172, 161, 157, 148, 138, 99, 57, 40, 29, 22, 37, 64, 71, 82, 
-91, 118, 157, 175, 186, 196, 190, 169, 161, 154, 144, 130, 102, 81, 70, 60, 53, 40, 40, 45, 
-55, 67, 80, 97, 111, 123, 130, 132, 129, 125, 118, 107, 97, 81, 68, 56, 48, 45, 46, 50, 
-57, 69, 88, 120, 140, 156, 164, 175, 188, 185, 179, 167, 157, 151, 135, 122, 109, 105, 107, 113, 
-119, 130, 143, 165, 187, 201, 213, 218, 226, 226, 220, 211, 197, 177, 150, 132, 117, 108, 99, 95, 
-101, 108, 120, 126, 137, 151, 162, 171, 171, 164, 160, 153, 144, 125, 89, 66, 52, 42, 35, 21, 
-25, 31, 43, 56, 71, 91, 106, 118, 126, 135, 136, 132, 125, 114, 109, 96, 83, 73, 64, 71, 
-80, 85, 94, 104, 130, 167, 185, 200, 207, 216, 225, 220, 213, 200, 186, 168, 149, 135, 123, 116, 
-107, 109, 114, 125, 135, 144, 159, 170, 180, 184, 175, 165, 160, 151, 139, 95, 58, 43, 31, 27, 
-45, 68, 75, 87, 96, 128, 164, 180, 192, 201, 193, 173, 165, 157, 147, 130, 102, 83, 71, 61, 
-53, 41, 43, 48, 61, 72, 86, 105, 119, 131, 136, 138, 135, 130, 121, 110, 100, 82, 69, 56, 
-49, 45, 47, 53, 61, 73, 97, 129, 147, 162, 169, 180, 191, 186, 180, 168, 160, 150, 133, 121, 
-110, 106, 110, 115, 122, 133, 147, 170, 191, 204, 214, 219, 227, 224, 219, 210, 195, 173, 147, 131, 
-117, 109, 100, 98, 104, 111, 124, 131, 144, 157, 169, 177, 176, 170, 165, 158, 148, 126, 88, 68, 
-54, 45, 36, 24, 28, 35, 49, 62, 79, 98, 112, 124, 132, 141, 140, 136, 128, 117, 110, 96, 
-83, 71, 65, 72, 81, 86, 96, 108, 137, 171, 188, 203, 209, 219, 224, 219, 211, 196, 183, 164, 
-145, 131, 120, 113, 105, 109, 114, 127, 136, 147, 162, 174, 184, 186, 175, 169, 163, 154, 138, 94, 
-59, 46, 33, 32, 55, 73, 79, 92, 102, 137, 171, 186, 198, 205, 191, 174, 168, 159, 149, 129, 
-100, 83, 70, 61, 52, 41, 46, 52, 65, 77, 94, 112, 126, 137, 143, 144, 140, 135, 125, 113, 
-101, 82, 69, 56, 49, 45, 49, 54, 64, 78, 104, 135, 152, 166, 173, 186, 193, 187, 180, 166, 
-159, 146, 130, 117, 106, 103, 106, 112, 119, 132, 147, 172, 191, 204, 214, 220, 226, 222, 216, 205, 
-190, 167, 143, 127, 113, 105, 96, 97, 103, 113, 124, 132, 147, 161, 173, 181, 179, 173, 168, 160, 
-148, 123, 87, 68, 53, 45, 35, 26, 32, 40, 55, 67, 87, 106, 122, 133, 140, 148, 145, 141, 
-131, 121, 112, 95, 83, 71, 66, 73, 81, 87, 97, 111, 144, 175, 191, 204, 210, 220, 223, 216, 
-208, 193, 179, 158, 140, 126, 116, 108, 102, 107, 113, 126, 134, 149, 164, 175, 184, 184, 174, 169, 
-162, 153, 134, 89, 59, 46, 34, 35, 57, 73, 80, 92, 104, 142, 173, 187, 199, 205, 190, 176, 
-170, 161, 149, 126, 97, 82, 68, 59, 45, 34, 39, 46, 61, 75, 95, 115, 131, 143, 149, 149, 
-144, 138, 125, 116, 119, 119, 120, 120, 121, 125, 126, 127, 127, 128, 136, 140, 140, 141, 141, 152, 
-158, 158, 158, 157, 165, 172, 171, 171, 170, 175, 181, 180, 180, 178, 179, 181, 181, 180, 178, 179, 
-181, 180, 179, 178, 176, 171, 169, 168, 167, 165, 160, 158, 157, 157, 155, 146, 141, 140, 140, 138, 
-128, 123, 122, 121, 122, 108, 98, 98, 97, 99, 92, 86, 86, 86, 88, 85, 82, 83, 83, 84, 
-87, 92, 93, 95, 95, 99, 108, 111, 112, 112, 116, 132, 137, 138, 137, 140, 155, 161, 161, 160, 
-160, 166, 169, 168, 168, 167, 169, 170, 169, 169, 167, 164, 159, 158, 157, 156, 150, 144, 142, 141, 
-141, 133, 118, 117, 114, 117, 102, 76, 71, 70, 70, 79, 110, 118, 121, 120, 127, 153, 161, 162, 
-162, 159, 132, 119, 118, 117, 117, 105, 99, 99, 98, 99, 93, 87, 87, 88, 89, 87, 85, 86, 
-86, 88, 86, 83, 84, 84, 85, 88, 93, 94, 95, 96, 98, 102, 104, 105, 105, 108, 117, 120, 
-121, 120, 122, 135, 140, 140, 139, 140, 149, 153, 153, 153, 153, 159, 163, 163, 163, 162, 164, 166, 
-165, 165, 163, 165, 166, 166, 165, 164, 162, 158, 156, 155, 155, 152, 148, 147, 146, 146, 144, 135, 
-132, 131, 131, 129, 119, 116, 115, 115, 114, 101, 93, 93, 93, 94, 87, 82, 83, 83, 84, 82, 
-80, 80, 81, 82, 86, 90, 91, 93, 93, 98, 107, 108, 110, 110, 117, 131, 133, 135, 134, 138, 
-152, 156, 156, 156, 157, 163, 164, 164, 163, 163, 165, 166, 165, 164, 163, 160, 157, 156, 155, 155, 
-148, 143, 142, 141, 141, 130, 118, 118, 116, 119, 102, 79, 76, 76, 75, 90, 116, 119, 123, 120, 
-130, 153, 159, 159, 160, 152, 127, 120, 118, 118, 116, 105, 101, 101, 101, 101, 94, 90, 90, 91, 
-92, 89, 88, 88, 89, 90, 88, 85, 86, 87, 87, 91, 95, 96, 98, 98, 100, 104, 105, 107, 
-107, 111, 119, 121, 123, 123, 126, 137, 141, 141, 141, 143, 152, 155, 155, 155, 155, 162, 165, 165, 
-165, 164, 166, 168, 167, 166, 165, 166, 165, 165, 164, 163, 160, 157, 156, 155, 155, 152, 149, 148, 
-147, 147, 143, 135, 134, 133, 133, 130, 121, 118, 117, 118, 115, 101, 97, 97, 97, 97, 90, 87, 
-87, 88, 89, 86, 85, 85, 86, 87, 91, 94, 95, 96, 97, 103, 110, 110, 112, 111, 120, 132, 
-133, 135, 134, 141, 153, 154, 155, 154, 156, 161, 162, 162, 161, 161, 164, 164, 164, 163, 162, 158, 
-156, 156, 155, 154, 147, 143, 143, 142, 141, 130, 121, 121, 119, 121, 102, 83, 81, 81, 81, 98, 
-121, 122, 126, 123, 136, 156, 160, 160, 161, 150, 128, 123, 121, 122, 119, 109, 106, 105, 105, 104, 
-97, 94, 94, 95, 95, 93, 91, 92, 93, 93, 90, 89, 90, 90, 91, 95, 98, 99, 100, 101, 
-104, 107, 108, 108, 108, 113, 120, 121, 123, 122, 128, 137, 139, 140, 139, 142, 151, 153, 153, 152, 
-154, 161, 163, 162, 162, 162, 164, 165, 165, 165, 164, 167, 167, 167, 166, 165, 162, 159, 158, 157, 
-156, 153, 150, 149, 149, 148, 143, 137, 136, 133, 131, 127, 120, 118, 118, 118, 114, 104, 102, 101, 
-102, 101, 96, 94, 94, 95, 95, 93, 92, 93, 93, 94, 97, 100, 101, 101, 102, 108, 112, 113, 
-114, 113, 122, 130, 131, 132, 131, 139, 147, 148, 148, 148, 150, 154, 154, 154, 153, 154, 156, 155, 
-155, 154, 153, 150, 149, 148, 148, 146, 141, 139, 138, 138, 137, 127, 121, 121, 120, 120, 101, 91, 
-90, 91, 91, 107, 123, 124, 127, 125, 139, 152, 154, 154, 154, 144, 127, 125, 123, 124, 119, 112, 
-110, 110, 111, 109, 103, 102, 102, 103, 103, 101, 100, 101, 101, 102, 99, 98, 99, 99, 100, 104, 
-106, 106, 107, 107, 109, 111, 112, 112, 112, 117, 122, 122, 123, 123, 128, 136, 136, 137, 136, 140, 
-146, 147, 148, 147, 149, 154, 155, 155, 154, 154, 156, 157, 156, 156, 156, 158, 158, 157, 157, 156, 
-153, 151, 151, 150, 150, 147, 145, 145, 144, 144, 139, 135, 135, 135, 135, 130, 123, 123, 122, 123, 
-117, 108, 106, 106, 106, 104, 98, 98, 98, 99, 98, 97, 79, 44, 19, 13, 31, 66, 108, 136, 
-148, 144, 119, 81, 53, 41, 58, 90, 130, 160, 174, 175, 159, 123, 92, 74, 80, 103, 143, 178, 
-198, 198, 180, 141, 105, 83, 80, 96, 130, 168, 191, 194, 174, 140, 100, 75, 65, 71, 100, 139, 
-167, 174, 148, 111, 69, 41, 31, 56, 94, 135, 168, 182, 189, 174, 135, 102, 86, 80, 91, 129, 
-161, 180, 174, 149, 111, 77, 56, 53, 66, 102, 140, 164, 167, 149, 113, 74, 49, 43, 56, 90, 
-130, 157, 166, 158, 129, 90, 62, 50, 63, 93, 135, 165, 179, 175, 154, 115, 84, 66, 77, 106, 
-147, 181, 197, 197, 182, 144, 110, 88, 90, 113, 152, 187, 207, 209, 195, 161, 124, 98, 93, 110, 
-144, 182, 205, 212, 198, 167, 127, 98, 87, 96, 124, 162, 190, 202, 190, 162, 121, 89, 73, 76, 
-97, 136, 167, 184, 174, 148, 108, 71, 51, 50, 68, 106, 142, 164, 164, 147, 112, 73, 49, 45, 
-65, 102, 142, 166, 174, 166, 138, 100, 72, 63, 84, 118, 160, 187, 198, 195, 173, 133, 102, 86, 
-95, 123, 164, 196, 212, 209, 188, 147, 112, 92, 93, 112, 150, 183, 203, 201, 181, 145, 107, 82, 
-76, 86, 120, 157, 181, 183, 157, 120, 79, 50, 45, 73, 109, 151, 180, 192, 195, 174, 133, 101, 
-86, 83, 102, 142, 173, 189, 180, 153, 111, 77, 58, 59, 77, 116, 152, 173, 173, 153, 114, 75, 
-52, 48, 65, 104, 143, 167, 173, 162, 129, 90, 62, 54, 70, 104, 146, 174, 184, 178, 151, 111, 
-81, 67, 82, 112, 154, 185, 199, 197, 176, 137, 104, 85, 92, 117, 156, 190, 209, 208, 191, 153, 
-116, 93, 92, 112, 148, 184, 206, 210, 194, 158, 118, 92, 84, 96, 127, 166, 191, 200, 186, 154, 
-113, 83, 71, 76, 101, 141, 171, 185, 172, 143, 101, 68, 51, 53, 74, 115, 149, 168, 165, 143, 
-104, 69, 46, 47, 70, 109, 147, 170, 174, 163, 130, 92, 66, 62, 85, 121, 162, 188, 197, 193, 
-166, 126, 97, 85, 98, 129, 171, 200, 213, 206, 181, 139, 107, 90, 94, 116, 154, 184, 201, 196, 
-173, 134, 97, 75, 72, 87, 125, 160, 183, 180, 154, 114, 74, 48, 47, 76, 115, 156, 182, 193, 
-191, 164, 122, 92, 79, 81, 106, 146, 175, 188, 175, 146, 105, 72, 56, 59, 82, 124, 158, 176, 
-171, 148, 108, 71, 50, 50, 71, 111, 149, 171, 173, 158, 122, 83, 58, 54, 72, 110, 150, 175, 
-183, 173, 142, 102, 73, 64, 81, 115, 157, 186, 197, 192, 167, 127, 94, 78, 89, 118, 159, 191, 
-207, 203, 181, 141, 106, 84, 88, 110, 149, 185, 205, 205, 186, 148, 109, 85, 81, 96, 131, 170, 
-194, 198, 182, 148, 106, 78, 69, 78, 108, 148, 175, 186, 171, 140, 96, 65, 50, 56, 81, 123, 
-155, 171, 165, 141, 100, 65, 46, 51, 75, 117, 153, 173, 175, 159, 122, 86, 62, 63, 86, 124, 
-164, 188, 195, 186, 153, 114, 87, 79, 95, 128, 170, 198, 208, 199, 169, 127, 96, 82, 90, 117, 
-157, 188, 203, 195, 169, 127, 93, 74, 74, 92, 132, 166, 186, 178, 149, 108, 70, 47, 51, 79, 
-119, 160, 184, 191, 183, 149, 109, 81, 72, 79, 110, 151, 179, 188, 174, 141, 100, 69, 56, 64, 
-91, 134, 166, 181, 173, 148, 105, 70, 51, 56, 80, 122, 158, 177, 176, 157, 117, 80, 57, 57, 
-77, 117, 157, 180, 184, 171, 135, 96, 69, 63, 81, 117, 160, 186, 195, 187, 156, 114, 84, 72, 
-84, 115, 158, 189, 202, 196, 170, 127, 94, 75, 82, 108, 150, 184, 202, 199, 177, 137, 99, 76, 
-76, 96, 135, 172, 194, 195, 177, 140, 99, 72, 66, 79, 114, 155, 181, 188, 171, 138, 95, 65, 
-53, 63, 93, 136, 166, 179, 170, 143, 100, 67, 50, 58, 86, 129, 163, 180, 179, 159, 118, 82, 
-60, 64, 89, 130, 168, 190, 193, 179, 143, 104, 77, 74, 92, 130, 170, 196, 202, 190, 157, 115, 
-85, 74, 86, 116, 158, 187, 199, 188, 159, 117, 84, 67, 72, 95, 138, 171, 188, 177, 149, 106, 
-69, 47, 57, 87, 129, 167, 189, 195, 182, 145, 104, 79, 72, 83, 120, 160, 187, 192, 174, 137, 
-97, 84, 79, 77, 76, 77, 78, 79, 79, 80, 81, 82, 83, 84, 84, 85, 86, 87, 88, 90, 
-91, 92, 93, 94, 96, 97, 97, 98, 100, 102, 103, 104, 104, 106, 109, 110, 111, 111, 112, 115, 
-116, 117, 117, 118, 120, 121, 121, 122, 122, 123, 124, 124, 124, 125, 125, 126, 126, 127, 127, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 124, 124, 124, 124, 123, 122, 122, 122, 122, 122, 
-119, 118, 118, 118, 118, 117, 116, 117, 117, 117, 117, 117, 117, 118, 118, 119, 120, 121, 121, 121, 
-123, 125, 125, 126, 126, 129, 131, 132, 132, 132, 135, 137, 138, 138, 138, 139, 140, 140, 140, 140, 
-140, 140, 140, 140, 140, 139, 138, 138, 138, 138, 137, 136, 135, 135, 135, 134, 131, 130, 129, 129, 
-129, 123, 120, 120, 120, 120, 125, 130, 131, 132, 131, 135, 140, 141, 141, 141, 138, 133, 132, 131, 
-132, 131, 128, 128, 128, 128, 127, 126, 126, 126, 127, 127, 127, 126, 126, 127, 127, 126, 126, 126, 
-126, 126, 128, 129, 129, 130, 130, 130, 131, 131, 131, 131, 132, 133, 133, 133, 133, 134, 135, 135, 
-135, 135, 136, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 
-138, 138, 138, 137, 137, 137, 137, 137, 136, 136, 136, 136, 136, 135, 134, 134, 134, 134, 133, 132, 
-132, 132, 132, 131, 130, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 
-129, 130, 130, 130, 131, 132, 132, 132, 132, 133, 135, 135, 135, 135, 136, 137, 137, 137, 137, 137, 
-138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 137, 137, 137, 137, 136, 135, 135, 135, 135, 134, 
-133, 132, 132, 132, 131, 128, 126, 126, 126, 126, 128, 130, 131, 131, 131, 133, 135, 135, 135, 135, 
-133, 131, 130, 130, 130, 129, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 126, 127, 127, 127, 127, 128, 128, 128, 128, 129, 129, 130, 130, 131, 131, 132, 132, 132, 
-132, 133, 134, 134, 133, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 131, 131, 
-131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 129, 128, 128, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 128, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-129, 129, 129, 129, 129, 129, 129, 128, 133, 156, 155, 151, 158, 170, 191, 213, 228, 237, 236, 227, 
-211, 186, 162, 144, 134, 133, 141, 156, 176, 196, 208, 214, 211, 200, 183, 160, 139, 125, 118, 121, 
-132, 151, 176, 196, 208, 212, 205, 191, 168, 141, 121, 108, 103, 111, 125, 150, 178, 196, 206, 206, 
-196, 178, 150, 122, 103, 92, 92, 103, 122, 152, 178, 195, 202, 198, 185, 162, 131, 105, 87, 79, 
-84, 98, 123, 154, 177, 191, 195, 188, 171, 145, 114, 91, 75, 72, 82, 101, 129, 157, 177, 189, 
-189, 178, 158, 129, 99, 79, 67, 69, 82, 104, 134, 160, 177, 185, 181, 167, 144, 113, 87, 70, 
-62, 68, 85, 110, 140, 164, 177, 182, 173, 157, 130, 99, 77, 62, 60, 70, 88, 117, 146, 165, 
-176, 176, 165, 145, 115, 87, 67, 56, 58, 72, 94, 125, 152, 168, 175, 171, 158, 134, 102, 78, 
-61, 54, 61, 78, 103, 134, 157, 170, 174, 166, 150, 122, 92, 70, 56, 54, 65, 85, 114, 143, 
-163, 173, 172, 162, 142, 113, 86, 66, 56, 59, 73, 94, 124, 151, 167, 174, 170, 155, 132, 101, 
-75, 58, 52, 60, 77, 104, 135, 158, 171, 174, 165, 149, 121, 90, 68, 55, 53, 65, 85, 115, 
-144, 163, 173, 172, 161, 141, 110, 82, 63, 53, 57, 71, 94, 126, 152, 167, 174, 169, 155, 131, 
-99, 75, 58, 53, 61, 78, 106, 137, 159, 172, 174, 166, 149, 121, 91, 69, 55, 55, 67, 87, 
-117, 146, 165, 174, 173, 162, 141, 111, 83, 64, 54, 58, 74, 98, 129, 155, 171, 177, 172, 158, 
-133, 101, 77, 61, 56, 65, 83, 110, 141, 163, 175, 178, 169, 151, 123, 92, 72, 58, 58, 71, 
-91, 122, 151, 169, 178, 176, 164, 143, 111, 85, 66, 57, 62, 77, 102, 133, 158, 173, 179, 173, 
-158, 132, 101, 76, 60, 55, 65, 83, 112, 142, 163, 176, 177, 168, 150, 121, 91, 71, 58, 59, 
-72, 92, 123, 151, 170, 179, 177, 164, 142, 111, 84, 66, 57, 63, 79, 103, 135, 160, 175, 180, 
-174, 159, 133, 101, 78, 63, 59, 69, 88, 117, 148, 168, 181, 181, 171, 152, 122, 92, 71, 59, 
-61, 73, 95, 127, 155, 173, 182, 179, 166, 144, 112, 85, 67, 59, 65, 81, 107, 138, 163, 178, 
-183, 176, 160, 133, 102, 79, 63, 60, 70, 89, 118, 149, 169, 181, 182, 172, 152, 122, 93, 72, 
-60, 62, 75, 98, 129, 157, 175, 183, 179, 166, 143, 112, 85, 67, 59, 67, 83, 108, 141, 165, 
-179, 184, 177, 161, 134, 102, 78, 64, 61, 72, 91, 121, 151, 172, 183, 183, 173, 153, 122, 94, 
-74, 62, 65, 79, 102, 133, 161, 178, 186, 182, 168, 144, 112, 87, 69, 62, 69, 86, 113, 144, 
-168, 182, 186, 178, 161, 134, 103, 80, 65, 63, 74, 94, 125, 154, 174, 186, 185, 174, 153, 123, 
-94, 74, 63, 66, 80, 103, 134, 161, 178, 185, 180, 166, 142, 110, 84, 68, 61, 68, 85, 112, 
-144, 168, 182, 185, 176, 160, 131, 100, 78, 64, 63, 74, 94, 125, 155, 174, 185, 184, 173, 152, 
-121, 93, 73, 63, 66, 81, 105, 137, 163, 180, 187, 182, 168, 144, 112, 86, 67, 60, 68, 86, 
-114, 146, 169, 183, 186, 178, 160, 131, 100, 77, 63, 62, 74, 95, 126, 156, 176, 186, 185, 173, 
-152, 120, 92, 72, 62, 66, 81, 105, 138, 165, 181, 187, 182, 167, 142, 110, 84, 67, 62, 71, 
-88, 117, 149, 171, 184, 186, 178, 160, 130, 99, 77, 64, 63, 76, 97, 128, 158, 177, 187, 185, 
-173, 151, 119, 91, 72, 62, 67, 82, 107, 140, 166, 182, 188, 182, 167, 141, 109, 84, 68, 63, 
-72, 90, 120, 151, 174, 187, 189, 180, 161, 132, 101, 79, 66, 66, 78, 100, 132, 161, 179, 189, 
-187, 174, 152, 120, 91, 73, 64, 69, 85, 110, 142, 169, 184, 190, 183, 168, 141, 109, 84, 68, 
-64, 74, 92, 121, 153, 175, 187, 188, 178, 159, 129, 98, 77, 64, 65, 77, 100, 132, 160, 179, 
-187, 184, 172, 149, 116, 89, 71, 62, 68, 84, 110, 143, 168, 183, 188, 182, 166, 138, 106, 82, 
-66, 62, 73, 92, 121, 153, 175, 187, 188, 178, 158, 128, 98, 77, 64, 66, 81, 101, 109, 111, 
-112, 112, 113, 113, 113, 114, 114, 114, 115, 115, 115, 116, 116, 116, 117, 117, 117, 117, 118, 118, 
-118, 118, 119, 119, 119, 119, 120, 120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 
-122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 125, 125, 
-125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 130, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 129, 130, 129, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 
-129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 130, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 
-128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 124, 122, 122, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 
-125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 128, 128, 128, 128, 128, 128, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 129, 129, 146, 164, 183, 195, 182, 172, 164, 142, 110, 82, 59, 40, 31, 34, 
-51, 71, 90, 118, 147, 162, 172, 188, 191, 179, 172, 164, 145, 134, 131, 131, 135, 148, 163, 182, 
-198, 207, 215, 217, 206, 190, 176, 148, 115, 98, 84, 50, 44, 51, 83, 127, 148, 170, 204, 216, 
-212, 183, 153, 136, 108, 81, 66, 59, 52, 57, 71, 89, 107, 123, 134, 136, 134, 127, 120, 106, 
-83, 67, 56, 49, 51, 70, 90, 107, 137, 168, 181, 194, 205, 204, 191, 180, 164, 143, 130, 124, 
-123, 128, 142, 160, 183, 202, 212, 220, 221, 210, 194, 178, 149, 121, 105, 90, 73, 73, 85, 87, 
-97, 119, 129, 131, 133, 131, 118, 104, 84, 64, 51, 39, 34, 46, 63, 79, 114, 151, 168, 188, 
-209, 210, 201, 195, 179, 156, 140, 130, 121, 121, 123, 134, 149, 168, 179, 193, 194, 178, 164, 152, 
-108, 69, 47, 46, 66, 70, 81, 121, 149, 174, 176, 164, 171, 168, 152, 136, 121, 91, 65, 49, 
-37, 30, 37, 49, 61, 81, 103, 120, 136, 142, 141, 136, 125, 105, 89, 80, 70, 68, 83, 97, 
-113, 141, 170, 187, 206, 221, 221, 212, 200, 180, 155, 139, 128, 120, 119, 122, 133, 150, 170, 185, 
-198, 201, 192, 183, 169, 142, 113, 93, 68, 41, 38, 43, 49, 65, 90, 108, 120, 128, 133, 133, 
-125, 111, 97, 82, 65, 63, 75, 82, 97, 128, 160, 182, 206, 223, 230, 229, 223, 206, 181, 148, 
-126, 112, 100, 93, 105, 117, 124, 139, 163, 151, 130, 123, 124, 143, 131, 107, 114, 118, 112, 101, 
-77, 87, 107, 123, 134, 151, 152, 145, 136, 121, 97, 69, 46, 26, 13, 14, 29, 52, 73, 100, 
-125, 142, 150, 158, 161, 152, 139, 129, 113, 98, 95, 100, 106, 119, 143, 168, 191, 212, 227, 230, 
-226, 216, 198, 174, 146, 128, 116, 107, 106, 115, 126, 137, 156, 171, 174, 171, 169, 153, 126, 103, 
-78, 50, 30, 22, 20, 29, 45, 69, 99, 120, 133, 147, 155, 148, 142, 140, 122, 105, 104, 106, 
-105, 116, 134, 151, 173, 196, 211, 222, 222, 213, 199, 177, 145, 121, 105, 82, 67, 74, 74, 63, 
-80, 105, 147, 173, 175, 187, 197, 186, 162, 115, 88, 74, 58, 52, 63, 76, 90, 112, 129, 137, 
-141, 140, 129, 112, 91, 68, 54, 43, 36, 41, 56, 72, 97, 129, 150, 164, 181, 190, 182, 175, 
-165, 142, 124, 118, 112, 111, 120, 136, 153, 178, 204, 220, 230, 227, 215, 200, 178, 150, 128, 112, 
-93, 84, 90, 96, 103, 125, 142, 142, 146, 150, 140, 124, 110, 86, 58, 39, 25, 24, 32, 47, 
-69, 101, 127, 147, 173, 187, 184, 185, 182, 161, 142, 131, 121, 114, 118, 128, 140, 156, 174, 191, 
-202, 202, 198, 190, 168, 136, 113, 89, 50, 34, 32, 60, 93, 110, 143, 185, 203, 208, 186, 168, 
-157, 134, 104, 82, 67, 49, 44, 50, 60, 74, 97, 115, 125, 134, 138, 138, 131, 117, 96, 78, 
-62, 51, 56, 66, 78, 102, 133, 156, 176, 198, 208, 205, 203, 192, 171, 148, 133, 121, 114, 118, 
-128, 141, 160, 180, 198, 210, 212, 208, 198, 178, 151, 127, 103, 76, 64, 62, 58, 64, 85, 105, 
-119, 132, 140, 139, 133, 121, 107, 87, 66, 52, 49, 50, 58, 85, 113, 137, 168, 198, 211, 216, 
-217, 208, 190, 167, 145, 128, 114, 104, 107, 118, 129, 147, 173, 185, 183, 184, 178, 138, 110, 85, 
-76, 83, 72, 69, 96, 118, 135, 139, 143, 163, 171, 167, 161, 152, 131, 105, 77, 55, 35, 27, 
-28, 36, 51, 72, 101, 127, 141, 152, 156, 152, 140, 129, 111, 89, 79, 80, 81, 90, 111, 133, 
-156, 183, 206, 218, 223, 220, 208, 189, 166, 145, 128, 115, 107, 110, 121, 133, 153, 176, 186, 190, 
-194, 188, 168, 150, 129, 93, 62, 47, 36, 31, 41, 60, 80, 103, 121, 136, 146, 146, 140, 135, 
-120, 96, 88, 86, 77, 83, 105, 124, 143, 174, 200, 217, 229, 235, 228, 213, 186, 156, 130, 109, 
-89, 88, 89, 88, 100, 129, 129, 125, 132, 144, 168, 163, 148, 147, 137, 122, 97, 67, 69, 78, 
-85, 104, 130, 139, 146, 150, 146, 132, 117, 94, 66, 45, 33, 27, 36, 43, 46, 51, 55, 55, 
-61, 70, 71, 76, 89, 95, 97, 106, 114, 115, 119, 127, 129, 130, 134, 136, 136, 138, 141, 142, 
-141, 138, 136, 136, 133, 130, 130, 126, 118, 116, 116, 107, 100, 102, 94, 80, 78, 77, 70, 67, 
-68, 66, 64, 65, 67, 73, 76, 78, 87, 94, 95, 103, 119, 122, 125, 139, 149, 148, 154, 159, 
-160, 160, 164, 164, 164, 161, 158, 157, 154, 145, 145, 142, 129, 118, 121, 103, 79, 73, 79, 109, 
-122, 122, 144, 163, 166, 160, 132, 125, 123, 113, 104, 105, 100, 94, 93, 93, 90, 90, 91, 90, 
-87, 87, 89, 95, 97, 98, 102, 106, 106, 111, 120, 122, 124, 136, 143, 143, 150, 159, 160, 162, 
-170, 173, 172, 175, 177, 176, 177, 180, 180, 179, 175, 172, 171, 168, 164, 163, 161, 152, 147, 147, 
-139, 130, 129, 123, 108, 104, 103, 96, 90, 91, 90, 87, 86, 88, 93, 96, 97, 104, 112, 113, 
-118, 134, 140, 141, 153, 165, 165, 169, 175, 176, 175, 178, 179, 179, 176, 172, 170, 165, 156, 153, 
-152, 142, 129, 130, 121, 94, 87, 88, 112, 130, 130, 145, 167, 172, 170, 146, 133, 132, 123, 114, 
-114, 111, 104, 102, 102, 100, 98, 99, 97, 94, 94, 95, 100, 103, 104, 107, 111, 111, 114, 123, 
-126, 126, 136, 144, 144, 149, 158, 160, 161, 168, 172, 171, 173, 175, 174, 174, 177, 177, 176, 173, 
-169, 169, 166, 162, 160, 159, 152, 146, 146, 141, 131, 129, 127, 113, 106, 106, 101, 94, 94, 94, 
-91, 90, 91, 95, 99, 99, 104, 112, 115, 116, 130, 139, 139, 149, 161, 162, 164, 170, 172, 172, 
-174, 175, 175, 174, 169, 168, 166, 160, 154, 155, 146, 132, 130, 125, 98, 88, 86, 105, 128, 129, 
-138, 162, 170, 170, 148, 132, 132, 124, 114, 112, 111, 104, 100, 100, 98, 96, 97, 96, 93, 92, 
-93, 97, 101, 101, 103, 107, 108, 109, 117, 122, 122, 129, 139, 141, 143, 152, 157, 156, 162, 167, 
-167, 168, 171, 171, 170, 172, 174, 173, 171, 167, 166, 164, 160, 157, 157, 151, 144, 143, 139, 128, 
-124, 124, 112, 103, 104, 100, 94, 92, 92, 89, 89, 89, 93, 97, 99, 101, 110, 113, 114, 125, 
-136, 136, 142, 154, 158, 158, 163, 166, 166, 167, 169, 169, 168, 164, 162, 161, 157, 150, 150, 145, 
-132, 126, 126, 103, 89, 86, 97, 122, 127, 130, 152, 164, 165, 151, 130, 129, 124, 115, 110, 110, 
-104, 100, 99, 98, 95, 96, 96, 93, 92, 92, 94, 99, 100, 102, 105, 108, 108, 114, 120, 121, 
-125, 135, 138, 140, 148, 153, 152, 157, 163, 163, 164, 166, 167, 166, 168, 169, 169, 167, 163, 162, 
-161, 158, 154, 154, 150, 143, 142, 140, 131, 126, 126, 118, 106, 105, 102, 95, 93, 94, 91, 89, 
-90, 92, 96, 98, 99, 107, 112, 112, 121, 134, 135, 138, 151, 157, 156, 161, 165, 165, 166, 168, 
-168, 168, 164, 162, 160, 157, 150, 149, 144, 132, 124, 125, 107, 88, 84, 89, 115, 124, 126, 147, 
-160, 163, 154, 130, 126, 123, 114, 107, 108, 103, 98, 97, 97, 94, 94, 94, 92, 90, 90, 92, 
-97, 99, 101, 104, 106, 107, 110, 116, 118, 120, 129, 132, 133, 138, 144, 144, 147, 152, 155, 154, 
-156, 157, 157, 157, 159, 159, 158, 155, 154, 153, 151, 148, 147, 145, 139, 137, 136, 130, 125, 125, 
-121, 110, 108, 107, 101, 98, 99, 97, 96, 96, 97, 100, 102, 103, 108, 114, 114, 118, 129, 132, 
-133, 142, 149, 149, 152, 156, 156, 156, 158, 158, 158, 156, 153, 153, 151, 145, 143, 142, 133, 125, 
-126, 116, 98, 93, 95, 114, 125, 125, 138, 153, 155, 152, 134, 127, 126, 119, 113, 113, 110, 105, 
-103, 103, 102, 101, 101, 100, 98, 98, 99, 103, 105, 106, 108, 111, 112, 114, 120, 122, 123, 131, 
-136, 136, 140, 147, 148, 149, 154, 156, 156, 158, 159, 159, 159, 161, 161, 160, 158, 155, 155, 153, 
-150, 149, 148, 142, 138, 138, 133, 127, 126, 123, 112, 108, 108, 103, 98, 99, 97, 95, 95, 96, 
-99, 101, 102, 106, 112, 113, 115, 126, 131, 132, 139, 147, 147, 149, 152, 154, 153, 155, 155, 156, 
-153, 152, 149, 170, 196, 216, 238, 244, 241, 218, 175, 145, 126, 126, 129, 126, 146, 161, 163, 159, 
-164, 143, 126, 120, 132, 179, 218, 236, 245, 237, 191, 143, 118, 104, 113, 123, 147, 169, 180, 175, 
-148, 108, 82, 67, 72, 88, 116, 142, 157, 157, 139, 100, 64, 43, 43, 64, 105, 142, 162, 164, 
-152, 126, 93, 71, 65, 80, 119, 158, 179, 184, 175, 163, 136, 113, 103, 111, 144, 184, 206, 215, 
-207, 194, 167, 141, 127, 130, 151, 186, 211, 223, 219, 205, 176, 147, 129, 128, 141, 165, 193, 208, 
-210, 195, 162, 129, 108, 104, 114, 130, 157, 176, 182, 171, 137, 98, 75, 66, 76, 83, 106, 129, 
-138, 132, 104, 63, 36, 23, 30, 49, 81, 108, 123, 120, 106, 80, 53, 38, 39, 61, 102, 133, 
-150, 151, 143, 132, 106, 89, 83, 100, 146, 183, 204, 209, 197, 178, 146, 123, 113, 123, 151, 188, 
-211, 220, 210, 183, 144, 116, 102, 108, 123, 150, 174, 185, 182, 154, 106, 76, 57, 63, 62, 66, 
-92, 108, 108, 105, 109, 83, 67, 63, 88, 143, 181, 201, 206, 190, 136, 93, 71, 65, 74, 86, 
-112, 133, 142, 135, 107, 71, 48, 38, 46, 63, 93, 118, 130, 127, 107, 72, 44, 29, 32, 54, 
-91, 120, 138, 137, 125, 100, 71, 53, 51, 67, 106, 141, 161, 165, 155, 141, 113, 92, 85, 96, 
-134, 175, 198, 205, 196, 180, 148, 122, 110, 117, 144, 183, 209, 221, 214, 195, 161, 130, 114, 117, 
-133, 163, 192, 207, 206, 187, 149, 116, 96, 95, 108, 128, 156, 173, 178, 162, 123, 87, 66, 61, 
-72, 82, 108, 129, 137, 127, 95, 56, 32, 23, 33, 53, 86, 112, 124, 120, 105, 76, 51, 38, 
-42, 68, 109, 137, 153, 150, 144, 128, 101, 86, 84, 105, 152, 187, 206, 207, 195, 172, 141, 120, 
-113, 126, 157, 194, 215, 221, 209, 178, 140, 115, 103, 112, 129, 158, 181, 190, 183, 149, 102, 76, 
-59, 68, 66, 76, 102, 117, 113, 111, 109, 82, 70, 68, 99, 156, 191, 208, 211, 189, 131, 92, 
-71, 68, 78, 92, 120, 140, 146, 136, 103, 68, 47, 39, 49, 69, 101, 125, 135, 130, 105, 68, 
-42, 29, 36, 61, 100, 129, 144, 141, 127, 99, 72, 55, 55, 77, 118, 151, 169, 169, 159, 142, 
-113, 93, 87, 104, 146, 182, 203, 207, 196, 177, 146, 121, 112, 122, 152, 190, 213, 221, 213, 192, 
-158, 129, 115, 121, 140, 171, 198, 210, 207, 185, 146, 115, 97, 100, 113, 137, 164, 180, 181, 163, 
-121, 86, 65, 65, 75, 89, 118, 137, 143, 130, 94, 56, 32, 25, 38, 62, 97, 121, 131, 123, 
-105, 75, 50, 38, 47, 76, 118, 145, 159, 153, 146, 126, 100, 86, 87, 113, 161, 193, 210, 207, 
-195, 169, 138, 119, 116, 132, 166, 200, 219, 223, 208, 174, 137, 113, 105, 116, 136, 166, 186, 193, 
-184, 146, 102, 76, 63, 73, 72, 88, 112, 125, 120, 122, 111, 82, 72, 73, 111, 166, 199, 214, 
-215, 183, 125, 91, 70, 72, 82, 100, 128, 147, 151, 136, 99, 65, 46, 41, 54, 77, 109, 131, 
-139, 130, 101, 64, 40, 30, 39, 69, 108, 136, 150, 144, 127, 96, 69, 54, 58, 83, 126, 157, 
-173, 170, 159, 137, 108, 90, 88, 109, 151, 186, 206, 206, 194, 172, 140, 118, 112, 125, 158, 194, 
-215, 221, 210, 186, 151, 125, 114, 123, 144, 177, 201, 212, 205, 180, 140, 111, 96, 102, 116, 144, 
-171, 185, 184, 161, 117, 85, 66, 68, 79, 98, 128, 145, 149, 132, 92, 55, 33, 29, 44, 72, 
-107, 130, 137, 127, 105, 72, 49, 39, 51, 86, 127, 152, 164, 156, 147, 123, 97, 84, 88, 121, 
-168, 196, 211, 206, 191, 162, 131, 113, 114, 133, 170, 202, 221, 221, 203, 166, 130, 107, 103, 116, 
-140, 171, 190, 195, 182, 140, 99, 73, 64, 73, 74, 97, 121, 132, 125, 126, 108, 80, 70, 77, 
-123, 174, 203, 216, 214, 177, 120, 88, 69, 74, 85, 109, 138, 155, 156, 137, 98, 65, 45, 45, 
-59, 86, 119, 139, 144, 132, 100, 63, 39, 32, 45, 77, 117, 143, 152, 144, 124, 92, 66, 55, 
-62, 91, 134, 162, 177, 171, 159, 132, 104, 90, 92, 116, 154, 181, 199, 207, 209, 205, 185, 156, 
-130, 114, 107, 112, 125, 147, 176, 201, 215, 220, 213, 198, 172, 141, 119, 104, 99, 104, 118, 144, 
-172, 191, 194, 189, 179, 162, 136, 104, 78, 66, 64, 76, 86, 102, 129, 145, 156, 149, 131, 110, 
-81, 58, 41, 31, 36, 50, 72, 103, 131, 147, 153, 148, 136, 120, 95, 74, 62, 61, 84, 105, 
-130, 158, 176, 198, 208, 201, 186, 158, 136, 120, 107, 108, 119, 141, 171, 194, 207, 214, 209, 195, 
-175, 146, 123, 104, 91, 95, 106, 128, 153, 160, 169, 172, 167, 148, 102, 67, 46, 32, 31, 63, 
-92, 120, 149, 168, 199, 210, 202, 185, 160, 117, 83, 71, 70, 83, 94, 114, 137, 151, 160, 153, 
-136, 115, 86, 63, 47, 38, 43, 57, 80, 109, 130, 143, 148, 142, 128, 107, 78, 58, 46, 47, 
-61, 80, 107, 135, 155, 173, 178, 170, 153, 123, 104, 94, 83, 87, 98, 126, 160, 184, 200, 207, 
-208, 203, 182, 152, 127, 112, 108, 114, 129, 152, 181, 204, 216, 219, 209, 192, 163, 134, 112, 98, 
-94, 100, 117, 144, 173, 190, 192, 187, 176, 157, 130, 97, 74, 63, 64, 77, 87, 108, 134, 150, 
-159, 151, 131, 109, 79, 56, 41, 32, 40, 55, 80, 112, 137, 152, 157, 150, 136, 118, 91, 72, 
-60, 63, 86, 107, 135, 161, 179, 201, 207, 199, 181, 152, 130, 114, 104, 107, 119, 143, 174, 196, 
-208, 214, 207, 192, 170, 140, 118, 99, 88, 94, 108, 132, 154, 162, 173, 173, 167, 144, 98, 65, 
-46, 32, 37, 70, 95, 125, 152, 173, 202, 208, 198, 180, 150, 105, 78, 68, 70, 83, 96, 118, 
-141, 155, 162, 152, 135, 113, 83, 61, 45, 38, 47, 62, 88, 117, 136, 149, 152, 144, 129, 105, 
-76, 58, 47, 49, 64, 85, 114, 141, 160, 177, 179, 169, 149, 118, 102, 90, 82, 88, 101, 131, 
-165, 188, 202, 208, 209, 201, 176, 147, 122, 108, 106, 114, 130, 155, 184, 206, 216, 217, 207, 189, 
-159, 131, 110, 97, 96, 103, 121, 150, 177, 192, 192, 186, 173, 154, 125, 93, 71, 61, 64, 77, 
-88, 113, 138, 153, 159, 148, 129, 104, 74, 53, 38, 33, 42, 59, 85, 117, 141, 154, 157, 148, 
-135, 113, 87, 69, 59, 65, 88, 110, 139, 164, 183, 204, 205, 196, 176, 146, 125, 109, 100, 105, 
-119, 147, 176, 197, 209, 213, 204, 188, 163, 134, 112, 94, 87, 94, 110, 136, 156, 165, 176, 174, 
-167, 137, 94, 64, 45, 33, 42, 75, 99, 131, 157, 178, 204, 206, 195, 175, 142, 99, 75, 66, 
-71, 85, 100, 124, 146, 159, 164, 153, 135, 110, 81, 60, 44, 40, 49, 66, 94, 122, 141, 153, 
-154, 144, 127, 100, 73, 56, 46, 51, 67, 89, 119, 145, 163, 179, 179, 168, 144, 116, 100, 86, 
-80, 87, 103, 135, 168, 189, 203, 208, 208, 196, 170, 140, 117, 104, 104, 113, 131, 159, 188, 207, 
-217, 215, 205, 184, 154, 126, 106, 95, 95, 105, 125, 156, 181, 193, 193, 186, 172, 151, 119, 88, 
-70, 62, 67, 80, 93, 119, 142, 156, 159, 145, 126, 100, 71, 51, 37, 34, 44, 62, 93, 126, 
-148, 161, 162, 151, 136, 110, 83, 66, 55, 64, 86, 110, 140, 164, 185, 201, 199, 189, 165, 133, 
-112, 95, 89, 96, 113, 142, 173, 194, 207, 209, 200, 182, 154, 125, 102, 85, 81, 91, 109, 137, 
-159, 170, 180, 178, 168, 136, 94, 66, 48, 37, 49, 79, 103, 137, 162, 185, 205, 203, 190, 168, 
-132, 93, 72, 65, 73, 86, 105, 133, 154, 167, 170, 158, 139, 111, 81, 60, 45, 43, 54, 74, 
-104, 132, 151, 162, 161, 150, 131, 101, 74, 56, 47, 54, 71, 95, 127, 152, 171, 184, 180, 167, 
-141, 111, 94, 80, 76, 84, 103, 137, 168, 189, 202, 206, 203, 188, 160, 128, 106, 95, 95, 107, 
-127, 157, 186, 205, 214, 211, 199, 177, 144, 116, 97, 87, 89, 102, 126, 157, 183, 195, 195, 187, 
-171, 147, 114, 85, 67, 62, 70, 83, 102, 131, 154, 167, 168, 153, 133, 104, 74, 55, 40, 40, 
-53, 74, 105, 134, 154, 163, 161, 150, 133, 108, 85, 69, 61, 73, 94, 116, 145, 166, 185, 197, 
-195, 193, 192, 193, 195, 194, 193, 191, 191, 191, 191, 189, 188, 187, 184, 183, 182, 181, 179, 174, 
-171, 170, 170, 169, 161, 156, 155, 154, 154, 139, 127, 126, 125, 125, 138, 151, 151, 153, 150, 161, 
-172, 174, 174, 174, 164, 149, 145, 143, 143, 140, 132, 130, 129, 129, 127, 121, 120, 119, 119, 119, 
-117, 116, 116, 115, 115, 113, 112, 112, 112, 112, 114, 116, 116, 117, 116, 118, 120, 120, 120, 120, 
-123, 128, 128, 128, 127, 131, 138, 139, 139, 138, 141, 146, 147, 147, 146, 147, 151, 152, 152, 151, 
-151, 153, 153, 152, 151, 151, 152, 152, 152, 151, 150, 148, 146, 145, 144, 144, 141, 139, 139, 138, 
-138, 134, 129, 129, 128, 128, 125, 119, 118, 117, 117, 113, 104, 102, 102, 102, 101, 96, 94, 95, 
-95, 95, 93, 92, 93, 93, 94, 97, 99, 99, 100, 101, 106, 109, 110, 111, 111, 119, 125, 126, 
-127, 126, 134, 140, 140, 140, 139, 141, 144, 144, 144, 143, 144, 145, 145, 144, 144, 142, 140, 139, 
-138, 138, 135, 129, 127, 126, 126, 125, 117, 113, 113, 113, 112, 98, 90, 90, 90, 91, 104, 114, 
-115, 117, 116, 127, 136, 138, 138, 138, 129, 118, 116, 115, 116, 113, 108, 107, 107, 107, 106, 102, 
-101, 101, 102, 101, 100, 100, 100, 100, 100, 99, 98, 98, 99, 100, 102, 104, 104, 105, 105, 107, 
-109, 109, 110, 110, 114, 117, 118, 118, 118, 123, 128, 128, 129, 128, 131, 136, 137, 137, 136, 138, 
-142, 142, 142, 141, 142, 143, 143, 143, 142, 142, 144, 144, 143, 143, 142, 140, 139, 138, 138, 137, 
-135, 134, 133, 133, 133, 129, 126, 125, 125, 125, 121, 117, 116, 116, 117, 111, 105, 104, 104, 104, 
-102, 99, 98, 98, 99, 99, 97, 98, 98, 99, 100, 102, 104, 104, 105, 106, 111, 113, 114, 114, 
-115, 123, 127, 128, 128, 128, 135, 140, 140, 140, 140, 142, 145, 145, 145, 144, 145, 146, 146, 145, 
-145, 144, 141, 141, 140, 140, 138, 134, 133, 132, 132, 129, 121, 119, 117, 118, 114, 99, 95, 94, 
-94, 96, 111, 119, 120, 121, 121, 132, 137, 139, 138, 138, 129, 121, 120, 119, 120, 116, 112, 112, 
-111, 112, 110, 107, 107, 107, 107, 107, 106, 106, 106, 107, 106, 105, 105, 105, 106, 107, 110, 111, 
-112, 112, 113, 115, 116, 116, 116, 117, 121, 123, 123, 123, 124, 128, 132, 132, 132, 132, 135, 138, 
-139, 139, 138, 141, 143, 143, 143, 143, 143, 145, 145, 144, 144, 144, 145, 145, 145, 144, 144, 142, 
-141, 140, 140, 139, 137, 136, 136, 135, 135, 131, 129, 129, 128, 128, 124, 121, 121, 121, 121, 116, 
-111, 111, 110, 111, 108, 106, 105, 106, 106, 105, 104, 104, 105, 105, 106, 109, 109, 110, 110, 112, 
-116, 117, 118, 118, 120, 127, 129, 130, 130, 131, 137, 141, 141, 141, 141, 144, 145, 145, 145, 144, 
-145, 146, 145, 145, 145, 143, 142, 141, 141, 141, 138, 135, 135, 134, 134, 131, 124, 124, 122, 123, 
-118, 107, 103, 103, 103, 107, 120, 124, 125, 125, 127, 138, 142, 143, 142, 141, 131, 124, 123, 122, 
-122, 117, 114, 114, 114, 114, 112, 112, 112, 113, 113, 113, 112, 112, 112, 113, 112, 111, 112, 112, 
-112, 113, 115, 115, 116, 116, 116, 118, 118, 119, 119, 120, 123, 124, 124, 124, 125, 128, 130, 131, 
-131, 131, 135, 137, 137, 137, 137, 138, 140, 140, 140, 140, 140, 141, 141, 141, 140, 141, 141, 141, 
-141, 141, 140, 139, 138, 138, 138, 137, 136, 135, 135, 135, 134, 131, 130, 130, 130, 129, 126, 125, 
-125, 124, 124, 120, 117, 117, 117, 117, 115, 113, 113, 113, 113, 113, 112, 112, 112, 112, 114, 115, 
-115, 116, 116, 118, 120, 121, 122, 121, 123, 128, 129, 130, 130, 131, 135, 137, 137, 137, 137, 139, 
-140, 140, 139, 139, 140, 140, 140, 140, 140, 139, 138, 137, 137, 137, 136, 134, 134, 133, 133, 130, 
-126, 126, 125, 126, 121, 113, 112, 111, 111, 115, 124, 126, 127, 127, 129, 136, 139, 139, 140, 138, 
-130, 127, 126, 126, 126, 122, 120, 120, 120, 120, 118, 116, 116, 116, 117, 116, 115, 115, 115, 115, 
-114, 113, 113, 113, 113, 114, 116, 116, 117, 119, 120, 121, 122, 122, 122, 123, 125, 125, 126, 126, 
-127, 129, 130, 130, 130, 131, 133, 134, 134, 134, 134, 135, 136, 136, 136, 136, 137, 137, 137, 137, 
-137, 137, 137, 137, 138, 138, 138, 137, 137, 136, 136, 136, 135, 134, 134, 134, 133, 131, 131, 131, 
-131, 130, 128, 127, 127, 127, 126, 123, 122, 121, 121, 121, 119, 119, 119, 119, 119, 118, 118, 118, 
-118, 119, 120, 120, 121, 121, 121, 123, 124, 124, 124, 124, 127, 129, 130, 130, 130, 132, 134, 135, 
-135, 134, 135, 136, 136, 136, 136, 136, 137, 137, 137, 136, 136, 135, 135, 134, 134, 134, 132, 132, 
-131, 131, 131, 128, 126, 126, 126, 125, 120, 116, 116, 116, 116, 121, 126, 127, 128, 127, 132, 136, 
-137, 137, 137, 133, 129, 128, 127, 127, 126, 123, 123, 123, 123, 122, 121, 120, 120, 121, 120, 120, 
-120, 120, 120, 120, 119, 119, 119, 119, 119, 120, 121, 121, 122, 122, 123, 123, 123, 124, 124, 125, 
-126, 126, 126, 126, 127, 129, 130, 130, 130, 131, 132, 131, 131, 130, 131, 132, 132, 132, 132, 132, 
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 130, 130, 130, 130, 
-130, 129, 129, 129, 129, 128, 127, 127, 128, 128, 128, 126, 126, 126, 126, 126, 125, 125, 125, 125, 
-125, 124, 124, 124, 124, 124, 125, 125, 125, 125, 126, 126, 127, 127, 127, 127, 129, 130, 130, 130, 
-130, 131, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 132, 132, 131, 131, 
-131, 131, 130, 130, 130, 129, 129, 128, 127, 127, 127, 126, 123, 122, 122, 122, 122, 125, 127, 127, 
-127, 127, 130, 131, 132, 132, 132, 130, 128, 127, 127, 127, 126, 125, 125, 125, 125, 125, 124, 124, 
-124, 125, 125, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 
-126, 126, 126, 127, 128, 128, 128, 128, 129, 130, 130, 130, 130, 131, 131, 131, 131, 131, 132, 132, 
-132, 132, 132, 132, 132, 132, 131, 131, 131, 131, 131, 131, 131, 128, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 129, 129, 129, 129, 129, 129, 
-129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 128, 127, 127, 126, 128, 107, 79, 65, 
-45, 33, 23, 18, 19, 27, 39, 55, 76, 94, 105, 114, 116, 113, 105, 94, 77, 62, 52, 46, 
-44, 50, 59, 72, 91, 109, 122, 131, 135, 132, 124, 111, 91, 73, 59, 50, 46, 51, 62, 76, 
-97, 120, 137, 149, 155, 154, 145, 131, 110, 86, 69, 57, 51, 54, 65, 80, 102, 127, 147, 162, 
-171, 171, 163, 149, 127, 101, 81, 65, 56, 57, 67, 83, 104, 131, 154, 170, 181, 182, 175, 162, 
-143, 117, 93, 76, 65, 63, 71, 85, 105, 132, 157, 174, 185, 189, 184, 173, 155, 129, 104, 85, 
-73, 68, 73, 87, 105, 131, 158, 176, 189, 194, 191, 181, 165, 141, 114, 94, 81, 73, 76, 87, 
-104, 128, 155, 176, 190, 198, 196, 188, 173, 151, 123, 103, 87, 78, 78, 88, 104, 126, 153, 174, 
-190, 199, 201, 193, 179, 159, 133, 109, 93, 81, 79, 87, 102, 121, 147, 171, 188, 198, 202, 196, 
-184, 166, 140, 115, 97, 84, 79, 85, 98, 116, 142, 167, 184, 197, 201, 197, 186, 170, 146, 120, 
-101, 86, 79, 82, 93, 111, 135, 161, 181, 195, 202, 200, 190, 176, 154, 127, 105, 89, 80, 80, 
-90, 106, 129, 155, 176, 191, 201, 201, 193, 179, 159, 132, 109, 92, 81, 79, 87, 102, 122, 148, 
-172, 188, 199, 202, 197, 184, 166, 141, 116, 97, 84, 79, 85, 99, 117, 143, 168, 185, 197, 202, 
-198, 187, 171, 147, 120, 100, 85, 78, 81, 93, 111, 135, 161, 181, 194, 201, 199, 189, 174, 151, 
-124, 103, 87, 78, 78, 89, 105, 128, 154, 175, 191, 199, 200, 191, 176, 156, 128, 106, 89, 77, 
-76, 84, 99, 119, 146, 170, 186, 196, 199, 193, 179, 160, 135, 110, 91, 78, 74, 80, 94, 113, 
-139, 164, 182, 194, 199, 194, 183, 166, 141, 114, 95, 80, 73, 77, 90, 107, 132, 159, 179, 192, 
-199, 196, 186, 171, 147, 120, 98, 83, 74, 75, 86, 101, 125, 152, 173, 189, 197, 197, 188, 174, 
-153, 125, 102, 85, 74, 73, 82, 97, 117, 145, 168, 184, 195, 197, 191, 177, 157, 131, 105, 87, 
-74, 71, 77, 91, 110, 137, 162, 180, 192, 197, 192, 180, 162, 136, 110, 90, 76, 69, 73, 86, 
-104, 128, 156, 176, 189, 196, 193, 183, 167, 143, 115, 94, 79, 70, 71, 82, 98, 122, 149, 171, 
-187, 195, 195, 186, 171, 150, 121, 99, 83, 72, 71, 80, 95, 116, 144, 168, 184, 195, 196, 190, 
-176, 156, 129, 104, 85, 73, 69, 76, 90, 109, 136, 162, 180, 191, 196, 191, 179, 160, 134, 108, 
-89, 74, 68, 72, 85, 103, 129, 156, 175, 189, 195, 192, 181, 164, 141, 113, 91, 76, 67, 69, 
-80, 97, 121, 148, 169, 185, 193, 192, 183, 168, 146, 118, 95, 78, 68, 67, 76, 92, 113, 141, 
-165, 181, 191, 193, 186, 172, 151, 125, 99, 81, 69, 66, 73, 87, 107, 134, 160, 178, 189, 193, 
-188, 177, 158, 131, 105, 86, 72, 66, 71, 84, 102, 128, 155, 174, 187, 193, 190, 179, 163, 138, 
-110, 89, 75, 66, 68, 80, 97, 121, 148, 169, 184, 192, 191, 182, 167, 144, 116, 94, 77, 67, 
-66, 76, 91, 112, 142, 166, 182, 192, 194, 186, 171, 151, 124, 98, 80, 67, 64, 72, 86, 107, 
-134, 159, 178, 189, 193, 188, 175, 156, 129, 103, 83, 69, 63, 68, 82, 100, 127, 154, 173, 187, 
-193, 190, 178, 161, 137, 109, 88, 72, 64, 66, 79, 97, 121, 150, 171, 186, 194, 192, 183, 167, 
-144, 116, 94, 77, 66, 65, 76, 92, 115, 143, 165, 182, 192, 193, 185, 170, 150, 123, 97, 79, 
-67, 64, 72, 87, 107, 135, 160, 178, 189, 193, 187, 174, 155, 128, 102, 82, 68, 63, 68, 82, 
-100, 127, 154, 173, 186, 192, 188, 177, 159, 135, 106, 86, 70, 62, 65, 77, 95, 119, 147, 169, 
-183, 191, 189, 180, 164, 140, 112, 90, 73, 63, 63, 74, 90, 113, 141, 164, 180, 190, 191, 183, 
-168, 147, 119, 95, 78, 66, 63, 72, 87, 107, 135, 160, 178, 189, 192, 187, 173, 153, 127, 101, 
-81, 67, 63, 68, 82, 101, 128, 154, 173, 187, 192, 188, 176, 159, 134, 106, 86, 70, 62, 65, 
-78, 96, 121, 148, 169, 184, 193, 191, 181, 164, 140, 112, 89, 73, 62, 63, 73, 90, 114, 142, 
-164, 181, 191, 192, 183, 168, 146, 117, 94, 76, 64, 61, 70, 86, 106, 135, 160, 177, 188, 192, 
-186, 172, 152, 125, 99, 80, 66, 61, 68, 82, 101, 128, 155, 174, 187, 193, 189, 177, 160, 134, 
-106, 86, 70, 62, 66, 79, 97, 122, 150, 171, 185, 193, 191, 180, 164, 140, 112, 89, 73, 63, 
-64, 75, 91, 115, 143, 166, 182, 192, 192, 183, 168, 146, 117, 94, 76, 64, 62, 71, 87, 108, 
-136, 161, 178, 189, 192, 185, 171, 151, 124, 98, 79, 65, 61, 67, 82, 101, 129, 154, 173, 186, 
-192, 187, 175, 156, 130, 103, 83, 68, 60, 64, 78, 96, 121, 149, 170, 184, 191, 189, 178, 161, 
-138, 110, 88, 71, 62, 63, 74, 92, 116, 144, 166, 182, 192, 191, 182, 167, 145, 116, 93, 76, 
-64, 62, 72, 88, 108, 137, 161, 178, 190, 192, 185, 171, 151, 124, 98, 79, 65, 61, 68, 83, 
-103, 130, 156, 175, 187, 192, 187, 175, 158, 132, 104, 84, 68, 61, 65, 79, 97, 123, 151, 171, 
-186, 192, 190, 178, 161, 137, 109, 87, 71, 61, 62, 74, 92, 116, 143, 166, 182, 191, 191, 181, 
-166, 144, 115, 92, 74, 62, 61, 71, 87, 108, 137, 161, 179, 190, 193, 186, 171, 151, 124, 98, 
-80, 66, 62, 69, 84, 104, 132, 158, 177, 189, 194, 189, 176, 157, 130, 104, 83, 68, 61, 66, 
-80, 98, 125, 152, 172, 186, 193, 190, 178, 162, 137, 109, 87, 71, 62, 63, 75, 93, 117, 145, 
-167, 183, 192, 191, 181, 166, 143, 114, 91, 74, 62, 61, 71, 87, 109, 137, 162, 178, 190, 192, 
-184, 169, 149, 121, 96, 77, 64, 60, 68, 82, 103, 131, 156, 175, 187, 192, 187, 174, 155, 128, 
-101, 81, 66, 60, 65, 79, 98, 124, 152, 171, 186, 193, 190, 178, 161, 136, 108, 86, 71, 61, 
-63, 76, 94, 118, 146, 168, 184, 192, 191, 181, 165, 142, 114, 91, 74, 62, 61, 72, 88, 112, 
-140, 163, 180, 191, 192, 184, 169, 149, 121, 96, 78, 65, 62, 70, 85, 105, 132, 158, 177, 189, 
-193, 187, 174, 155, 127, 101, 80, 65, 60, 65, 79, 98, 125, 152, 172, 186, 192, 189, 177, 160, 
-135, 106, 85, 68, 60, 62, 75, 93, 118, 146, 168, 183, 192, 190, 181, 165, 141, 113, 90, 73, 
-62, 62, 73, 90, 113, 142, 164, 181, 192, 194, 185, 170, 149, 120, 96, 77, 64, 61, 70, 86, 
-106, 134, 159, 178, 190, 194, 188, 174, 154, 127, 101, 81, 66, 61, 67, 81, 99, 127, 154, 173, 
-187, 193, 189, 177, 160, 135, 106, 85, 68, 60, 63, 76, 94, 119, 147, 169, 184, 192, 190, 180, 
-164, 140, 112, 89, 72, 61, 61, 72, 89, 112, 140, 163, 180, 191, 192, 183, 168, 146, 117, 94, 
-75, 63, 60, 69, 85, 105, 133, 159, 177, 189, 192, 186, 172, 152, 126, 100, 80, 66, 60, 67, 
-81, 101, 128, 154, 174, 187, 193, 189, 177, 159, 133, 105, 85, 68, 60, 64, 77, 95, 120, 148, 
-169, 184, 192, 190, 179, 163, 140, 112, 89, 72, 62, 62, 75, 92, 117, 145, 169, 186, 196, 196, 
-187, 172, 149, 120, 96, 77, 64, 61, 70, 86, 107, 135, 161, 179, 191, 194, 188, 174, 154, 127, 
-100, 80, 65, 60, 66, 81, 101, 128, 155, 174, 188, 194, 190, 178, 159, 133, 105, 84, 68, 60, 
-63, 77, 95, 121, 149, 171, 186, 195, 193, 182, 165, 141, 113, 90, 73, 62, 62, 74, 91, 115, 
-143, 166, 183, 193, 193, 184, 169, 147, 118, 94, 76, 63, 61, 70, 86, 107, 136, 161, 179, 191, 
-194, 187, 173, 153, 125, 99, 79, 65, 60, 66, 81, 101, 128, 155, 175, 188, 193, 188, 176, 157, 
-131, 103, 83, 66, 59, 62, 76, 94, 121, 149, 170, 185, 192, 190, 179, 162, 138, 109, 86, 70, 
-60, 61, 72, 90, 114, 142, 165, 182, 191, 192, 182, 167, 144, 115, 92, 74, 61, 60, 69, 86, 
-107, 136, 161, 179, 191, 194, 187, 172, 151, 124, 97, 78, 64, 59, 66, 80, 100, 129, 157, 177, 
-190, 195, 189, 176, 157, 130, 104, 84, 71, 66, 70, 83, 99, 123, 143, 145, 145, 146, 155, 157, 
-157, 170, 180, 178, 185, 199, 201, 200, 206, 208, 206, 207, 208, 207, 205, 199, 196, 194, 188, 179, 
-180, 170, 155, 149, 148, 118, 102, 98, 114, 144, 147, 155, 186, 197, 200, 177, 149, 148, 139, 125, 
-118, 119, 108, 102, 101, 99, 95, 95, 94, 90, 88, 89, 93, 99, 99, 101, 106, 109, 108, 118, 
-126, 126, 132, 147, 150, 152, 163, 170, 168, 174, 182, 182, 182, 186, 186, 185, 187, 189, 188, 185, 
-178, 176, 174, 169, 164, 164, 156, 145, 144, 140, 127, 120, 121, 106, 89, 89, 84, 74, 71, 72, 
-67, 65, 65, 68, 75, 77, 79, 91, 97, 97, 111, 129, 129, 135, 153, 161, 159, 167, 172, 172, 
-172, 176, 175, 175, 168, 165, 163, 159, 147, 148, 140, 122, 112, 115, 85, 59, 54, 65, 103, 115, 
-117, 149, 167, 170, 154, 120, 117, 112, 98, 89, 91, 82, 74, 74, 73, 69, 69, 69, 66, 63, 
-64, 67, 74, 75, 78, 82, 87, 86, 94, 105, 106, 111, 126, 132, 132, 142, 152, 150, 153, 162, 
-164, 164, 168, 169, 168, 169, 171, 171, 169, 163, 160, 159, 155, 150, 150, 145, 134, 131, 130, 119, 
-110, 111, 102, 84, 81, 79, 69, 65, 66, 63, 60, 60, 63, 69, 72, 74, 84, 93, 92, 101, 
-121, 125, 127, 143, 155, 154, 160, 166, 167, 166, 170, 170, 170, 166, 162, 162, 158, 148, 146, 143, 
-127, 113, 116, 97, 65, 59, 65, 100, 116, 115, 140, 164, 167, 160, 126, 117, 114, 102, 92, 93, 
-87, 78, 77, 77, 74, 72, 73, 71, 67, 68, 70, 77, 79, 81, 85, 90, 90, 94, 105, 108, 
-110, 124, 133, 132, 140, 151, 152, 153, 163, 167, 166, 169, 171, 170, 171, 174, 174, 173, 169, 165, 
-164, 160, 155, 154, 152, 141, 135, 135, 127, 115, 115, 109, 90, 85, 85, 76, 69, 71, 69, 65, 
-65, 67, 73, 77, 78, 86, 96, 98, 103, 122, 130, 131, 146, 159, 159, 163, 170, 172, 171, 174, 
-175, 175, 171, 166, 165, 162, 153, 148, 148, 134, 118, 118, 108, 73, 63, 63, 95, 118, 117, 133, 
-161, 167, 165, 136, 119, 119, 108, 97, 96, 93, 83, 81, 81, 78, 75, 77, 75, 71, 71, 72, 
-78, 82, 83, 86, 91, 92, 96, 106, 111, 111, 122, 133, 133, 138, 150, 153, 153, 162, 167, 166, 
-168, 171, 171, 171, 174, 175, 174, 170, 166, 165, 162, 157, 155, 154, 146, 138, 138, 132, 121, 120, 
-117, 100, 91, 92, 85, 77, 77, 76, 72, 72, 72, 77, 82, 83, 88, 99, 102, 104, 120, 133, 
-132, 144, 159, 160, 162, 169, 172, 171, 173, 176, 175, 173, 168, 166, 164, 157, 150, 150, 141, 124, 
-120, 115, 81, 69, 66, 89, 118, 120, 129, 159, 169, 169, 143, 122, 122, 114, 101, 98, 98, 89, 
-84, 84, 82, 79, 80, 80, 76, 75, 76, 80, 86, 86, 90, 94, 96, 98, 108, 114, 114, 122, 
-136, 137, 141, 152, 157, 156, 163, 170, 170, 171, 175, 175, 174, 177, 178, 178, 175, 170, 169, 167, 
-162, 158, 158, 151, 142, 141, 137, 125, 120, 120, 106, 93, 93, 89, 80, 78, 78, 74, 73, 73, 
-77, 84, 86, 89, 99, 104, 105, 119, 132, 132, 139, 154, 158, 158, 164, 168, 168, 169, 171, 170, 
-170, 164, 162, 161, 156, 147, 148, 141, 125, 119, 120, 91, 74, 70, 83, 114, 120, 126, 154, 165, 
-167, 150, 125, 123, 118, 106, 100, 102, 94, 88, 88, 87, 84, 84, 84, 81, 79, 80, 83, 89, 
-90, 93, 98, 101, 101, 109, 117, 117, 122, 135, 139, 140, 150, 156, 156, 160, 168, 169, 169, 172, 
-173, 172, 174, 176, 175, 174, 169, 167, 165, 162, 157, 157, 152, 143, 141, 139, 128, 122, 123, 113, 
-97, 96, 93, 85, 82, 83, 79, 77, 78, 80, 86, 88, 89, 99, 105, 105, 115, 131, 133, 136, 
-152, 160, 159, 164, 169, 170, 170, 173, 173, 173, 168, 165, 164, 160, 151, 150, 146, 131, 121, 123, 
-102, 77, 73, 79, 110, 123, 124, 149, 167, 169, 159, 130, 125, 122, 112, 103, 104, 98, 91, 90, 
-90, 86, 86, 87, 84, 81, 82, 84, 90, 91, 93, 97, 101, 101, 106, 116, 117, 120, 133, 139, 
-139, 147, 156, 155, 156, 164, 166, 166, 169, 170, 170, 170, 173, 173, 172, 167, 164, 163, 159, 155, 
-154, 151, 142, 138, 138, 129, 121, 121, 115, 100, 96, 95, 88, 83, 84, 82, 79, 79, 81, 86, 
-89, 90, 97, 105, 106, 112, 128, 133, 134, 146, 157, 157, 161, 167, 168, 167, 170, 171, 170, 167, 
-164, 162, 160, 152, 149, 148, 137, 124, 126, 113, 85, 78, 81, 109, 125, 124, 142, 164, 168, 164, 
-137, 126, 125, 114, 105, 106, 102, 94, 92, 93, 90, 88, 89, 87, 84, 85, 86, 91, 94, 95, 
-98, 102, 103, 106, 115, 118, 119, 130, 138, 138, 143, 153, 154, 155, 162, 166, 166, 168, 170, 169, 
-170, 172, 172, 172, 168, 164, 164, 161, 157, 155, 154, 145, 140, 140, 134, 123, 122, 118, 103, 97, 
-97, 91, 85, 85, 84, 81, 80, 81, 86, 90, 90, 96, 105, 107, 110, 125, 134, 134, 146, 158, 
-159, 161, 167, 169, 168, 171, 172, 172, 169, 165, 164, 162, 154, 149, 150, 139, 125, 124, 119, 89, 
-79, 77, 101, 123, 123, 134, 157, 163, 163, 142, 125, 125, 117, 107, 106, 104, 97, 94, 94, 92, 
-89, 90, 89, 86, 85, 86, 90, 93, 94, 97, 101, 102, 104, 112, 116, 117, 124, 134, 135, 138, 
-147, 151, 151, 157, 162, 162, 163, 165, 165, 165, 167, 168, 168, 165, 161, 161, 159, 155, 152, 152, 
-146, 139, 139, 134, 125, 122, 121, 109, 100, 101, 97, 90, 89, 89, 86, 85, 85, 89, 93, 94, 
-97, 106, 110, 111, 122, 134, 133, 142, 154, 157, 158, 164, 166, 166, 167, 169, 169, 168, 163, 162, 
-160, 155, 148, 149, 142, 128, 124, 122, 95, 83, 80, 95, 121, 124, 129, 153, 163, 164, 146, 126, 
-126, 119, 110, 105, 106, 99, 94, 94, 93, 90, 91, 91, 88, 87, 87, 90, 95, 96, 98, 102, 
-104, 104, 112, 118, 118, 123, 135, 137, 139, 148, 153, 152, 157, 163, 163, 164, 166, 167, 167, 168, 
-170, 170, 168, 164, 163, 161, 158, 154, 154, 150, 142, 140, 137, 128, 123, 124, 113, 101, 101, 98, 
-91, 88, 89, 86, 85, 85, 87, 93, 95, 97, 105, 110, 110, 120, 132, 132, 137, 149, 154, 154, 
-159, 163, 163, 163, 165, 164, 164, 159, 157, 156, 153, 145, 145, 140, 128, 121, 123, 102, 85, 82, 
-90, 115, 122, 125, 147, 159, 161, 149, 127, 125, 121, 112, 106, 107, 102, 96, 96, 95, 93, 93, 
-93, 91, 89, 90, 91, 96, 97, 99, 103, 106, 106, 111, 118, 120, 123, 134, 138, 138, 146, 152, 
-151, 155, 161, 162, 162, 164, 166, 165, 166, 168, 167, 166, 162, 161, 160, 157, 153, 153, 149, 142, 
-139, 138, 130, 124, 124, 118, 105, 103, 101, 94, 91, 92, 90, 88, 88, 89, 94, 96, 97, 104, 
-110, 110, 117, 130, 132, 135, 146, 154, 153, 158, 162, 163, 162, 165, 165, 165, 161, 159, 158, 155, 
-148, 146, 144, 132, 123, 125, 110, 88, 84, 86, 111, 124, 124, 142, 159, 162, 156, 132, 126, 124, 
-116, 108, 108, 104, 98, 97, 98, 95, 94, 95, 93, 91, 91, 92, 97, 99, 100, 103, 106, 106, 
-110, 118, 120, 121, 131, 137, 137, 143, 150, 150, 148, 152, 154, 154, 156, 157, 157, 157, 159, 159, 
-158, 156, 153, 153, 151, 148, 147, 145, 139, 136, 135, 130, 124, 123, 120, 110, 106, 105, 100, 97, 
-97, 96, 94, 94, 94, 98, 100, 101, 106, 111, 112, 115, 126, 131, 131, 139, 147, 147, 150, 154, 
-155, 155, 157, 157, 157, 155, 152, 152, 150, 145, 142, 142, 134, 125, 125, 119, 100, 95, 95, 113, 
-126, 126, 136, 152, 155, 154, 137, 128, 127, 120, 114, 113, 111, 106, 104, 104, 103, 101, 102, 101, 
-98, 98, 99, 102, 105, 105, 107, 110, 111, 113, 119, 122, 122, 129, 135, 135, 139, 145, 147, 147, 
-152, 155, 155, 156, 157, 157, 157, 159, 159, 159, 156, 154, 153, 151, 148, 147, 146, 141, 137, 136, 
-133, 126, 124, 122, 112, 107, 107, 103, 98, 98, 98, 96, 95, 96, 99, 102, 102, 105, 112, 114, 
-115, 125, 132, 132, 139, 148, 149, 150, 155, 157, 156, 158, 159, 159, 157, 154, 153, 152, 147, 144, 
-144, 138, 128, 126, 122, 104, 98, 97, 109, 124, 125, 137, 182, 201, 209, 183, 155, 144, 119, 86, 
-65, 51, 32, 24, 28, 37, 47, 66, 88, 102, 113, 121, 126, 127, 118, 108, 93, 74, 61, 59, 
-59, 59, 74, 98, 114, 137, 168, 187, 197, 210, 214, 205, 192, 175, 153, 135, 126, 119, 117, 120, 
-126, 140, 158, 175, 188, 198, 197, 187, 180, 164, 136, 111, 90, 59, 35, 31, 32, 36, 51, 74, 
-93, 109, 121, 131, 137, 132, 126, 122, 106, 86, 84, 88, 82, 91, 115, 131, 148, 178, 201, 215, 
-226, 232, 228, 217, 198, 175, 150, 127, 107, 100, 93, 84, 88, 104, 94, 99, 110, 136, 173, 175, 
-171, 187, 183, 162, 123, 83, 72, 62, 54, 60, 77, 91, 108, 124, 135, 137, 138, 131, 116, 99, 
-77, 59, 49, 38, 36, 44, 58, 73, 101, 131, 148, 164, 185, 190, 187, 188, 180, 160, 144, 136, 
-125, 119, 123, 131, 142, 160, 186, 206, 219, 224, 227, 221, 207, 189, 170, 143, 116, 101, 90, 76, 
-77, 89, 93, 100, 121, 132, 133, 135, 135, 125, 113, 97, 77, 62, 49, 38, 43, 55, 66, 92, 
-128, 152, 175, 203, 217, 217, 217, 210, 195, 174, 155, 138, 126, 115, 114, 121, 131, 140, 165, 181, 
-181, 180, 186, 154, 118, 99, 86, 96, 89, 77, 96, 112, 123, 122, 109, 130, 149, 153, 155, 162, 
-151, 136, 121, 101, 71, 49, 34, 20, 15, 23, 39, 64, 88, 114, 134, 149, 154, 160, 162, 152, 
-140, 130, 117, 103, 102, 105, 107, 119, 140, 160, 184, 207, 225, 233, 237, 233, 219, 201, 174, 149, 
-132, 118, 107, 107, 112, 115, 127, 147, 157, 162, 171, 168, 150, 140, 126, 100, 72, 53, 34, 20, 
-18, 28, 48, 68, 92, 122, 145, 155, 167, 182, 179, 168, 164, 152, 133, 125, 121, 118, 121, 133, 
-146, 163, 180, 194, 205, 210, 203, 195, 182, 155, 123, 106, 78, 44, 34, 37, 71, 98, 114, 152, 
-188, 202, 204, 181, 170, 161, 140, 113, 92, 72, 53, 44, 44, 49, 59, 75, 94, 110, 124, 135, 
-144, 144, 137, 129, 116, 94, 78, 74, 68, 67, 84, 103, 116, 143, 175, 192, 205, 220, 224, 216, 
-206, 190, 166, 146, 134, 123, 118, 118, 123, 135, 151, 169, 185, 195, 195, 192, 187, 171, 148, 126, 
-100, 66, 45, 36, 29, 33, 49, 68, 89, 108, 123, 136, 143, 141, 138, 134, 117, 98, 96, 90, 
-81, 90, 108, 120, 138, 166, 190, 206, 220, 227, 227, 217, 199, 180, 154, 126, 108, 98, 84, 74, 
-84, 91, 82, 96, 112, 149, 177, 177, 184, 198, 188, 166, 120, 89, 76, 59, 51, 59, 71, 82, 
-104, 124, 135, 141, 145, 139, 126, 112, 93, 74, 59, 46, 39, 44, 54, 69, 96, 123, 144, 167, 
-187, 192, 194, 195, 186, 167, 152, 138, 124, 116, 116, 121, 131, 148, 170, 193, 208, 216, 222, 219, 
-206, 191, 174, 144, 116, 101, 85, 68, 69, 78, 77, 89, 113, 125, 130, 137, 139, 131, 121, 107, 
-90, 72, 55, 45, 47, 51, 61, 88, 117, 140, 172, 201, 213, 219, 223, 215, 200, 182, 160, 141, 
-125, 112, 108, 113, 118, 128, 153, 169, 171, 179, 182, 146, 125, 108, 110, 114, 93, 85, 99, 103, 
-109, 101, 93, 117, 136, 145, 155, 164, 156, 146, 133, 114, 84, 59, 41, 23, 15, 20, 36, 58, 
-79, 107, 131, 147, 156, 166, 168, 158, 150, 140, 119, 103, 99, 97, 95, 108, 125, 142, 166, 193, 
-213, 225, 233, 232, 220, 202, 176, 150, 129, 111, 99, 97, 97, 101, 114, 132, 144, 157, 167, 163, 
-152, 147, 133, 109, 84, 61, 40, 25, 19, 26, 44, 62, 86, 119, 142, 155, 173, 188, 183, 178, 
-175, 158, 136, 126, 118, 112, 112, 123, 134, 149, 168, 186, 199, 205, 203, 199, 185, 159, 133, 112, 
-73, 46, 34, 42, 73, 90, 107, 148, 181, 196, 194, 178, 176, 164, 144, 123, 102, 76, 57, 46, 
-41, 43, 54, 68, 85, 105, 123, 136, 148, 149, 146, 139, 126, 105, 89, 79, 68, 65, 79, 92, 
-106, 133, 163, 182, 201, 219, 224, 219, 210, 195, 173, 151, 135, 122, 113, 109, 114, 125, 138, 156, 
-177, 188, 190, 193, 189, 173, 154, 137, 105, 70, 52, 38, 28, 31, 46, 61, 83, 106, 124, 140, 
-149, 150, 149, 143, 124, 108, 100, 87, 80, 91, 106, 119, 142, 172, 196, 213, 228, 232, 226, 207, 
-184, 155, 129, 103, 90, 83, 77, 80, 101, 109, 111, 124, 140, 170, 176, 165, 168, 160, 138, 113, 
-75, 62, 62, 65, 75, 102, 123, 136, 148, 154, 148, 137, 121, 95, 66, 46, 32, 30, 35, 49, 
-70, 96, 121, 144, 164, 173, 175, 177, 169, 150, 132, 118, 104, 97, 103, 114, 128, 149, 177, 199, 
-217, 230, 231, 222, 203, 180, 154, 130, 111, 99, 94, 93, 102, 119, 136, 150, 165, 171, 161, 153, 
-142, 120, 92, 67, 46, 28, 21, 28, 47, 69, 94, 125, 149, 161, 171, 182, 177, 162, 150, 136, 
-118, 109, 107, 110, 119, 135, 155, 177, 192, 203, 210, 208, 193, 176, 156, 122, 94, 81, 63, 40, 
-43, 56, 94, 134, 153, 180, 205, 209, 200, 167, 142, 119, 92, 68, 57, 52, 52, 63, 81, 102, 
-121, 136, 144, 145, 141, 131, 120, 99, 76, 61, 50, 46, 54, 75, 96, 119, 152, 176, 188, 199, 
-204, 196, 180, 162, 140, 121, 110, 105, 106, 117, 134, 157, 182, 200, 213, 219, 215, 200, 184, 161, 
-129, 105, 89, 75, 66, 74, 86, 95, 115, 136, 144, 147, 148, 141, 126, 107, 82, 62, 47, 35, 
-37, 53, 69, 91, 130, 160, 176, 196, 209, 204, 193, 181, 159, 134, 120, 109, 104, 108, 116, 131, 
-152, 171, 185, 199, 196, 180, 168, 148, 103, 70, 50, 54, 65, 67, 87, 123, 152, 177, 179, 178, 
-184, 175, 158, 142, 121, 88, 66, 50, 40, 38, 50, 64, 81, 106, 127, 144, 155, 157, 152, 143, 
-125, 101, 86, 73, 63, 68, 85, 99, 120, 153, 178, 195, 212, 221, 215, 203, 186, 160, 137, 122, 
-111, 106, 110, 118, 134, 155, 176, 192, 203, 202, 192, 180, 162, 131, 103, 83, 56, 40, 43, 52, 
-64, 87, 112, 128, 140, 146, 147, 142, 130, 111, 93, 76, 61, 62, 73, 83, 105, 137, 167, 190, 
-212, 226, 228, 222, 209, 186, 157, 127, 109, 96, 89, 91, 107, 122, 137, 158, 174, 159, 149, 139, 
-140, 144, 121, 101, 104, 97, 93, 86, 79, 98, 121, 140, 155, 169, 167, 159, 146, 127, 98, 69, 
-47, 30, 21, 27, 45, 69, 95, 123, 145, 160, 167, 171, 166, 152, 133, 116, 98, 84, 82, 88, 
-98, 117, 142, 170, 192, 211, 223, 222, 214, 199, 177, 149, 124, 107, 96, 92, 97, 110, 126, 145, 
-166, 179, 181, 180, 174, 154, 127, 101, 74, 48, 31, 27, 32, 46, 67, 96, 124, 142, 154, 165, 
-165, 155, 147, 135, 111, 97, 95, 93, 96, 112, 131, 154, 178, 200, 214, 222, 217, 205, 188, 161, 
-129, 109, 91, 72, 66, 77, 75, 81, 104, 131, 168, 183, 183, 191, 189, 172, 139, 98, 79, 65, 
-55, 57, 73, 89, 111, 132, 147, 154, 157, 151, 136, 115, 89, 66, 52, 40, 38, 48, 66, 85, 
-116, 145, 163, 176, 190, 190, 179, 169, 150, 124, 109, 102, 97, 101, 114, 133, 156, 183, 206, 221, 
-226, 219, 205, 186, 160, 132, 112, 96, 81, 79, 89, 97, 114, 140, 154, 157, 163, 161, 148, 131, 
-112, 83, 58, 39, 28, 32, 44, 62, 89, 122, 146, 167, 187, 191, 185, 179, 165, 139, 119, 105, 
-94, 91, 100, 112, 129, 152, 173, 190, 201, 201, 194, 181, 157, 126, 103, 77, 48, 38, 43, 70, 
-96, 120, 156, 186, 200, 202, 184, 169, 153, 126, 96, 77, 59, 47, 48, 59, 73, 95, 120, 138, 
-150, 159, 159, 154, 141, 121, 96, 76, 58, 51, 56, 68, 84, 111, 142, 165, 186, 202, 206, 200, 
-190, 172, 145, 123, 107, 95, 92, 101, 115, 133, 158, 181, 199, 210, 211, 204, 190, 166, 138, 112, 
-88, 67, 60, 62, 66, 82, 107, 129, 144, 157, 162, 157, 147, 132, 111, 87, 65, 53, 49, 52, 
-67, 94, 123, 150, 179, 203, 211, 213, 207, 191, 168, 141, 120, 103, 91, 88, 97, 111, 127, 153, 
-177, 187, 189, 191, 177, 144, 117, 90, 80, 75, 62, 67, 90, 108, 129, 141, 158, 175, 182, 179, 
-172, 157, 134, 105, 78, 56, 40, 35, 41, 54, 73, 99, 128, 150, 163, 171, 170, 160, 145, 126, 
-102, 81, 73, 71, 74, 89, 111, 137, 163, 187, 206, 214, 212, 201, 182, 155, 128, 108, 94, 88, 
-92, 106, 127, 152, 177, 194, 200, 197, 187, 169, 139, 109, 86, 60, 47, 49, 60, 76, 103, 130, 
-148, 160, 163, 160, 149, 128, 101, 82, 64, 53, 60, 77, 94, 123, 161, 185, 202, 213, 212, 200, 
-182, 155, 126, 103, 86, 81, 88, 100, 119, 150, 171, 181, 189, 188, 162, 136, 111, 92, 82, 67, 
-62, 80, 99, 121, 140, 156, 177, 186, 183, 174, 158, 132, 100, 73, 53, 40, 41, 53, 70, 96, 
-124, 148, 165, 172, 170, 161, 144, 115, 92, 76, 62, 62, 77, 95, 117, 150, 177, 195, 208, 212, 
-203, 186, 161, 133, 112, 96, 90, 93, 107, 123, 150, 177, 193, 204, 206, 195, 176, 153, 124, 94, 
-73, 61, 55, 60, 77, 102, 127, 146, 160, 164, 160, 147, 130, 106, 79, 61, 52, 51, 60, 81, 
-113, 143, 170, 195, 207, 206, 199, 184, 159, 130, 110, 95, 88, 91, 103, 122, 146, 168, 187, 196, 
-191, 179, 165, 129, 92, 67, 56, 60, 64, 77, 108, 139, 168, 183, 185, 189, 182, 165, 142, 114, 
-85, 63, 49, 46, 54, 71, 93, 121, 144, 160, 170, 172, 162, 146, 121, 94, 71, 59, 56, 63, 
-79, 105, 136, 162, 184, 201, 203, 198, 185, 162, 132, 108, 91, 81, 83, 96, 115, 142, 168, 189, 
-203, 207, 199, 184, 163, 130, 102, 82, 64, 59, 68, 81, 99, 127, 150, 162, 169, 168, 156, 138, 
-111, 83, 64, 48, 43, 53, 72, 94, 127, 161, 181, 194, 201, 196, 181, 160, 133, 111, 94, 86, 
-89, 101, 116, 140, 167, 185, 195, 199, 192, 174, 149, 123, 89, 61, 46, 46, 68, 89, 114, 152, 
-182, 199, 203, 189, 175, 156, 127, 96, 76, 59, 50, 56, 70, 90, 118, 141, 158, 168, 170, 162, 
-149, 126, 97, 75, 59, 50, 56, 73, 94, 121, 153, 177, 191, 200, 198, 185, 165, 138, 114, 95, 
-83, 83, 93, 111, 136, 166, 190, 204, 210, 207, 193, 172, 143, 115, 90, 73, 67, 71, 82, 104, 
-131, 150, 165, 175, 172, 161, 146, 120, 90, 65, 49, 42, 47, 61, 84, 117, 146, 168, 189, 195, 
-189, 178, 161, 132, 108, 92, 81, 81, 92, 109, 134, 160, 180, 196, 202, 196, 183, 165, 133, 102, 
-82, 63, 48, 52, 67, 99, 134, 160, 183, 200, 202, 190, 166, 137, 109, 84, 63, 54, 56, 67, 
-86, 112, 139, 157, 170, 174, 167, 153, 130, 102, 79, 60, 49, 51, 63, 82, 111, 142, 164, 184, 
-195, 192, 182, 166, 139, 111, 92, 80, 76, 85, 102, 125, 155, 181, 200, 211, 209, 197, 179, 154, 
-122, 98, 81, 70, 72, 85, 104, 130, 155, 174, 182, 182, 174, 157, 132, 101, 75, 55, 42, 43, 
-57, 78, 106, 137, 163, 179, 186, 188, 178, 159, 133, 112, 92, 79, 78, 88, 104, 127, 156, 181, 
-198, 206, 205, 194, 173, 144, 116, 90, 68, 60, 63, 66, 82, 110, 145, 174, 187, 193, 194, 181, 
-159, 123, 92, 74, 60, 56, 67, 84, 109, 136, 157, 171, 176, 172, 159, 138, 108, 80, 61, 50, 
-47, 58, 76, 102, 132, 159, 179, 188, 191, 184, 168, 141, 116, 95, 79, 71, 76, 91, 113, 143, 
-170, 191, 204, 207, 198, 182, 156, 125, 100, 80, 68, 69, 80, 97, 124, 154, 173, 187, 192, 183, 
-168, 146, 114, 86, 64, 49, 46, 56, 73, 99, 132, 156, 174, 186, 185, 174, 158, 134, 106, 85, 
-72, 67, 73, 90, 113, 143, 170, 191, 204, 206, 196, 179, 154, 121, 93, 75, 62, 60, 71, 92, 
-114, 139, 160, 179, 192, 187, 174, 160, 132, 106, 82, 61, 58, 66, 81, 105, 137, 160, 176, 185, 
-183, 171, 152, 122, 92, 69, 52, 47, 56, 73, 96, 127, 155, 174, 188, 191, 183, 168, 145, 116, 
-92, 76, 68, 71, 87, 108, 136, 166, 187, 202, 207, 202, 187, 165, 135, 107, 86, 73, 71, 80, 
-97, 123, 150, 173, 189, 195, 190, 177, 156, 125, 94, 71, 53, 47, 54, 69, 93, 124, 150, 170, 
-181, 183, 175, 161, 136, 108, 88, 71, 62, 69, 85, 105, 135, 166, 188, 203, 209, 203, 188, 163, 
-130, 103, 82, 67, 67, 77, 92, 115, 145, 162, 172, 178, 178, 174, 157, 129, 108, 89, 77, 72, 
-67, 67, 67, 67, 67, 68, 67, 67, 68, 69, 69, 71, 71, 72, 72, 73, 74, 76, 77, 79, 
-80, 81, 82, 84, 86, 87, 89, 92, 95, 96, 98, 101, 102, 103, 106, 107, 107, 108, 109, 110, 
-111, 112, 112, 113, 112, 113, 113, 113, 113, 113, 113, 112, 112, 112, 111, 110, 110, 109, 107, 107, 
-107, 106, 105, 106, 106, 106, 106, 107, 109, 110, 111, 113, 115, 115, 118, 121, 123, 124, 127, 129, 
-130, 131, 133, 134, 134, 136, 137, 137, 136, 136, 136, 135, 134, 134, 133, 131, 129, 129, 126, 120, 
-119, 120, 126, 130, 130, 134, 139, 140, 139, 134, 132, 132, 130, 128, 128, 127, 126, 126, 126, 125, 
-125, 125, 125, 124, 125, 125, 126, 127, 127, 128, 129, 129, 130, 132, 133, 133, 135, 137, 137, 139, 
-141, 141, 142, 143, 144, 144, 145, 145, 145, 145, 146, 146, 146, 145, 145, 144, 144, 143, 143, 142, 
-140, 139, 139, 138, 136, 136, 135, 132, 130, 130, 129, 128, 128, 127, 127, 127, 127, 129, 130, 130, 
-131, 132, 133, 133, 135, 136, 136, 137, 139, 139, 139, 140, 140, 140, 141, 141, 141, 140, 140, 140, 
-140, 139, 139, 138, 137, 136, 136, 135, 132, 131, 131, 133, 135, 136, 137, 140, 140, 140, 138, 136, 
-136, 134, 133, 133, 132, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 132, 
-132, 132, 133, 134, 134, 135, 136, 136, 137, 138, 138, 138, 139, 139, 139, 140, 140, 140, 140, 140, 
-140, 140, 140, 140, 140, 139, 139, 139, 139, 139, 139, 138, 138, 137, 136, 136, 134, 133, 133, 133, 
-132, 132, 132, 131, 131, 131, 131, 132, 132, 132, 133, 134, 134, 135, 136, 136, 137, 139, 139, 139, 
-140, 140, 140, 140, 140, 140, 140, 139, 139, 139, 138, 138, 137, 136, 135, 134, 134, 131, 129, 129, 
-130, 133, 133, 134, 137, 138, 138, 136, 134, 134, 133, 132, 131, 131, 130, 130, 130, 129, 129, 129, 
-129, 129, 128, 129, 129, 129, 129, 130, 130, 130, 130, 131, 132, 132, 133, 134, 134, 134, 136, 136, 
-136, 136, 133, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 
-130, 130, 130, 130, 130, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 127, 127, 128, 130, 147, 170, 187, 213, 237, 246, 250, 252, 241, 227, 210, 
-191, 176, 163, 160, 162, 164, 178, 193, 192, 197, 196, 169, 150, 142, 149, 140, 129, 143, 151, 155, 
-139, 142, 164, 172, 179, 187, 179, 164, 150, 125, 93, 71, 50, 39, 44, 62, 85, 107, 134, 154, 
-164, 172, 177, 166, 157, 144, 124, 114, 115, 115, 127, 149, 169, 195, 216, 228, 233, 232, 220, 202, 
-175, 152, 133, 118, 112, 115, 116, 129, 150, 158, 165, 172, 157, 141, 127, 100, 71, 52, 34, 23, 
-26, 41, 62, 87, 118, 143, 153, 167, 176, 163, 159, 149, 129, 120, 117, 117, 126, 141, 159, 178, 
-191, 202, 204, 193, 181, 161, 122, 100, 77, 38, 25, 37, 79, 103, 131, 176, 197, 201, 175, 156, 
-143, 112, 86, 69, 49, 38, 41, 49, 62, 83, 101, 112, 121, 127, 126, 116, 103, 83, 64, 55, 
-55, 55, 75, 99, 120, 150, 177, 190, 202, 207, 196, 181, 162, 138, 123, 116, 113, 117, 124, 141, 
-163, 177, 190, 194, 184, 173, 155, 124, 95, 74, 44, 31, 34, 37, 52, 76, 94, 109, 119, 126, 
-124, 114, 105, 87, 68, 66, 69, 70, 93, 119, 140, 170, 194, 207, 217, 217, 206, 186, 154, 130, 
-107, 87, 83, 82, 78, 98, 110, 101, 108, 128, 159, 154, 151, 155, 140, 116, 76, 59, 58, 55, 
-68, 93, 107, 119, 129, 128, 121, 107, 84, 57, 35, 27, 24, 28, 44, 63, 87, 117, 141, 153, 
-169, 174, 164, 156, 141, 118, 108, 105, 103, 112, 128, 148, 174, 198, 212, 217, 211, 200, 182, 154, 
-129, 108, 86, 78, 79, 81, 96, 115, 121, 132, 138, 130, 122, 110, 87, 61, 42, 31, 25, 28, 
-49, 70, 94, 136, 164, 175, 194, 198, 188, 177, 158, 136, 123, 115, 113, 117, 126, 145, 165, 177, 
-191, 187, 169, 160, 127, 80, 52, 46, 65, 62, 82, 118, 143, 159, 152, 161, 164, 152, 142, 127, 
-99, 72, 51, 34, 27, 31, 39, 55, 77, 104, 123, 135, 144, 141, 132, 124, 105, 84, 81, 79, 
-79, 97, 118, 137, 168, 194, 208, 218, 218, 207, 192, 168, 145, 125, 109, 104, 107, 115, 131, 152, 
-165, 178, 181, 172, 164, 144, 108, 81, 57, 34, 24, 26, 34, 50, 77, 106, 125, 139, 152, 150, 
-141, 139, 123, 104, 104, 101, 101, 116, 132, 151, 176, 195, 208, 212, 207, 197, 176, 147, 122, 95, 
-71, 68, 53, 44, 60, 97, 145, 159, 184, 202, 199, 176, 134, 108, 84, 60, 51, 50, 54, 69, 
-90, 109, 125, 133, 133, 128, 118, 105, 82, 63, 53, 45, 47, 65, 84, 106, 143, 167, 181, 197, 
-200, 191, 181, 163, 139, 125, 116, 112, 121, 135, 153, 176, 193, 208, 213, 209, 199, 178, 149, 123, 
-96, 72, 66, 61, 58, 75, 96, 110, 125, 134, 133, 127, 118, 105, 82, 64, 58, 49, 53, 79, 
-101, 127, 169, 196, 210, 225, 225, 216, 201, 174, 147, 124, 107, 103, 102, 112, 132, 146, 157, 173, 
-153, 130, 120, 125, 129, 102, 107, 111, 109, 93, 80, 97, 116, 130, 147, 153, 147, 139, 123, 97, 
-69, 43, 22, 15, 21, 41, 60, 87, 117, 136, 151, 166, 166, 157, 153, 133, 110, 103, 96, 95, 
-109, 126, 147, 176, 199, 214, 226, 226, 214, 195, 168, 141, 120, 103, 97, 95, 100, 118, 135, 149, 
-165, 164, 154, 147, 130, 104, 77, 54, 34, 24, 27, 43, 61, 88, 125, 146, 164, 183, 181, 173, 
-170, 149, 130, 120, 110, 109, 119, 132, 149, 170, 187, 199, 200, 196, 185, 157, 128, 103, 62, 37, 
-30, 55, 85, 102, 147, 183, 200, 192, 176, 168, 147, 121, 96, 71, 51, 43, 44, 52, 68, 89, 
-109, 125, 139, 147, 144, 136, 123, 99, 80, 72, 63, 65, 86, 104, 128, 162, 185, 201, 216, 217, 
-207, 194, 170, 146, 131, 118, 113, 114, 125, 140, 161, 182, 196, 199, 194, 187, 165, 136, 110, 78, 
-51, 42, 39, 46, 62, 84, 108, 124, 139, 147, 143, 136, 127, 104, 89, 86, 77, 82, 105, 122, 
-147, 179, 199, 215, 226, 226, 214, 193, 166, 137, 110, 94, 87, 77, 84, 100, 99, 110, 128, 163, 
-179, 170, 180, 172, 148, 107, 76, 66, 56, 60, 77, 95, 117, 136, 146, 148, 144, 128, 103, 74, 
-52, 42, 37, 46, 63, 83, 113, 146, 163, 177, 187, 181, 168, 152, 127, 109, 104, 104, 113, 132, 
-155, 183, 206, 218, 220, 211, 196, 175, 144, 120, 102, 87, 86, 98, 108, 129, 152, 156, 157, 156, 
-140, 119, 94, 66, 44, 32, 32, 44, 60, 90, 125, 147, 170, 185, 178, 173, 165, 140, 122, 112, 
-106, 111, 125, 142, 165, 183, 197, 203, 196, 185, 167, 130, 102, 80, 44, 32, 43, 82, 115, 144, 
-184, 206, 208, 182, 159, 139, 104, 78, 63, 50, 50, 62, 77, 101, 124, 137, 144, 144, 137, 125, 
-100, 78, 64, 52, 56, 72, 88, 118, 154, 174, 191, 204, 200, 191, 177, 150, 129, 116, 108, 112, 
-128, 148, 174, 193, 207, 214, 208, 197, 178, 144, 116, 96, 75, 69, 76, 79, 96, 122, 134, 143, 
-147, 138, 123, 102, 78, 60, 45, 44, 54, 68, 100, 140, 164, 189, 208, 208, 201, 190, 164, 139, 
-123, 111, 108, 113, 129, 149, 168, 186, 193, 182, 174, 152, 106, 71, 56, 67, 65, 74, 109, 139, 
-165, 167, 175, 180, 168, 153, 134, 101, 72, 53, 39, 38, 49, 64, 87, 114, 136, 152, 156, 153, 
-142, 120, 97, 82, 67, 68, 81, 96, 121, 156, 179, 199, 213, 212, 203, 188, 161, 137, 120, 109, 
-105, 112, 128, 151, 174, 192, 201, 197, 188, 171, 140, 109, 85, 58, 46, 49, 56, 74, 101, 121, 
-136, 145, 147, 139, 122, 103, 83, 65, 63, 71, 82, 111, 147, 175, 200, 218, 224, 220, 207, 182, 
-148, 119, 101, 89, 87, 103, 119, 136, 162, 167, 151, 142, 139, 146, 121, 104, 107, 102, 95, 82, 
-94, 119, 137, 155, 167, 164, 153, 136, 106, 74, 50, 30, 25, 34, 54, 81, 111, 138, 156, 165, 
-169, 164, 145, 126, 108, 90, 85, 92, 102, 124, 155, 182, 202, 215, 218, 212, 199, 176, 147, 122, 
-107, 98, 99, 112, 131, 152, 172, 184, 182, 179, 165, 133, 101, 74, 50, 37, 36, 43, 59, 87, 
-118, 139, 152, 163, 160, 147, 135, 115, 95, 93, 94, 99, 118, 143, 170, 194, 211, 219, 215, 200, 
-181, 147, 115, 95, 76, 64, 75, 78, 88, 113, 143, 177, 180, 184, 186, 168, 134, 94, 74, 63, 
-58, 69, 88, 113, 136, 151, 156, 154, 142, 120, 89, 62, 49, 41, 44, 59, 77, 105, 139, 162, 
-175, 187, 185, 172, 155, 130, 108, 98, 96, 102, 119, 142, 171, 196, 212, 218, 213, 198, 180, 150, 
-120, 101, 87, 80, 89, 102, 120, 148, 162, 162, 162, 152, 131, 107, 77, 52, 37, 32, 42, 57, 
-81, 118, 146, 164, 183, 184, 175, 168, 147, 122, 109, 102, 102, 114, 131, 154, 177, 193, 203, 201, 
-190, 176, 146, 110, 90, 60, 39, 41, 66, 107, 135, 172, 201, 211, 198, 170, 150, 120, 87, 69, 
-56, 51, 60, 76, 98, 123, 141, 149, 151, 146, 135, 114, 87, 68, 55, 52, 64, 82, 105, 141, 
-169, 186, 201, 202, 192, 179, 154, 129, 111, 102, 102, 115, 134, 160, 185, 201, 211, 210, 199, 184, 
-156, 121, 99, 78, 65, 72, 80, 90, 118, 137, 147, 154, 149, 135, 116, 89, 68, 51, 42, 50, 
-63, 83, 122, 155, 177, 199, 205, 198, 186, 163, 133, 112, 96, 91, 95, 109, 131, 157, 177, 192, 
-192, 182, 169, 135, 94, 67, 59, 63, 63, 89, 119, 151, 170, 175, 186, 182, 167, 150, 121, 87, 
-65, 48, 41, 49, 64, 85, 114, 138, 157, 166, 165, 155, 136, 108, 87, 70, 61, 69, 85, 105, 
-139, 168, 188, 205, 209, 201, 187, 163, 133, 113, 98, 91, 96, 110, 133, 161, 182, 197, 200, 193, 
-179, 154, 119, 93, 68, 49, 50, 59, 73, 100, 127, 144, 156, 159, 154, 139, 117, 93, 73, 61, 
-65, 74, 93, 128, 162, 188, 210, 220, 218, 207, 186, 152, 120, 98, 85, 81, 92, 112, 133, 157, 
-176, 170, 161, 151, 148, 135, 105, 99, 92, 88, 82, 86, 111, 138, 157, 173, 177, 168, 153, 128, 
-94, 65, 44, 32, 35, 53, 77, 107, 136, 159, 171, 176, 172, 156, 132, 110, 90, 78, 79, 89, 
-107, 135, 167, 190, 206, 213, 210, 198, 178, 148, 120, 100, 88, 87, 98, 118, 142, 165, 183, 189, 
-186, 176, 151, 118, 88, 63, 45, 43, 51, 68, 98, 130, 154, 166, 169, 163, 144, 118, 97, 79, 
-71, 82, 98, 123, 160, 188, 206, 216, 212, 199, 171, 135, 105, 81, 71, 77, 87, 113, 145, 152, 
-160, 164, 170, 162, 134, 116, 101, 87, 72, 73, 92, 119, 147, 168, 176, 172, 160, 135, 99, 69, 
-47, 36, 41, 58, 84, 117, 147, 167, 175, 173, 163, 138, 109, 89, 74, 70, 84, 102, 132, 167, 
-190, 203, 208, 200, 184, 158, 127, 104, 88, 85, 96, 114, 144, 173, 187, 195, 193, 176, 152, 119, 
-84, 60, 51, 51, 61, 85, 115, 140, 157, 166, 164, 150, 128, 100, 77, 66, 68, 76, 99, 136, 
-169, 194, 211, 215, 208, 191, 160, 126, 100, 84, 82, 90, 111, 142, 163, 180, 184, 166, 149, 128, 
-112, 90, 73, 77, 89, 104, 116, 142, 170, 180, 183, 175, 154, 123, 89, 61, 45, 41, 49, 66, 
-94, 129, 154, 168, 173, 166, 147, 120, 93, 73, 64, 71, 85, 108, 145, 173, 194, 207, 205, 195, 
-175, 143, 116, 98, 89, 90, 101, 126, 158, 181, 196, 200, 191, 174, 146, 109, 82, 65, 55, 60, 
-77, 102, 132, 155, 167, 168, 158, 141, 112, 82, 65, 55, 56, 74, 103, 135, 169, 193, 203, 203, 
-193, 171, 140, 112, 93, 83, 87, 102, 126, 155, 178, 190, 188, 180, 161, 122, 85, 64, 63, 62, 
-74, 105, 141, 171, 180, 188, 186, 170, 148, 116, 83, 60, 49, 49, 60, 82, 112, 140, 158, 170, 
-169, 156, 134, 103, 77, 62, 58, 64, 84, 116, 148, 175, 194, 199, 196, 184, 156, 125, 102, 85, 
-83, 94, 114, 144, 173, 193, 203, 202, 191, 170, 135, 104, 82, 66, 66, 79, 94, 122, 150, 165, 
-172, 168, 153, 127, 95, 71, 55, 48, 58, 77, 104, 144, 174, 188, 198, 196, 180, 155, 126, 103, 
-89, 88, 98, 116, 143, 171, 188, 195, 195, 182, 156, 126, 91, 60, 45, 51, 78, 102, 140, 177, 
-198, 203, 187, 170, 143, 107, 80, 63, 53, 58, 73, 98, 128, 151, 164, 168, 161, 146, 119, 89, 
-68, 56, 54, 68, 91, 122, 156, 181, 192, 195, 187, 167, 138, 109, 88, 77, 81, 96, 122, 156, 
-183, 198, 204, 199, 185, 159, 126, 97, 76, 69, 74, 88, 114, 146, 165, 177, 180, 168, 149, 118, 
-85, 62, 48, 49, 61, 82, 117, 151, 172, 188, 190, 180, 164, 136, 107, 90, 81, 85, 100, 124, 
-156, 181, 195, 201, 194, 179, 153, 117, 86, 69, 55, 54, 68, 102, 145, 169, 188, 199, 193, 172, 
-134, 102, 78, 59, 57, 67, 84, 113, 143, 162, 173, 171, 158, 136, 104, 77, 59, 51, 57, 72, 
-97, 133, 162, 180, 191, 189, 174, 152, 121, 94, 80, 77, 86, 105, 136, 168, 191, 205, 207, 197, 
-178, 149, 115, 91, 77, 75, 84, 105, 135, 161, 180, 188, 180, 166, 141, 105, 76, 57, 47, 51, 
-66, 93, 128, 155, 176, 184, 179, 169, 145, 113, 94, 80, 76, 88, 108, 138, 170, 193, 206, 206, 
-196, 177, 143, 108, 85, 66, 61, 75, 89, 113, 142, 167, 188, 185, 180, 165, 135, 102, 73, 62, 
-64, 75, 100, 132, 157, 173, 178, 170, 153, 125, 92, 66, 50, 49, 60, 79, 110, 144, 168, 184, 
-188, 178, 162, 132, 100, 80, 68, 70, 85, 110, 144, 174, 193, 201, 199, 187, 164, 130, 100, 80, 
-70, 75, 91, 117, 149, 174, 189, 192, 185, 166, 133, 99, 73, 55, 51, 60, 78, 109, 142, 166, 
-180, 182, 174, 154, 124, 97, 76, 64, 70, 85, 110, 146, 175, 195, 205, 202, 188, 162, 126, 95, 
-73, 63, 69, 82, 109, 144, 164, 174, 178, 176, 165, 137, 109, 89, 74, 66, 70, 89, 119, 150, 
-173, 185, 183, 172, 149, 114, 82, 60, 47, 50, 65, 91, 125, 155, 176, 185, 182, 171, 146, 113, 
-89, 72, 66, 76, 94, 123, 157, 183, 198, 203, 196, 180, 151, 118, 94, 77, 73, 84, 104, 135, 
-166, 186, 196, 195, 182, 158, 125, 92, 68, 56, 57, 69, 93, 125, 154, 172, 181, 178, 164, 139, 
-108, 82, 65, 62, 71, 89, 122, 158, 183, 200, 205, 197, 180, 150, 115, 89, 73, 71, 81, 101, 
-133, 160, 179, 190, 182, 166, 143, 116, 91, 71, 66, 72, 79, 77, 75, 75, 74, 74, 74, 73, 
-72, 73, 74, 74, 75, 75, 76, 77, 78, 81, 82, 84, 86, 87, 89, 92, 93, 95, 99, 100, 
-102, 105, 106, 107, 110, 111, 112, 113, 114, 115, 116, 117, 117, 117, 117, 117, 117, 117, 117, 116, 
-115, 115, 114, 113, 113, 111, 109, 109, 108, 107, 107, 107, 107, 108, 109, 110, 110, 112, 114, 114, 
-117, 120, 121, 123, 126, 127, 129, 130, 131, 131, 132, 133, 133, 132, 132, 132, 130, 130, 129, 126, 
-125, 124, 118, 116, 116, 122, 126, 127, 133, 136, 137, 132, 129, 128, 126, 125, 125, 123, 122, 122, 
-122, 122, 122, 122, 122, 123, 124, 125, 125, 126, 127, 128, 129, 131, 131, 133, 135, 136, 137, 140, 
-140, 141, 143, 143, 143, 144, 144, 144, 145, 145, 145, 144, 144, 143, 142, 142, 141, 140, 139, 138, 
-136, 135, 135, 132, 130, 129, 128, 127, 126, 126, 125, 125, 126, 127, 127, 129, 130, 131, 133, 136, 
-136, 139, 142, 142, 143, 144, 144, 145, 145, 145, 145, 144, 144, 142, 137, 135, 134, 132, 132, 131, 
-128, 127, 127, 130, 132, 133, 135, 137, 137, 135, 133, 133, 132, 131, 131, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 131, 131, 131, 132, 132, 132, 133, 133, 134, 135, 136, 136, 137, 137, 138, 
-139, 139, 139, 139, 139, 139, 140, 140, 140, 139, 139, 139, 138, 138, 138, 137, 136, 136, 135, 134, 
-133, 132, 131, 130, 129, 129, 128, 128, 128, 128, 128, 129, 129, 130, 131, 131, 132, 133, 134, 135, 
-136, 136, 137, 137, 137, 138, 138, 138, 138, 137, 137, 137, 136, 136, 135, 133, 133, 132, 129, 128, 
-129, 132, 133, 134, 137, 138, 137, 135, 134, 134, 133, 133, 132, 131, 131, 131, 130, 130, 130, 130, 
-130, 130, 130, 131, 131, 131, 131, 131, 132, 133, 133, 134, 135, 135, 136, 137, 137, 137, 138, 138, 
-138, 138, 138, 138, 139, 139, 138, 138, 138, 137, 137, 137, 136, 135, 134, 134, 133, 132, 132, 130, 
-129, 129, 128, 128, 128, 127, 127, 127, 128, 128, 128, 129, 129, 130, 131, 132, 131, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 
-131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 130, 130, 130, 130, 130, 130, 
-130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 130, 130, 130, 
-130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 
-129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 
-129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 127, 129, 127, 130, 126, 
-161, 199, 221, 244, 247, 254, 245, 225, 204, 163, 130, 113, 96, 95, 102, 114, 133, 154, 168, 175, 
-179, 174, 161, 154, 140, 136, 143, 148, 165, 188, 211, 230, 241, 240, 230, 215, 191, 160, 142, 116, 
-105, 105, 90, 101, 135, 178, 187, 207, 216, 201, 154, 121, 102, 80, 78, 82, 90, 114, 133, 145, 
-151, 143, 129, 111, 89, 70, 61, 60, 67, 88, 114, 144, 178, 192, 202, 205, 191, 175, 154, 135, 
-126, 125, 135, 154, 179, 199, 209, 215, 209, 198, 179, 143, 117, 95, 75, 77, 75, 81, 104, 116, 
-126, 131, 122, 110, 93, 72, 52, 46, 47, 56, 90, 118, 155, 194, 209, 218, 217, 202, 181, 153, 
-131, 112, 109, 115, 123, 149, 159, 162, 166, 133, 108, 98, 107, 87, 94, 109, 114, 99, 100, 127, 
-133, 146, 145, 130, 115, 88, 56, 36, 20, 15, 26, 47, 72, 103, 127, 139, 150, 150, 138, 128, 
-105, 93, 93, 94, 110, 135, 160, 186, 200, 208, 209, 201, 183, 154, 129, 109, 97, 99, 101, 118, 
-140, 148, 160, 154, 135, 121, 91, 61, 40, 24, 18, 27, 45, 70, 105, 132, 145, 163, 162, 152, 
-145, 125, 112, 108, 108, 121, 138, 160, 178, 189, 192, 184, 174, 149, 110, 87, 45, 20, 30, 73, 
-99, 140, 183, 199, 186, 161, 147, 113, 86, 64, 45, 40, 46, 56, 78, 98, 114, 124, 131, 125, 
-113, 92, 69, 60, 57, 58, 81, 105, 134, 168, 184, 197, 201, 192, 177, 153, 131, 118, 111, 113, 
-122, 142, 165, 181, 193, 189, 179, 163, 128, 98, 70, 43, 39, 40, 49, 70, 93, 110, 123, 130, 
-123, 112, 98, 73, 71, 71, 76, 105, 128, 159, 190, 205, 215, 214, 204, 181, 151, 122, 97, 86, 
-83, 79, 102, 103, 106, 122, 157, 162, 160, 165, 145, 108, 71, 67, 59, 68, 91, 110, 126, 136, 
-132, 124, 102, 72, 46, 37, 31, 37, 53, 74, 107, 139, 155, 174, 179, 171, 163, 138, 120, 113, 
-107, 116, 132, 154, 183, 202, 212, 211, 204, 189, 161, 134, 105, 86, 82, 80, 92, 110, 119, 134, 
-137, 130, 121, 100, 73, 52, 40, 32, 38, 58, 78, 121, 158, 175, 198, 202, 192, 180, 152, 131, 
-117, 111, 113, 125, 146, 166, 181, 186, 172, 166, 130, 84, 54, 62, 65, 73, 111, 137, 151, 151, 
-167, 165, 156, 143, 116, 84, 60, 40, 33, 34, 43, 63, 95, 121, 137, 149, 146, 138, 127, 100, 
-89, 83, 79, 96, 116, 142, 177, 196, 208, 213, 206, 195, 175, 148, 124, 109, 106, 111, 127, 146, 
-164, 179, 178, 172, 157, 122, 92, 63, 41, 32, 32, 40, 60, 92, 119, 137, 154, 149, 148, 141, 
-117, 111, 105, 102, 116, 130, 154, 181, 199, 205, 205, 197, 177, 151, 121, 85, 72, 54, 39, 53, 
-104, 146, 166, 200, 208, 192, 149, 120, 88, 66, 57, 53, 59, 78, 100, 121, 132, 136, 131, 123, 
-104, 79, 63, 52, 52, 69, 84, 115, 153, 173, 193, 200, 195, 189, 167, 143, 127, 115, 117, 130, 
-146, 168, 190, 203, 207, 205, 190, 163, 135, 99, 78, 68, 56, 64, 80, 99, 119, 130, 133, 128, 
-120, 101, 75, 65, 53, 58, 80, 96, 136, 177, 199, 219, 223, 216, 202, 174, 140, 115, 100, 93, 
-100, 118, 130, 156, 157, 140, 132, 140, 143, 116, 116, 113, 98, 75, 83, 99, 119, 143, 152, 152, 
-146, 125, 99, 65, 38, 26, 28, 43, 62, 93, 123, 146, 166, 170, 167, 162, 137, 118, 105, 95, 
-104, 119, 140, 170, 194, 209, 218, 215, 202, 181, 153, 123, 106, 94, 91, 104, 118, 138, 159, 158, 
-156, 146, 124, 99, 69, 47, 34, 33, 44, 61, 97, 129, 154, 179, 182, 183, 178, 153, 134, 119, 
-110, 113, 125, 141, 164, 185, 193, 194, 191, 166, 142, 106, 58, 34, 44, 72, 88, 134, 176, 195, 
-183, 179, 166, 141, 116, 84, 60, 48, 43, 51, 66, 87, 112, 133, 147, 149, 143, 129, 104, 86, 
-73, 68, 81, 95, 122, 157, 181, 202, 212, 209, 201, 183, 157, 136, 120, 111, 113, 127, 145, 172, 
-189, 193, 196, 183, 159, 132, 90, 63, 50, 40, 47, 60, 83, 110, 131, 146, 147, 146, 132, 109, 
-99, 86, 85, 101, 114, 142, 174, 197, 214, 221, 214, 199, 173, 137, 104, 88, 71, 76, 90, 96, 
-115, 143, 175, 172, 177, 168, 138, 94, 72, 67, 66, 86, 111, 131, 148, 151, 142, 124, 93, 63, 
-45, 38, 42, 58, 84, 116, 149, 168, 176, 181, 166, 143, 123, 103, 98, 106, 122, 149, 179, 200, 
-214, 217, 207, 188, 159, 128, 106, 95, 91, 102, 122, 143, 165, 167, 159, 148, 121, 89, 62, 42, 
-34, 41, 59, 85, 122, 149, 164, 179, 173, 160, 143, 120, 109, 106, 113, 131, 157, 181, 195, 203, 
-199, 184, 165, 125, 92, 71, 40, 37, 61, 114, 146, 181, 208, 207, 177, 143, 113, 79, 63, 54, 
-56, 72, 96, 120, 138, 144, 140, 129, 112, 84, 65, 54, 52, 68, 91, 121, 160, 181, 193, 199, 
-187, 169, 145, 122, 110, 109, 121, 144, 174, 196, 208, 213, 205, 189, 162, 125, 101, 84, 73, 83, 
-95, 112, 137, 145, 148, 141, 122, 94, 68, 52, 41, 48, 67, 91, 136, 168, 187, 207, 202, 189, 
-167, 138, 121, 110, 112, 121, 142, 167, 182, 193, 188, 169, 152, 103, 61, 46, 59, 68, 96, 140, 
-175, 182, 180, 180, 158, 137, 104, 71, 53, 44, 46, 61, 82, 110, 132, 149, 153, 146, 130, 101, 
-80, 68, 61, 77, 98, 127, 166, 188, 203, 209, 199, 183, 155, 129, 112, 106, 112, 127, 154, 180, 
-196, 206, 198, 182, 158, 119, 91, 68, 52, 59, 69, 91, 119, 136, 145, 145, 136, 114, 88, 71, 
-56, 64, 81, 105, 150, 184, 208, 223, 219, 208, 183, 149, 118, 99, 92, 97, 117, 142, 158, 174, 
-159, 140, 127, 125, 102, 88, 95, 100, 97, 100, 132, 149, 163, 168, 154, 134, 102, 66, 45, 30, 
-30, 44, 71, 105, 134, 155, 163, 161, 152, 124, 103, 88, 79, 90, 106, 132, 169, 192, 207, 213, 
-207, 193, 169, 139, 115, 102, 103, 113, 138, 163, 181, 193, 187, 175, 151, 109, 79, 56, 42, 45, 
-56, 77, 109, 136, 152, 158, 156, 138, 119, 100, 84, 88, 100, 118, 151, 182, 206, 219, 219, 206, 
-184, 151, 117, 93, 78, 70, 88, 98, 112, 132, 166, 178, 175, 174, 148, 112, 76, 67, 65, 76, 
-102, 128, 147, 159, 153, 140, 112, 78, 53, 41, 40, 51, 73, 103, 137, 164, 176, 181, 175, 152, 
-128, 106, 91, 94, 106, 129, 161, 188, 206, 215, 210, 195, 170, 138, 110, 94, 86, 93, 113, 136, 
-159, 174, 169, 160, 140, 108, 77, 53, 38, 38, 53, 75, 109, 144, 162, 176, 180, 166, 150, 127, 
-108, 102, 104, 118, 141, 170, 189, 201, 203, 192, 175, 146, 104, 82, 55, 39, 50, 92, 135, 163, 
-197, 208, 194, 159, 128, 92, 68, 57, 55, 64, 87, 114, 137, 149, 149, 140, 124, 98, 72, 57, 
-50, 58, 79, 105, 143, 173, 187, 196, 191, 174, 151, 124, 106, 99, 106, 125, 154, 183, 201, 210, 
-209, 195, 174, 139, 106, 88, 74, 77, 91, 105, 132, 150, 155, 154, 139, 114, 83, 61, 47, 43, 
-60, 79, 115, 157, 179, 200, 206, 193, 175, 145, 122, 107, 104, 111, 128, 156, 178, 190, 196, 180, 
-166, 130, 81, 52, 52, 66, 79, 120, 161, 184, 181, 185, 173, 150, 123, 88, 63, 49, 45, 56, 
-75, 104, 132, 151, 161, 157, 144, 117, 88, 72, 59, 62, 82, 107, 145, 176, 193, 204, 199, 185, 
-159, 127, 105, 92, 93, 106, 129, 162, 185, 199, 201, 188, 169, 134, 98, 76, 56, 54, 66, 85, 
-116, 140, 155, 159, 153, 136, 105, 81, 62, 56, 70, 88, 122, 165, 192, 212, 217, 207, 188, 155, 
-121, 96, 84, 87, 101, 131, 153, 173, 179, 163, 146, 134, 117, 90, 86, 87, 92, 93, 118, 148, 
-165, 177, 172, 154, 128, 90, 61, 42, 33, 42, 63, 98, 132, 157, 171, 170, 163, 141, 111, 92, 
-75, 74, 89, 109, 145, 177, 196, 208, 206, 194, 172, 140, 112, 93, 88, 96, 116, 146, 170, 189, 
-193, 183, 167, 130, 93, 68, 48, 45, 55, 73, 104, 136, 158, 167, 168, 155, 130, 108, 87, 77, 
-85, 99, 127, 162, 191, 210, 217, 209, 191, 161, 124, 94, 78, 69, 79, 100, 115, 136, 161, 184, 
-179, 176, 158, 127, 89, 68, 66, 71, 95, 125, 148, 165, 168, 157, 136, 101, 69, 50, 42, 47, 
-68, 100, 136, 166, 182, 182, 174, 147, 116, 94, 78, 83, 102, 130, 166, 191, 206, 209, 197, 173, 
-137, 108, 87, 80, 92, 112, 145, 171, 184, 189, 171, 143, 108, 73, 51, 43, 50, 70, 104, 139, 
-161, 175, 172, 155, 132, 102, 83, 79, 87, 109, 143, 177, 202, 215, 211, 193, 163, 125, 93, 75, 
-69, 80, 107, 127, 146, 166, 184, 174, 158, 134, 107, 76, 65, 76, 93, 128, 155, 171, 174, 160, 
-135, 99, 66, 43, 37, 51, 75, 112, 146, 167, 180, 176, 157, 131, 101, 81, 75, 83, 107, 142, 
-174, 197, 208, 204, 191, 162, 128, 100, 84, 85, 101, 128, 158, 183, 195, 187, 171, 139, 98, 71, 
-49, 46, 58, 81, 114, 144, 164, 169, 162, 142, 109, 88, 72, 70, 90, 116, 154, 189, 210, 219, 
-211, 190, 152, 117, 90, 75, 83, 97, 125, 158, 164, 165, 162, 161, 135, 110, 97, 86, 79, 86, 
-115, 143, 168, 179, 173, 156, 124, 85, 58, 38, 37, 54, 86, 124, 154, 173, 176, 167, 146, 111, 
-88, 71, 67, 85, 110, 147, 180, 199, 206, 198, 178, 147, 115, 91, 80, 88, 108, 140, 172, 190, 
-198, 190, 166, 132, 95, 65, 52, 53, 69, 98, 130, 154, 169, 169, 154, 129, 97, 70, 61, 67, 
-85, 121, 160, 190, 211, 212, 200, 175, 138, 105, 83, 77, 87, 113, 146, 168, 186, 179, 159, 138, 
-117, 89, 73, 77, 90, 107, 131, 163, 179, 186, 176, 151, 116, 80, 54, 42, 46, 65, 98, 136, 
-163, 176, 175, 158, 130, 99, 73, 63, 69, 87, 121, 157, 184, 202, 203, 191, 167, 132, 105, 86, 
-83, 95, 120, 155, 182, 199, 200, 186, 161, 121, 89, 66, 53, 62, 80, 111, 142, 161, 169, 161, 
-144, 112, 81, 63, 53, 67, 92, 126, 167, 193, 207, 206, 189, 160, 126, 100, 83, 84, 101, 128, 
-161, 183, 189, 187, 163, 126, 89, 74, 63, 67, 94, 125, 155, 173, 190, 187, 171, 144, 105, 74, 
-54, 46, 58, 79, 112, 144, 166, 175, 166, 148, 115, 85, 67, 58, 71, 96, 130, 167, 191, 202, 
-201, 184, 153, 118, 92, 78, 84, 102, 131, 165, 189, 201, 199, 181, 151, 115, 83, 64, 62, 71, 
-96, 129, 155, 172, 173, 159, 134, 100, 72, 53, 53, 66, 95, 136, 167, 193, 202, 193, 175, 141, 
-111, 89, 80, 87, 107, 140, 169, 189, 196, 184, 165, 127, 84, 57, 54, 66, 88, 130, 168, 189, 
-193, 188, 167, 134, 99, 70, 53, 54, 68, 96, 129, 155, 171, 174, 162, 138, 104, 76, 58, 58, 
-73, 101, 140, 171, 194, 201, 192, 172, 138, 107, 85, 77, 88, 112, 147, 176, 196, 204, 194, 175, 
-140, 104, 80, 64, 67, 85, 111, 144, 166, 175, 171, 152, 121, 86, 62, 47, 51, 72, 102, 141, 
-173, 190, 196, 185, 159, 127, 101, 83, 82, 96, 120, 153, 180, 194, 196, 185, 156, 122, 85, 55, 
-45, 64, 96, 131, 172, 198, 204, 186, 164, 127, 91, 68, 55, 60, 79, 109, 142, 164, 174, 169, 
-153, 125, 92, 68, 55, 59, 80, 111, 148, 178, 193, 196, 185, 158, 125, 98, 80, 80, 95, 124, 
-161, 188, 203, 204, 189, 162, 125, 93, 70, 64, 73, 94, 129, 157, 177, 183, 171, 149, 114, 80, 
-57, 48, 57, 79, 115, 150, 176, 191, 187, 171, 142, 108, 85, 72, 77, 96, 127, 161, 184, 198, 
-194, 178, 150, 110, 80, 59, 52, 66, 98, 141, 170, 194, 201, 187, 156, 118, 86, 63, 58, 68, 
-91, 126, 156, 175, 181, 170, 148, 114, 84, 61, 53, 63, 85, 123, 157, 181, 194, 189, 172, 141, 
-107, 83, 70, 76, 97, 129, 165, 190, 203, 200, 183, 153, 116, 87, 69, 68, 83, 111, 144, 172, 
-185, 183, 168, 138, 101, 72, 51, 48, 63, 90, 127, 159, 180, 187, 181, 160, 127, 98, 77, 71, 
-82, 105, 140, 173, 194, 202, 194, 173, 138, 104, 74, 59, 64, 77, 107, 146, 177, 191, 193, 181, 
-151, 110, 81, 63, 61, 77, 104, 140, 167, 182, 182, 167, 138, 101, 73, 55, 53, 69, 97, 134, 
-166, 186, 192, 184, 159, 125, 96, 75, 72, 85, 108, 144, 175, 196, 204, 196, 175, 141, 107, 83, 
-71, 78, 96, 128, 160, 181, 191, 191, 188, 186, 183, 181, 180, 177, 176, 175, 175, 175, 176, 176, 
-176, 178, 178, 179, 181, 180, 180, 180, 180, 180, 180, 180, 178, 177, 175, 172, 171, 167, 164, 161, 
-154, 151, 151, 157, 157, 160, 164, 164, 158, 155, 153, 149, 148, 146, 144, 143, 142, 140, 140, 138, 
-137, 137, 138, 137, 138, 138, 138, 139, 139, 139, 142, 142, 143, 144, 144, 145, 146, 145, 146, 145, 
-145, 145, 145, 144, 143, 142, 141, 140, 139, 136, 135, 134, 131, 130, 127, 124, 123, 121, 119, 118, 
-117, 116, 117, 117, 117, 119, 120, 120, 124, 125, 126, 129, 130, 131, 132, 132, 132, 132, 132, 131, 
-130, 129, 127, 127, 124, 121, 120, 114, 111, 111, 117, 119, 123, 128, 128, 125, 120, 120, 117, 116, 
-114, 113, 112, 112, 111, 112, 111, 111, 111, 112, 112, 113, 114, 114, 115, 117, 117, 120, 121, 122, 
-124, 124, 125, 127, 127, 128, 128, 128, 128, 128, 128, 127, 127, 126, 125, 124, 123, 122, 121, 118, 
-118, 116, 113, 112, 110, 109, 109, 108, 110, 112, 113, 113, 114, 115, 115, 116, 117, 118, 119, 120, 
-120, 121, 121, 121, 121, 121, 121, 121, 120, 119, 119, 118, 117, 117, 114, 112, 112, 115, 116, 118, 
-120, 121, 120, 117, 117, 115, 115, 115, 114, 114, 113, 113, 113, 113, 113, 113, 114, 114, 115, 115, 
-116, 116, 117, 117, 118, 119, 120, 121, 121, 122, 122, 123, 123, 123, 123, 123, 124, 123, 123, 123, 
-123, 122, 122, 121, 121, 120, 119, 119, 118, 117, 116, 116, 115, 115, 114, 114, 114, 115, 115, 115, 
-116, 116, 117, 118, 119, 120, 121, 121, 122, 122, 122, 123, 123, 122, 122, 122, 121, 121, 120, 119, 
-119, 116, 114, 114, 117, 118, 119, 122, 123, 122, 120, 119, 118, 117, 117, 116, 116, 116, 116, 116, 
-116, 116, 116, 116, 117, 117, 118, 118, 119, 120, 121, 122, 123, 123, 124, 125, 125, 126, 126, 126, 
-127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 125, 124, 124, 123, 122, 122, 120, 120, 119, 118, 
-118, 118, 118, 118, 118, 119, 119, 120, 120, 122, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 
-123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 
-123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 
-124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 
-125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 
-125, 125, 125, 125, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 
-124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 
-125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 
-127, 127, 127, 127, 128, 128, 128, 128, 127, 128, 127, 128, 128, 128, 128, 128, 127, 128, 127, 128, 
-127, 128, 128, 128, 127, 128, 127, 128, 127, 128, 127, 128, 128, 128, 127, 128, 127, 128, 127, 128, 
-127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 128, 127, 128, 127, 129, 104, 50, 16, 25, 
-42, 61, 113, 152, 155, 139, 128, 93, 62, 36, 22, 30, 49, 78, 99, 105, 101, 87, 64, 43, 
-36, 40, 64, 100, 128, 156, 157, 150, 130, 106, 100, 104, 121, 153, 182, 202, 205, 190, 159, 128, 
-105, 97, 107, 125, 156, 167, 163, 149, 106, 69, 40, 23, 33, 54, 86, 113, 128, 123, 112, 86, 
-66, 73, 82, 119, 162, 190, 211, 210, 195, 167, 138, 119, 118, 131, 152, 181, 178, 174, 145, 86, 
-49, 57, 74, 98, 156, 193, 192, 175, 163, 121, 85, 53, 37, 48, 71, 104, 125, 130, 123, 107, 
-80, 57, 50, 57, 87, 126, 156, 183, 182, 173, 150, 125, 119, 124, 144, 178, 207, 226, 227, 211, 
-175, 144, 120, 115, 126, 144, 173, 180, 176, 161, 118, 82, 54, 40, 50, 72, 103, 127, 141, 135, 
-123, 96, 79, 86, 96, 136, 177, 203, 222, 220, 203, 174, 146, 127, 128, 140, 163, 191, 187, 182, 
-147, 89, 56, 68, 83, 111, 167, 201, 198, 180, 166, 123, 88, 56, 44, 55, 80, 113, 134, 138, 
-131, 112, 83, 61, 55, 63, 95, 133, 163, 188, 187, 176, 150, 125, 120, 125, 146, 181, 211, 229, 
-228, 209, 173, 141, 118, 115, 127, 147, 176, 183, 178, 160, 116, 82, 53, 41, 54, 77, 108, 132, 
-144, 136, 123, 93, 78, 84, 95, 136, 177, 204, 221, 217, 200, 170, 141, 123, 126, 139, 165, 191, 
-186, 180, 142, 85, 57, 70, 82, 111, 168, 200, 195, 180, 163, 119, 85, 54, 44, 56, 83, 115, 
-134, 137, 129, 109, 79, 59, 54, 63, 98, 136, 166, 189, 186, 176, 148, 123, 118, 124, 148, 183, 
-211, 228, 225, 204, 168, 137, 115, 113, 126, 148, 176, 180, 176, 154, 110, 77, 49, 40, 52, 77, 
-109, 132, 142, 134, 119, 87, 74, 82, 95, 139, 178, 204, 220, 214, 196, 164, 136, 120, 124, 139, 
-166, 189, 183, 178, 138, 81, 54, 68, 81, 116, 172, 199, 191, 178, 160, 115, 81, 49, 42, 56, 
-84, 117, 134, 135, 126, 105, 76, 56, 53, 64, 100, 137, 168, 189, 184, 172, 143, 121, 118, 124, 
-148, 183, 211, 227, 223, 200, 163, 132, 111, 111, 124, 149, 177, 180, 175, 153, 108, 74, 46, 39, 
-53, 79, 111, 134, 143, 133, 116, 84, 74, 80, 96, 139, 177, 204, 218, 211, 191, 158, 131, 115, 
-121, 136, 165, 188, 183, 175, 131, 75, 52, 67, 79, 117, 171, 197, 190, 176, 155, 110, 77, 46, 
-42, 56, 86, 119, 136, 136, 126, 103, 74, 55, 52, 64, 102, 138, 169, 188, 182, 168, 137, 117, 
-115, 123, 149, 185, 212, 226, 221, 196, 158, 129, 109, 112, 125, 151, 178, 180, 174, 148, 103, 70, 
-42, 38, 53, 81, 112, 134, 140, 131, 112, 80, 73, 79, 96, 141, 179, 205, 216, 208, 187, 153, 
-127, 113, 121, 137, 167, 186, 180, 171, 123, 70, 50, 66, 79, 118, 173, 196, 186, 174, 149, 104, 
-73, 44, 41, 57, 89, 119, 135, 134, 125, 101, 71, 54, 52, 67, 106, 141, 172, 188, 181, 167, 
-135, 115, 114, 124, 153, 188, 214, 227, 219, 193, 156, 127, 108, 112, 126, 154, 178, 179, 174, 144, 
-99, 68, 41, 40, 56, 86, 117, 139, 144, 132, 111, 78, 71, 76, 97, 143, 179, 205, 215, 205, 
-182, 147, 121, 109, 118, 136, 168, 185, 181, 170, 122, 70, 52, 65, 79, 121, 173, 194, 184, 173, 
-147, 102, 70, 42, 42, 59, 92, 123, 138, 136, 125, 98, 68, 51, 51, 68, 107, 142, 174, 187, 
-179, 161, 129, 111, 110, 121, 151, 187, 213, 224, 216, 187, 149, 120, 103, 109, 124, 155, 179, 180, 
-173, 142, 97, 65, 39, 40, 57, 88, 119, 141, 144, 132, 109, 77, 73, 78, 102, 147, 182, 208, 
-216, 205, 179, 144, 119, 109, 119, 137, 170, 185, 181, 167, 116, 65, 53, 67, 80, 126, 175, 194, 
-183, 172, 142, 98, 66, 40, 42, 61, 95, 125, 138, 135, 122, 94, 66, 51, 51, 69, 110, 144, 
-175, 186, 177, 157, 126, 110, 110, 122, 153, 189, 215, 224, 214, 185, 147, 119, 103, 111, 128, 158, 
-180, 180, 172, 138, 94, 62, 38, 42, 60, 92, 122, 142, 143, 131, 106, 76, 74, 79, 104, 151, 
-186, 210, 216, 203, 174, 140, 116, 107, 119, 139, 173, 185, 182, 165, 113, 66, 54, 67, 82, 128, 
-177, 193, 183, 172, 140, 98, 65, 41, 45, 65, 100, 129, 141, 137, 123, 94, 65, 49, 51, 72, 
-114, 148, 178, 186, 177, 155, 122, 106, 106, 121, 154, 190, 214, 223, 211, 179, 141, 113, 99, 108, 
-127, 159, 179, 180, 172, 136, 92, 60, 38, 43, 63, 97, 127, 146, 144, 131, 104, 74, 71, 78, 
-107, 154, 186, 210, 214, 200, 172, 138, 114, 108, 120, 141, 176, 185, 182, 163, 110, 64, 56, 69, 
-86, 135, 181, 193, 181, 172, 137, 94, 62, 39, 46, 67, 102, 130, 140, 136, 120, 90, 62, 49, 
-51, 75, 117, 150, 179, 185, 174, 151, 119, 106, 107, 123, 157, 191, 215, 222, 208, 175, 138, 110, 
-99, 109, 127, 161, 180, 179, 169, 130, 88, 57, 37, 44, 64, 99, 128, 147, 145, 131, 101, 74, 
-73, 81, 112, 157, 189, 212, 214, 199, 169, 135, 113, 109, 121, 144, 179, 186, 183, 160, 104, 62, 
-58, 70, 87, 138, 184, 195, 182, 170, 133, 92, 60, 40, 48, 71, 108, 135, 145, 140, 121, 89, 
-62, 49, 53, 78, 121, 154, 182, 185, 174, 147, 115, 102, 104, 122, 157, 192, 215, 220, 204, 169, 
-132, 105, 96, 107, 129, 163, 180, 179, 167, 127, 86, 54, 36, 45, 68, 104, 133, 149, 145, 130, 
-98, 71, 70, 79, 111, 157, 189, 211, 212, 195, 163, 130, 109, 105, 120, 146, 179, 185, 183, 156, 
-103, 62, 57, 69, 89, 142, 184, 193, 182, 169, 130, 91, 58, 40, 50, 75, 112, 138, 146, 139, 
-120, 88, 61, 49, 55, 83, 125, 159, 185, 186, 174, 145, 113, 101, 105, 124, 161, 194, 216, 219, 
-202, 166, 129, 103, 96, 108, 132, 165, 180, 179, 165, 124, 83, 52, 36, 46, 71, 107, 134, 150, 
-143, 127, 95, 70, 70, 80, 115, 160, 191, 212, 209, 192, 159, 127, 107, 106, 121, 148, 181, 185, 
-183, 155, 99, 60, 59, 71, 94, 147, 186, 192, 182, 168, 127, 88, 55, 41, 52, 78, 115, 139, 
-146, 139, 118, 85, 59, 50, 56, 87, 129, 161, 186, 186, 171, 141, 111, 100, 104, 125, 162, 196, 
-217, 218, 199, 161, 126, 100, 95, 108, 133, 168, 182, 181, 164, 122, 82, 51, 38, 49, 75, 112, 
-139, 153, 146, 128, 92, 70, 70, 80, 118, 162, 192, 211, 208, 189, 154, 122, 102, 104, 120, 150, 
-181, 186, 182, 150, 95, 60, 60, 69, 94, 147, 186, 192, 182, 166, 124, 86, 54, 42, 54, 83, 
-120, 144, 149, 140, 118, 84, 59, 50, 58, 91, 132, 164, 188, 185, 170, 138, 109, 100, 105, 128, 
-166, 199, 218, 217, 197, 158, 124, 99, 96, 110, 137, 171, 182, 180, 162, 117, 79, 49, 38, 51, 
-78, 114, 141, 152, 144, 124, 89, 68, 69, 81, 121, 164, 194, 211, 206, 186, 151, 120, 101, 104, 
-122, 153, 182, 185, 180, 144, 91, 57, 59, 69, 98, 152, 187, 190, 180, 162, 120, 83, 51, 42, 
-55, 86, 123, 145, 150, 140, 116, 82, 58, 51, 61, 96, 136, 168, 189, 184, 168, 135, 108, 100, 
-107, 132, 171, 202, 220, 217, 195, 156, 122, 96, 89, 104, 135, 168, 181, 180, 161, 118, 79, 49, 
-41, 55, 85, 123, 150, 160, 149, 126, 88, 67, 66, 80, 119, 162, 193, 208, 201, 178, 140, 109, 
-91, 97, 116, 151, 180, 185, 181, 147, 93, 61, 60, 68, 98, 149, 184, 190, 182, 163, 119, 81, 
-51, 44, 59, 92, 130, 152, 156, 145, 118, 82, 58, 50, 63, 97, 139, 171, 190, 184, 164, 128, 
-100, 91, 100, 126, 165, 197, 215, 211, 187, 146, 112, 90, 91, 107, 140, 174, 185, 183, 160, 116, 
-77, 48, 43, 58, 91, 128, 154, 162, 151, 125, 88, 70, 69, 84, 125, 168, 196, 210, 201, 176, 
-138, 108, 92, 99, 119, 155, 182, 187, 179, 141, 89, 61, 61, 70, 101, 153, 185, 190, 181, 160, 
-116, 79, 49, 45, 62, 96, 133, 153, 155, 144, 115, 80, 56, 51, 64, 102, 142, 174, 190, 182, 
-161, 125, 100, 92, 101, 129, 170, 201, 217, 211, 185, 144, 111, 90, 93, 111, 145, 178, 190, 187, 
-160, 111, 71, 40, 36, 56, 92, 132, 159, 166, 152, 124, 85, 78, 83, 87, 99, 106, 112, 118, 
-120, 124, 126, 126, 123, 122, 116, 113, 107, 95, 91, 71, 54, 55, 77, 88, 107, 128, 132, 116, 
-107, 100, 90, 87, 79, 76, 72, 70, 69, 66, 64, 65, 68, 71, 73, 77, 79, 88, 92, 101, 
-111, 116, 126, 133, 138, 146, 149, 154, 156, 158, 161, 163, 161, 159, 158, 154, 152, 146, 140, 136, 
-126, 122, 113, 100, 95, 87, 82, 79, 75, 74, 77, 81, 85, 95, 99, 112, 123, 131, 145, 152, 
-159, 164, 167, 170, 172, 171, 169, 167, 160, 156, 150, 136, 130, 109, 91, 92, 112, 121, 140, 158, 
-159, 141, 130, 120, 109, 106, 97, 95, 92, 91, 91, 90, 88, 91, 95, 98, 103, 106, 110, 119, 
-122, 130, 138, 141, 150, 154, 159, 165, 166, 169, 170, 171, 173, 173, 170, 168, 165, 161, 159, 153, 
-148, 145, 135, 132, 123, 113, 109, 101, 99, 97, 95, 96, 99, 102, 105, 113, 115, 127, 135, 141, 
-154, 159, 165, 170, 171, 174, 174, 172, 169, 167, 160, 157, 149, 137, 130, 110, 96, 101, 119, 126, 
-143, 159, 159, 145, 138, 129, 121, 117, 109, 106, 103, 101, 99, 96, 93, 94, 97, 97, 100, 102, 
-105, 112, 115, 124, 131, 137, 145, 149, 155, 160, 163, 166, 168, 170, 172, 172, 170, 169, 166, 162, 
-160, 154, 148, 144, 135, 131, 121, 112, 107, 99, 95, 92, 89, 89, 92, 95, 100, 108, 111, 124, 
-132, 140, 152, 157, 163, 168, 170, 173, 174, 172, 169, 168, 160, 158, 148, 139, 131, 112, 98, 103, 
-119, 126, 144, 158, 155, 139, 133, 123, 116, 112, 106, 104, 102, 101, 101, 99, 99, 101, 105, 107, 
-111, 114, 118, 124, 125, 133, 138, 141, 148, 151, 155, 160, 161, 163, 164, 165, 166, 166, 163, 162, 
-159, 156, 154, 149, 145, 141, 133, 131, 122, 115, 111, 105, 103, 100, 98, 99, 101, 103, 106, 112, 
-115, 126, 131, 139, 149, 152, 158, 161, 162, 165, 165, 164, 161, 160, 154, 153, 144, 136, 129, 110, 
-98, 107, 123, 131, 150, 163, 160, 145, 139, 128, 121, 116, 109, 106, 102, 100, 98, 95, 93, 94, 
-96, 98, 101, 102, 106, 112, 115, 123, 128, 133, 140, 143, 148, 152, 154, 157, 158, 160, 161, 161, 
-159, 157, 155, 152, 150, 144, 140, 136, 129, 126, 116, 110, 105, 99, 97, 94, 92, 93, 96, 98, 
-103, 109, 113, 123, 128, 136, 145, 149, 154, 158, 159, 162, 162, 160, 158, 156, 150, 148, 139, 133, 
-125, 108, 99, 106, 119, 125, 141, 152, 148, 135, 130, 121, 116, 112, 108, 106, 104, 103, 103, 101, 
-101, 103, 106, 108, 111, 112, 116, 120, 123, 130, 134, 138, 144, 146, 151, 154, 155, 158, 158, 159, 
-161, 160, 158, 157, 154, 152, 150, 145, 142, 137, 131, 128, 119, 114, 110, 105, 103, 101, 99, 99, 
-102, 103, 107, 111, 114, 124, 128, 136, 144, 147, 152, 155, 156, 158, 158, 157, 155, 153, 147, 146, 
-137, 132, 125, 109, 100, 109, 121, 129, 146, 155, 149, 137, 132, 123, 118, 114, 109, 106, 104, 103, 
-101, 98, 97, 98, 101, 102, 105, 107, 112, 117, 120, 129, 133, 138, 144, 147, 153, 156, 155, 153, 
-152, 153, 154, 153, 151, 149, 147, 145, 143, 138, 136, 132, 127, 125, 117, 112, 108, 104, 102, 100, 
-99, 101, 103, 106, 110, 114, 118, 126, 129, 136, 142, 145, 149, 151, 152, 154, 153, 151, 149, 147, 
-143, 141, 134, 130, 123, 111, 104, 111, 119, 125, 137, 142, 138, 130, 127, 120, 118, 115, 113, 112, 
-111, 111, 111, 110, 110, 112, 114, 116, 118, 118, 121, 124, 125, 130, 132, 135, 139, 140, 144, 145, 
-146, 147, 148, 149, 150, 149, 148, 147, 146, 144, 143, 140, 138, 135, 132, 130, 123, 121, 118, 115, 
-113, 111, 109, 109, 111, 111, 114, 116, 119, 126, 128, 133, 138, 140, 144, 145, 146, 148, 147, 146, 
-145, 144, 141, 140, 133, 130, 123, 113, 110, 118, 125, 132, 143, 148, 142, 134, 130, 123, 120, 116, 
-112, 110, 108, 106, 104, 101, 101, 102, 104, 105, 108, 109, 114, 118, 122, 128, 131, 136, 140, 143, 
-147, 150, 153, 154, 155, 156, 156, 155, 153, 151, 148, 146, 144, 139, 137, 132, 128, 124, 117, 113, 
-109, 106, 105, 104, 104, 105, 107, 109, 112, 114, 117, 123, 125, 130, 134, 136, 139, 140, 141, 142, 
-141, 140, 139, 137, 135, 133, 128, 125, 120, 111, 108, 114, 118, 124, 132, 135, 131, 126, 124, 120, 
-119, 117, 115, 114, 114, 113, 113, 112, 113, 114, 115, 116, 117, 118, 120, 121, 123, 127, 128, 131, 
-133, 135, 137, 138, 139, 140, 141, 142, 142, 142, 141, 141, 140, 139, 138, 136, 135, 132, 130, 128, 
-124, 122, 119, 117, 116, 114, 113, 114, 115, 115, 118, 119, 122, 126, 128, 133, 136, 138, 140, 141, 
-142, 143, 143, 142, 142, 140, 138, 137, 133, 131, 125, 118, 116, 123, 127, 132, 139, 141, 136, 131, 
-128, 123, 121, 118, 116, 114, 112, 111, 110, 109, 109, 110, 111, 113, 115, 116, 119, 121, 124, 128, 
-130, 134, 137, 139, 142, 143, 144, 145, 145, 146, 146, 145, 144, 143, 141, 140, 138, 135, 134, 130, 
-128, 125, 120, 118, 115, 113, 113, 112, 112, 114, 115, 117, 120, 122, 126, 130, 132, 138, 140, 143, 
-145, 146, 144, 138, 135, 133, 132, 130, 129, 128, 125, 124, 120, 116, 115, 119, 121, 124, 129, 130, 
-128, 126, 125, 123, 123, 122, 121, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 123, 124, 
-125, 126, 127, 128, 129, 130, 131, 131, 132, 133, 133, 134, 134, 134, 134, 133, 133, 133, 132, 131, 
-131, 130, 129, 128, 126, 125, 124, 123, 122, 121, 120, 121, 121, 121, 122, 122, 124, 126, 128, 130, 
-131, 133, 134, 134, 135, 136, 136, 135, 135, 135, 134, 133, 131, 131, 128, 124, 124, 127, 129, 132, 
-135, 135, 132, 130, 128, 126, 125, 123, 122, 121, 120, 119, 118, 118, 118, 119, 120, 121, 122, 123, 
-125, 126, 127, 129, 130, 132, 133, 134, 136, 136, 137, 137, 137, 137, 137, 136, 135, 135, 134, 133, 
-132, 130, 130, 128, 127, 125, 122, 121, 120, 120, 120, 119, 120, 121, 122, 123, 124, 125, 128, 130, 
-132, 134, 135, 136, 137, 137, 138, 138, 137, 137, 137, 135, 134, 132, 130, 128, 124, 120, 120, 124, 
-126, 130, 134, 134, 131, 126, 123, 122, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 
-123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 
-124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 
-126, 126, 126, 126, 126, 127, 127, 127, 127, 128, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 76, 73, 83, 84, 24, 0, 0, 0, 73, 78, 
-70, 79, 73, 67, 82, 68, 12, 0, 0, 0, 49, 57, 57, 52, 45, 49, 50, 45, 48, 56, 
-0, 69, 102, 97, 99, 116, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-0, 0, 0, 0, 0, 0, 0, 0
-};
-// total size: 46548
@@ -13,18 +13,18 @@
 /************/
 
 #include "pacman.h"
-#include "startup/printf_P.h"
+#include "log.h"
 
 /*************/
 /* Variables */
 /*************/
 
 // Characters
-static Character pacman;
-static Character ghosts[NUMBER_OF_GHOSTS];
+static PACMAN_TLS Character pacman;
+static PACMAN_TLS Character ghosts[NUMBER_OF_GHOSTS];
 
-// Contains static elements of the board.
-Field defaultBoard[BOARD_HEIGHT][BOARD_WIDTH] = {
+// Layout of the default board, stays in flash and is read in place.
+const tU8 defaultBoard[DEFAULT_BOARD_HEIGHT][DEFAULT_BOARD_WIDTH] = {
     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
     {1, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1},
     {1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1},
@@ -48,33 +48,45 @@ Field defaultBoard[BOARD_HEIGHT][BOARD_WIDTH] = {
     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
 };
 
-Field board[BOARD_HEIGHT][BOARD_WIDTH];
+PACMAN_TLS const tU8 *boardLayout;
+PACMAN_TLS tU8 boardWidth;
+PACMAN_TLS tU8 boardHeight;
+PACMAN_TLS tU8 eatenFields[BOARD_BITMAP_SIZE];
+
+// birthplaces of Pacman and of the ghosts, the same on every board
+static const Coordinates startFields[1 + NUMBER_OF_GHOSTS] = {
+    {10, 15}, {10, 6}, {10, 8}, {9, 8}, {11, 8}
+};
+
+// number of points on the layout, counted when the layout changes
+static PACMAN_TLS tU16 layoutPoints;
 
 //game state indicators
-static tU8 ghostEatingMode;
-static tU8 moveToInitPositions;
+static PACMAN_TLS tU8 ghostEatingMode;
+static PACMAN_TLS tU8 moveToInitPositions;
 
-static tU8 defaultBoardUsed;
+static PACMAN_TLS tU8 defaultBoardUsed;
 
 //game counters
-static tU8 level;
-static tU8 lives;
-static tU8 score;
-static tU8 pointsToCompleteLevel;
+static PACMAN_TLS tU8 level;
+static PACMAN_TLS tU8 lives;
+static PACMAN_TLS tU32 score;
+static PACMAN_TLS tU16 pointsToCompleteLevel;
 
 //seed for random function
-static int seed;
+static PACMAN_TLS tU32 seed;
+static PACMAN_TLS int initSeed = INIT_SEED;
 
 /************/
 /* Handlers */
 /************/
 
-static void (*handleGameLost)(tU8 level, tU8 score);
-static void (*handleLifeLost)(tU8 lives);
-static void (*handleScoreChanged)(tU8 score);
-static void (*handleLevelComplete)(tU8 level, tU8 score);
-static void (*handleGhostEaten)(void);
-static void (*handleTimeToEatChanged)(tU8 remainingTime);
+static PACMAN_TLS void (*handleGameLost)(tU8 level, tU32 score);
+static PACMAN_TLS void (*handleLifeLost)(tU8 lives);
+static PACMAN_TLS void (*handleScoreChanged)(tU32 score);
+static PACMAN_TLS void (*handleLevelComplete)(tU8 level, tU32 score);
+static PACMAN_TLS void (*handleGhostEaten)(void);
+static PACMAN_TLS void (*handleTimeToEatChanged)(tU8 remainingTime);
 
 /*************/
 /* Functions */
@@ -83,11 +95,12 @@ static void (*handleTimeToEatChanged)(tU8 remainingTime);
 /*****************************************************************************
  *
  * Description:
- *    Generates seed for random() function
+ *    Generates seed for random() function. The state of the game is added
+ *    to the seed, so the initial seed keeps affecting every game.
  *
  ****************************************************************************/
 static void generateSeed() {
-    seed = seed * (lives * score * pointsToCompleteLevel
+    seed = seed + (lives * score * pointsToCompleteLevel
                    + pacman.position.x * ghosts[0].position.x * ghosts[1].position.x * ghosts[2].position.x  * ghosts[3].position.x
                    + pacman.position.y * ghosts[0].position.y * ghosts[1].position.y * ghosts[2].position.y  * ghosts[3].position.y);
 }
@@ -95,15 +108,16 @@ static void generateSeed() {
 /*****************************************************************************
  *
  * Description:
- *    Generates pseudo random number
+ *    Generates pseudo random number. The low bits of the generator repeat
+ *    with short periods, so the high ones are returned.
  *
  * Returns:
  *    tU16 - pseudo random number
  *
  ****************************************************************************/
 static tU16 random() {
-    seed = (seed * 1103515245 + 12345) % 2147483647;
-    return seed;
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
 }
 
 /*****************************************************************************
@@ -146,10 +160,13 @@ inline static Coordinates calculateMove(Coordinates coords, Direction dir) {
  *
  ****************************************************************************/
 inline static tU8 canMove(Coordinates coords, CharacterType type) {
-    if (WALL == board[coords.y][coords.x]) {
+    // walls and doors are never eaten, so the layout can be read directly
+    Field field = getLayoutField(coords.y, coords.x);
+
+    if (WALL == field) {
         return FALSE;
     }
-    if (PACMAN == type && DOORS == board[coords.y][coords.x]) {
+    if (PACMAN == type && DOORS == field) {
         return FALSE;
     }
     return TRUE;
@@ -364,13 +381,13 @@ static Direction defaultGhostMovement(Character *c) {
         return RIGHT;
     }
     Direction ranDir = random() % 4;
-    Coordinates coords;
+    Coordinates coords;
     tU8 canMoveBack = FALSE;
     do {
         ranDir = (ranDir + 1) % 4;
         if (c->currentDirection == turnBack(ranDir) && !canMoveBack) {
             ranDir++;
-            canMoveBack = TRUE;
+            canMoveBack = TRUE;
         }
         coords = calculateMove(c->position, ranDir);
     } while (!canMove(coords, c->type));
@@ -380,7 +397,7 @@ static Direction defaultGhostMovement(Character *c) {
 /*****************************************************************************
  *
  * Description:
- *    Calculates the number of points needed to complete the level
+ *    Calculates the number of points on the board layout
  *
  * Returns:
  *    int - number of points needed to complete the level
@@ -389,9 +406,9 @@ static Direction defaultGhostMovement(Character *c) {
 int calculatePointsToComplete() {
     int result = 0;
     int i, j;
-    for (i = 0; i < BOARD_HEIGHT; ++i) {
-        for (j = 0; j < BOARD_WIDTH; ++j) {
-            if (board[i][j] == POINT) {
+    for (i = 0; i < boardHeight; ++i) {
+        for (j = 0; j < boardWidth; ++j) {
+            if (getLayoutField(i, j) == POINT) {
                 ++result;
             }
         }
@@ -402,103 +419,182 @@ int calculatePointsToComplete() {
 /*****************************************************************************
  *
  * Description:
- *    Initializes board, characters and game counters with default values.
+ *    Marks a point or a bonus as eaten.
+ *
+ ****************************************************************************/
+inline static void eatField(Coordinates coords) {
+    tU16 index = coords.y * boardWidth + coords.x;
+    eatenFields[index >> 3] |= 1 << (index & 7);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if a layout can be played: the characters move without
+ *    wrapping around, so the border has to be walls (ghosts pass the doors),
+ *    and the birthplaces of the characters must not be walls.
  *
  * Params:
- *    [in] useDefaultBoard - value that specifies if default board should be used
+ *    [in] layout - layout of the board, row by row
+ *    [in] width - number of fields in a row
+ *    [in] height - number of rows
+ *
+ * Returns:
+ *    tU8 - TRUE if the layout can be played
  *
  ****************************************************************************/
-void initPacman(tU8 useDefaultBoard) {
-    printf("InitPacman rozpoczete\n");
-    defaultBoardUsed = useDefaultBoard;
-    if (useDefaultBoard) {
-        int row, column;
-        for (row = 0; row < BOARD_HEIGHT; ++row) {
-            for (column = 0; column < BOARD_WIDTH; ++column) {
-                board[row][column] = defaultBoard[row][column];
-            }
+tU8 checkBoard(const tU8 *layout, tU8 width, tU8 height) {
+    int i;
+
+    if (width < BOARD_MIN_WIDTH || width > BOARD_MAX_WIDTH
+            || height < BOARD_MIN_HEIGHT || height > BOARD_MAX_HEIGHT) {
+        return FALSE;
+    }
+    for (i = 0; i < width; ++i) {
+        if (WALL != layout[i] || WALL != layout[(height - 1) * width + i]) {
+            return FALSE;
+        }
+    }
+    for (i = 0; i < height; ++i) {
+        if (WALL != layout[i * width] || WALL != layout[i * width + width - 1]) {
+            return FALSE;
+        }
+    }
+    for (i = 0; i <= NUMBER_OF_GHOSTS; ++i) {
+        if (WALL == layout[startFields[i].y * width + startFields[i].x]) {
+            return FALSE;
         }
     }
-    printf("Plansza wczytana do odpowiedniej tablicy\n");
+    return TRUE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Initializes board, characters and game counters with default values.
+ *    The layout is not copied, only the bitmap of eaten fields is cleared.
+ *
+ * Params:
+ *    [in] layout - layout of the board, row by row, has to stay valid
+ *                  during the game, NULL for the default board
+ *    [in] width - number of fields in a row, from BOARD_MIN_WIDTH
+ *                 to BOARD_MAX_WIDTH
+ *    [in] height - number of rows, from BOARD_MIN_HEIGHT to BOARD_MAX_HEIGHT
+ *
+ ****************************************************************************/
+void initPacman(const tU8 *layout, tU8 width, tU8 height) {
+    int i;
+
+    LOG_DEBUG(LOG_PACMAN_INIT);
+    if (!layout) {
+        layout = &defaultBoard[0][0];
+        width = DEFAULT_BOARD_WIDTH;
+        height = DEFAULT_BOARD_HEIGHT;
+    }
+    defaultBoardUsed = (&defaultBoard[0][0] == layout);
+
+    // a custom layout can be read again into the same memory, so it is counted every time
+    if (layout != boardLayout || !defaultBoardUsed) {
+        boardLayout = layout;
+        boardWidth = width;
+        boardHeight = height;
+        layoutPoints = calculatePointsToComplete();
+    }
+    // only the bytes of the fields of the board, the rest is never read
+    for (i = 0; i < (boardWidth * boardHeight + 7) / 8; ++i) {
+        eatenFields[i] = 0;
+    }
+    LOG_DEBUG(LOG_PACMAN_BOARD_LOADED);
 
     ghostEatingMode = FALSE;
     moveToInitPositions = TRUE;
     level = INIT_LEVEL;
     lives = INIT_LIVES;
     score = INIT_SCORE;
-    seed = INIT_SEED;
+    seed = initSeed;
     
-    pointsToCompleteLevel = calculatePointsToComplete();
+    pointsToCompleteLevel = layoutPoints;
 
-    pacman.birthplace.x = 10;
-    pacman.birthplace.y = 15;
+    pacman.birthplace = startFields[0];
     pacman.currentDirection = LEFT;
     pacman.nextDirection = LEFT;
-    pacman.position.x = 10;
-    pacman.position.y = 15;
+    pacman.position = startFields[0];
     pacman.type = PACMAN;
     
     if (!pacman.updateDirection) {
         pacman.updateDirection = defaultGhostMovement;
     }
 
-    ghosts[0].birthplace.x = 10;
-    ghosts[0].birthplace.y = 6;
+    ghosts[0].birthplace = startFields[1];
     ghosts[0].currentDirection = RIGHT;
     ghosts[0].nextDirection = LEFT;
     ghosts[0].homeDirection = LEFT;
     ghosts[0].startTime = 0;
     ghosts[0].timeToStart = 0;
-    ghosts[0].position.x = 10;
-    ghosts[0].position.y = 6;
+    ghosts[0].position = startFields[1];
     ghosts[0].type = GHOST;
     ghosts[0].updateDirection = defaultStayAtHome;
-    ghosts[0].defaultUpdateDirection = defaultGhostMovement;
+    if (!ghosts[0].defaultUpdateDirection) {
+        ghosts[0].defaultUpdateDirection = defaultGhostMovement;
+    }
 
-    ghosts[1].birthplace.x = 10;
-    ghosts[1].birthplace.y = 8;
+    ghosts[1].birthplace = startFields[2];
     ghosts[1].currentDirection = DOWN;
     ghosts[1].nextDirection = DOWN;
     ghosts[1].homeDirection = DOWN;
     ghosts[1].startTime = 8;
     ghosts[1].timeToStart = 8;
-    ghosts[1].position.x = 10;
-    ghosts[1].position.y = 8;
+    ghosts[1].position = startFields[2];
     ghosts[1].type = GHOST;
     ghosts[1].updateDirection = defaultStayAtHome;
-    ghosts[1].defaultUpdateDirection = defaultGhostMovement;
+    if (!ghosts[1].defaultUpdateDirection) {
+        ghosts[1].defaultUpdateDirection = defaultGhostMovement;
+    }
 
-    ghosts[2].birthplace.x = 9;
-    ghosts[2].birthplace.y = 8;
+    ghosts[2].birthplace = startFields[3];
     ghosts[2].currentDirection = LEFT;
     ghosts[2].nextDirection = LEFT;
     ghosts[2].homeDirection = LEFT;
     ghosts[2].startTime = 15;
     ghosts[2].timeToStart = 15;
-    ghosts[2].position.x = 9;
-    ghosts[2].position.y = 8;
+    ghosts[2].position = startFields[3];
     ghosts[2].type = GHOST;
     ghosts[2].updateDirection = defaultStayAtHome;
-    ghosts[2].defaultUpdateDirection = defaultGhostMovement;
+    if (!ghosts[2].defaultUpdateDirection) {
+        ghosts[2].defaultUpdateDirection = defaultGhostMovement;
+    }
 
-    ghosts[3].birthplace.x = 11;
-    ghosts[3].birthplace.y = 8;
+    ghosts[3].birthplace = startFields[4];
     ghosts[3].currentDirection = RIGHT;
     ghosts[3].nextDirection = RIGHT;
     ghosts[3].homeDirection = RIGHT;
     ghosts[3].startTime = 25;
     ghosts[3].timeToStart = 25;
-    ghosts[3].position.x = 11;
-    ghosts[3].position.y = 8;
+    ghosts[3].position = startFields[4];
     ghosts[3].type = GHOST;
     ghosts[3].updateDirection = defaultStayAtHome;
-    ghosts[3].defaultUpdateDirection = defaultGhostMovement;
+    if (!ghosts[3].defaultUpdateDirection) {
+        ghosts[3].defaultUpdateDirection = defaultGhostMovement;
+    }
 
     if (handleLifeLost) {
         handleLifeLost(lives);
     }
 }
 
+/*****************************************************************************
+ *
+ * Description:
+ *    Sets the seed used by the random function after next initialization
+ *
+ * Params:
+ *    [in] initialSeed - seed to be used instead of INIT_SEED
+ *
+ ****************************************************************************/
+void setRandomSeed(int initialSeed) {
+    initSeed = initialSeed;
+}
+
 /*****************************************************************************
  *
  * Description:
@@ -515,7 +611,9 @@ void setDirectionCallback(Direction (*updateDirection)(struct character *)) {
 /*****************************************************************************
  *
  * Description:
- *    Sets callback for changing ghost's direction
+ *    Sets callback for changing ghost's direction.
+ *    The callback steers the ghost once it has left home, so it is kept
+ *    after losing a life or being eaten. NULL restores random movement.
  *
  * Params:
  *    [in] ghost - number indicating for which ghost callback will be used
@@ -524,7 +622,11 @@ void setDirectionCallback(Direction (*updateDirection)(struct character *)) {
  ****************************************************************************/
 void setGhostDirectionCallback(tU8 ghost, Direction (*updateDirection)(struct character *)) {
     if (ghost < NUMBER_OF_GHOSTS) {
-        ghosts[ghost].updateDirection = updateDirection;
+        if (updateDirection) {
+            ghosts[ghost].defaultUpdateDirection = updateDirection;
+        } else {
+            ghosts[ghost].defaultUpdateDirection = defaultGhostMovement;
+        }
     }
 }
 
@@ -537,7 +639,7 @@ void setGhostDirectionCallback(tU8 ghost, Direction (*updateDirection)(struct ch
  *    [in] handler - pointer to function to be used as a callback
  *
  ****************************************************************************/
-void onGameLost(void (*handler)(tU8, tU8)) {
+void onGameLost(void (*handler)(tU8, tU32)) {
     handleGameLost = handler;
 }
 
@@ -563,7 +665,7 @@ void onLifeLost(void (*handler)(tU8)) {
  *    [in] handler - pointer to function to be used as a callback
  *
  ****************************************************************************/
-void onScoreChanged(void (*handler)(tU8)) {
+void onScoreChanged(void (*handler)(tU32)) {
     handleScoreChanged = handler;
 }
 
@@ -576,7 +678,7 @@ void onScoreChanged(void (*handler)(tU8)) {
  *    [in] handler - pointer to function to be used as a callback
  *
  ****************************************************************************/
-void onLevelCompleted(void (*handler)(tU8, tU8)) {
+void onLevelCompleted(void (*handler)(tU8, tU32)) {
     handleLevelComplete = handler;
 }
 
@@ -624,7 +726,8 @@ void onTimeToEatChanged(void (*handler)(tU8)) {
  ****************************************************************************/
 Move *makeMove() {
     tU8 i;
-    static Move moves[1 + NUMBER_OF_GHOSTS];
+    Field field;
+    static PACMAN_TLS Move moves[1 + NUMBER_OF_GHOSTS];
 
     if (moveToInitPositions) {
         moves[0].from = pacman.birthplace;
@@ -709,15 +812,16 @@ Move *makeMove() {
         }
     }
 
-    if (POINT == board[pacman.position.y][pacman.position.x]) {
-        board[pacman.position.y][pacman.position.x] = EMPTY;
+    field = getField(pacman.position.y, pacman.position.x);
+    if (POINT == field) {
+        eatField(pacman.position);
         score++;
         pointsToCompleteLevel--;
         if (handleScoreChanged) {
             handleScoreChanged(score);
         }
-    } else if (BONUS == board[pacman.position.y][pacman.position.x]) {
-        board[pacman.position.y][pacman.position.x] = EMPTY;
+    } else if (BONUS == field) {
+        eatField(pacman.position);
         score += POINTS_FOR_BONUS;
         ghostEatingMode = INIT_TIME_TO_EAT;
         for (i = 0; i < NUMBER_OF_GHOSTS; ++i) {
@@ -22,8 +22,6 @@
 
 // game constants
 #define NUMBER_OF_GHOSTS     4
-#define BOARD_WIDTH         21
-#define BOARD_HEIGHT        21
 #define INIT_TIME_TO_EAT    31
 #define POINTS_FOR_EATING   10
 #define POINTS_FOR_BONUS     5
@@ -34,6 +32,26 @@
 #define INIT_SCORE           0
 #define INIT_SEED          128
 
+// size of the default board
+#define DEFAULT_BOARD_WIDTH     21
+#define DEFAULT_BOARD_HEIGHT    21
+
+// limits of the size of a board read at runtime, the characters start
+// where they do on the default board, so a board is never smaller
+#define BOARD_MIN_WIDTH     DEFAULT_BOARD_WIDTH
+#define BOARD_MIN_HEIGHT    DEFAULT_BOARD_HEIGHT
+#define BOARD_MAX_WIDTH     64
+#define BOARD_MAX_HEIGHT    64
+
+// size of the bitmap of eaten points and bonuses of the biggest board
+#define BOARD_BITMAP_SIZE   ((BOARD_MAX_WIDTH * BOARD_MAX_HEIGHT + 7) / 8)
+
+// storage class of the game state, host tools running several games
+// at once in separate threads define it as thread local
+#ifndef PACMAN_TLS
+#define PACMAN_TLS
+#endif
+
 /*********/
 /* Types */
 /*********/
@@ -70,20 +88,61 @@ typedef struct character {
 /* Extern variables */
 /********************/
 
-extern Field board[BOARD_HEIGHT][BOARD_WIDTH];
+// layout of the default board, in flash
+extern const tU8 defaultBoard[DEFAULT_BOARD_HEIGHT][DEFAULT_BOARD_WIDTH];
+
+// immutable layout of the current board, read in place, row by row
+extern PACMAN_TLS const tU8 *boardLayout;
+
+// size of the current board
+extern PACMAN_TLS tU8 boardWidth;
+extern PACMAN_TLS tU8 boardHeight;
+
+// points and bonuses eaten in the current level, one bit per field
+extern PACMAN_TLS tU8 eatenFields[BOARD_BITMAP_SIZE];
 
 /*************/
 /* Functions */
 /*************/
 
-void initPacman(tU8 useDefaultBoard);
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets a field of the layout of the board, as it was before
+ *    anything was eaten.
+ *
+ ****************************************************************************/
+static inline Field getLayoutField(tU8 row, tU8 column) {
+    return boardLayout[row * boardWidth + column];
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the current state of a field: the layout of the board
+ *    with the eaten points and bonuses removed.
+ *
+ ****************************************************************************/
+static inline Field getField(tU8 row, tU8 column) {
+    tU16 index = row * boardWidth + column;
+    Field field = boardLayout[index];
+
+    if ((POINT == field || BONUS == field) && (eatenFields[index >> 3] & (1 << (index & 7)))) {
+        return EMPTY;
+    }
+    return field;
+}
+
+tU8 checkBoard(const tU8 *layout, tU8 width, tU8 height);
+void initPacman(const tU8 *layout, tU8 width, tU8 height);
+void setRandomSeed(int initialSeed);
 void setDirectionCallback(Direction (*updateDirection)(struct character *c));
 void setGhostDirectionCallback(tU8 ghost, Direction (*updateDirection)(struct character *c));
-void onGameLost(void (*handler)(tU8 level, tU8 score));
+void onGameLost(void (*handler)(tU8 level, tU32 score));
 void onLifeLost(void (*handler)(tU8 lifes));
-void onScoreChanged(void (*handler)(tU8 score));
+void onScoreChanged(void (*handler)(tU32 score));
 void onTimeToEatChanged(void (*handler)(tU8 remainingTime));
-void onLevelCompleted(void (*handler)(tU8 level, tU8 score));
+void onLevelCompleted(void (*handler)(tU8 level, tU32 score));
 void onGhostEaten(void (*handler)());
 Move *makeMove();
 
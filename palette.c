@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * File:
+ *    palette.c
+ *
+ * Description:
+ *    Colour animations done by rewriting the RGBSET lookup table.
+ *
+ *    The table has 20 entries, so every change costs 21 bytes on the bus,
+ *    whatever part of the screen uses the animated colors. The effects are
+ *    advanced by paletteUpdate(), called by the owner of the LCD, which
+ *    sends the table only when one of its levels has changed.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "lcd.h"
+#include "clock.h"
+#include "palette.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// entries of the table animated by one effect
+#define EFFECT_ENTRIES      2
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 entries[EFFECT_ENTRIES];    // animated entries of the table
+    tU8 rest[EFFECT_ENTRIES];       // their levels while the effect is off
+    tU8 lit[EFFECT_ENTRIES];        // their levels in the first half of a flash
+    tU16 halfPeriodMs;
+    tU8 flashes;                    // 0 flashes until stopped
+} EffectDefinition;
+
+/*************/
+/* Variables */
+/*************/
+
+static const EffectDefinition effects[PALETTE_EFFECTS] = {
+    // PALETTE_FRIGHTENED_END: light blue and white
+    {
+        { LCD_PALETTE_RED + PALETTE_GHOST_RED, LCD_PALETTE_GREEN + PALETTE_GHOST_GREEN },
+        { 4, 13 }, { 15, 15 }, 150, 0
+    },
+    // PALETTE_MAZE_FLASH: grey and white
+    {
+        { LCD_PALETTE_RED + PALETTE_WALL_RED, LCD_PALETTE_GREEN + PALETTE_WALL_GREEN },
+        { 6, 6 }, { 15, 15 }, 250, 4
+    }
+};
+
+// levels sent to the controller
+static tU8 levels[LCD_PALETTE_SIZE];
+
+static tBool running[PALETTE_EFFECTS];
+static tU32 started[PALETTE_EFFECTS];
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if an effect is in the lit half of a flash and stops it
+ *    after its last flash.
+ *
+ ****************************************************************************/
+static tBool isLit(PaletteEffect effect) {
+    const EffectDefinition *definition = &effects[effect];
+    tU32 halfPeriods;
+
+    if (!running[effect]) {
+        return FALSE;
+    }
+
+    halfPeriods = CLOCK_SINCE(started[effect]) / CLOCK_CYCLES_PER_MS / definition->halfPeriodMs;
+    if (definition->flashes && halfPeriods >= 2 * definition->flashes) {
+        running[effect] = FALSE;
+        return FALSE;
+    }
+    return 0 == (halfPeriods & 1);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Programs the lookup table with the levels of all effects at rest.
+ *    Has to be called after lcdInit().
+ *
+ ****************************************************************************/
+void paletteInit(void) {
+    tU8 effect, i;
+
+    for (i = 0; i < LCD_PALETTE_SIZE; ++i) {
+        levels[i] = lcdDefaultPalette[i];
+    }
+    for (effect = 0; effect < PALETTE_EFFECTS; ++effect) {
+        running[effect] = FALSE;
+        for (i = 0; i < EFFECT_ENTRIES; ++i) {
+            levels[effects[effect].entries[i]] = effects[effect].rest[i];
+        }
+    }
+    lcdPalette(levels);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Starts an effect (again) from its first flash.
+ *
+ ****************************************************************************/
+void paletteStart(PaletteEffect effect) {
+    started[effect] = CLOCK_NOW();
+    running[effect] = TRUE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Stops an effect, its colors return to rest on the next update.
+ *
+ ****************************************************************************/
+void paletteStop(PaletteEffect effect) {
+    running[effect] = FALSE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if an effect is still flashing.
+ *
+ ****************************************************************************/
+tBool paletteRunning(PaletteEffect effect) {
+    return running[effect];
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Advances the effects and sends the lookup table if it changed.
+ *    Has to be called by the process drawing on the LCD.
+ *
+ ****************************************************************************/
+void paletteUpdate(void) {
+    tBool changed = FALSE;
+    tU8 effect, i;
+
+    for (effect = 0; effect < PALETTE_EFFECTS; ++effect) {
+        const tU8 *wanted = isLit(effect) ? effects[effect].lit : effects[effect].rest;
+        for (i = 0; i < EFFECT_ENTRIES; ++i) {
+            if (levels[effects[effect].entries[i]] != wanted[i]) {
+                levels[effects[effect].entries[i]] = wanted[i];
+                changed = TRUE;
+            }
+        }
+    }
+
+    if (changed) {
+        lcdPalette(levels);
+    }
+}
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ * File:
+ *    palette.h
+ *
+ * Description:
+ *    Colour animations done by rewriting the RGBSET lookup table of the LCD
+ *    controller instead of repainting the screen. Every effect flashes a few
+ *    levels of the table reserved for the elements it animates.
+ *
+ *****************************************************************************/
+
+#ifndef _PALETTE_H_
+#define _PALETTE_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// levels of the lookup table reserved for the effects, the colors
+// of other elements must not use them (see display.h)
+#define PALETTE_GHOST_RED       2
+#define PALETTE_GHOST_GREEN     2
+#define PALETTE_WALL_RED        3
+#define PALETTE_WALL_GREEN      3
+
+/*********/
+/* Types */
+/*********/
+
+typedef enum {
+    PALETTE_FRIGHTENED_END,     // eatable ghosts flash white until stopped
+    PALETTE_MAZE_FLASH,         // walls flash white a few times
+    PALETTE_EFFECTS
+} PaletteEffect;
+
+/*************/
+/* Functions */
+/*************/
+
+void paletteInit(void);
+void paletteStart(PaletteEffect effect);
+void paletteStop(PaletteEffect effect);
+tBool paletteRunning(PaletteEffect effect);
+void paletteUpdate(void);
+
+#endif
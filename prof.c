@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ * File:
+ *    prof.c
+ *
+ * Description:
+ *    Lightweight profiler measuring named zones of the game loop
+ *    with the cycle clock. Statistics are printed to the consol.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "prof.h"
+#include "startup/printf_P.h"
+#include "startup/consol.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// consol character requesting the statistics
+#define PROF_DUMP_CHAR  'p'
+
+/*************/
+/* Variables */
+/*************/
+
+ProfStats profStats[PROF_ZONES];
+
+static const char *zoneNames[PROF_ZONES] = {
+    "frame",
+    "displayBoard",
+    "makeMove",
+    "changeGameSpeed",
+    "animation",
+    "osSleep",
+    "inputLatency",
+    "remoteLatency"
+};
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Clears statistics of all zones.
+ *
+ ****************************************************************************/
+void profReset(void) {
+    tU8 zone;
+
+    for (zone = 0; zone < PROF_ZONES; ++zone) {
+        profStats[zone].count = 0;
+        profStats[zone].min = 0xffffffff;
+        profStats[zone].max = 0;
+        profStats[zone].total = 0;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Prints min/avg/max durations of all zones in microseconds.
+ *
+ ****************************************************************************/
+void profDump(void) {
+    tU8 zone;
+
+    printf("\nProfiler (us): zone count min avg max\n");
+    for (zone = 0; zone < PROF_ZONES; ++zone) {
+        ProfStats *stats = &profStats[zone];
+        if (0 == stats->count) {
+            printf("%s 0\n", zoneNames[zone]);
+            continue;
+        }
+        printf("%s %u %u %u %u\n", zoneNames[zone], stats->count,
+               stats->min / CLOCK_CYCLES_PER_US,
+               (tU32) (stats->total / stats->count) / CLOCK_CYCLES_PER_US,
+               stats->max / CLOCK_CYCLES_PER_US);
+    }
+#if (UART_API_NONBLOCKING == 1)
+    printf("consol dropped %u\n", consolGetDropped());
+#endif
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Prints the statistics if they were requested on the consol.
+ *
+ ****************************************************************************/
+void profPoll(void) {
+    char received;
+
+    if (consolGetChar(&received) && PROF_DUMP_CHAR == received) {
+        profDump();
+    }
+}
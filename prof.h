@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * File:
+ *    prof.h
+ *
+ * Description:
+ *    Lightweight profiler measuring named zones of the game loop
+ *    with the cycle clock.
+ *
+ *****************************************************************************/
+
+#ifndef _PROF_H_
+#define _PROF_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "clock.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// set to 0 to compile the profiler out of the game loop
+#ifndef PROFILING
+#define PROFILING 1
+#endif
+
+#if PROFILING
+
+// opens a zone, has to be closed with PROF_END in the same block
+#define PROF_BEGIN(zone)    tU32 profStart_##zone = CLOCK_NOW()
+
+// closes a zone and records its duration
+#define PROF_END(zone)      profRecord(zone, CLOCK_SINCE(profStart_##zone))
+
+#else
+
+#define PROF_BEGIN(zone)
+#define PROF_END(zone)
+
+#endif
+
+/*********/
+/* Types */
+/*********/
+
+typedef enum {
+    PROF_FRAME,
+    PROF_DISPLAY_BOARD,
+    PROF_MAKE_MOVE,
+    PROF_GAME_SPEED,
+    PROF_ANIMATION,
+    PROF_SLEEP,
+    PROF_INPUT_LATENCY,
+    PROF_REMOTE_LATENCY,
+    PROF_ZONES
+} ProfZone;
+
+typedef struct {
+    tU32 count;
+    tU32 min;
+    tU32 max;
+    unsigned long long total;
+} ProfStats;
+
+/********************/
+/* Extern variables */
+/********************/
+
+extern ProfStats profStats[PROF_ZONES];
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Adds a measured duration to the statistics of given zone.
+ *
+ * Params:
+ *    [in] zone - measured zone
+ *    [in] cycles - duration of the zone in cycles
+ *
+ ****************************************************************************/
+static inline void profRecord(ProfZone zone, tU32 cycles) {
+    ProfStats *stats = &profStats[zone];
+
+    stats->count++;
+    stats->total += cycles;
+    if (cycles < stats->min) {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max) {
+        stats->max = cycles;
+    }
+}
+
+void profReset(void);
+void profDump(void);
+void profPoll(void);
+
+#endif
@@ -0,0 +1,242 @@
+/******************************************************************************
+ *
+ * File:
+ *    remote.c
+ *
+ * Description:
+ *    Remote control of the game over Bluetooth.
+ *    Parses direction commands from the bytes received by the Bluetooth
+ *    layer and queues them with the arrival time of their last byte,
+ *    so the latency up to the applied move can be measured.
+ *
+ *    Ghosts of remote players are steered by callbacks that only read
+ *    the last accepted direction. When no frame arrived since the previous
+ *    move the last direction is kept, so the game loop never waits for
+ *    the radio and jitter adds no latency to the frame.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "remote.h"
+#include "clock.h"
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    Direction direction;
+    tU32 timestamp;
+} RemoteCommand;
+
+/*************/
+/* Variables */
+/*************/
+
+static RemoteCommand commands[REMOTE_QUEUE_SIZE];
+static tU8 commandsHead = 0;
+static tU8 commandsTail = 0;
+
+// TRUE after REMOTE_COMMAND, while waiting for the direction letter
+static tU8 commandStarted = FALSE;
+
+// direction of remoteDirection() when no command is pending
+static Direction remoteCurrent = LEFT;
+
+static RemotePlayer players[NUMBER_OF_GHOSTS];
+
+// bytes of the ghost frame being received, 0 if none
+static tU8 ghostFrame[REMOTE_GHOST_FRAME];
+static tU8 ghostFrameLength = 0;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Direction callback of a ghost steered by a remote player.
+ *    Keeps the last direction if no new frame arrived and hands the ghost
+ *    back to the default movement when the player stops sending.
+ *
+ * Params:
+ *    [in] player - index of the player and of the ghost
+ *    [in] c - the ghost
+ *
+ * Returns:
+ *    Direction - next direction of the ghost
+ *
+ ****************************************************************************/
+static Direction remoteGhostDirection(tU8 player, struct character *c) {
+    RemotePlayer *remote = &players[player];
+
+    if (CLOCK_SINCE(remote->lastFrame) >= REMOTE_PLAYER_TIMEOUT * CLOCK_CYCLES_PER_MS) {
+        remote->joined = FALSE;
+        setGhostDirectionCallback(player, NULL);
+        return c->currentDirection;
+    }
+
+    if (remote->fresh) {
+        remote->fresh = FALSE;
+    } else {
+        remote->predicted++;
+    }
+    return remote->direction;
+}
+
+// the callback does not know which ghost it steers, so each has its own
+static Direction remoteGhost0(struct character *c) { return remoteGhostDirection(0, c); }
+static Direction remoteGhost1(struct character *c) { return remoteGhostDirection(1, c); }
+static Direction remoteGhost2(struct character *c) { return remoteGhostDirection(2, c); }
+static Direction remoteGhost3(struct character *c) { return remoteGhostDirection(3, c); }
+
+static Direction (*const remoteGhosts[NUMBER_OF_GHOSTS])(struct character *c) = {
+    remoteGhost0, remoteGhost1, remoteGhost2, remoteGhost3
+};
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Validates a complete ghost frame and updates the direction
+ *    of its player. The first valid frame of a player takes over the ghost.
+ *
+ * Params:
+ *    [in] timestamp - cycle clock value of the frame arrival
+ *
+ ****************************************************************************/
+static void receiveGhostFrame(tU32 timestamp) {
+    tU8 player = ghostFrame[1];
+    tU8 sequence = ghostFrame[2];
+    tU8 direction = ghostFrame[3];
+    RemotePlayer *remote;
+
+    if (player >= NUMBER_OF_GHOSTS) {
+        return;
+    }
+    remote = &players[player];
+
+    if ((tU8) (player + sequence + direction) != ghostFrame[4] || direction > DOWN
+            || (remote->joined && (tS8) (sequence - remote->lastSequence) <= 0)) {
+        remote->dropped++;
+        return;
+    }
+
+    remote->lastSequence = sequence;
+    remote->direction = direction;
+    remote->lastFrame = timestamp;
+    remote->fresh = TRUE;
+    remote->accepted++;
+
+    if (!remote->joined) {
+        remote->joined = TRUE;
+        setGhostDirectionCallback(player, remoteGhosts[player]);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Parses one byte received over Bluetooth.
+ *    Registered with onBluetoothData().
+ *
+ * Params:
+ *    [in] received - received byte
+ *    [in] timestamp - cycle clock value of the byte arrival
+ *
+ ****************************************************************************/
+void remoteReceive(tU8 received, tU32 timestamp) {
+    Direction direction;
+
+    if (ghostFrameLength > 0) {
+        ghostFrame[ghostFrameLength++] = received;
+        if (REMOTE_GHOST_FRAME == ghostFrameLength) {
+            ghostFrameLength = 0;
+            receiveGhostFrame(timestamp);
+        }
+        return;
+    }
+    if (REMOTE_GHOST_SYNC == received && !commandStarted) {
+        ghostFrame[ghostFrameLength++] = received;
+        return;
+    }
+
+    if (!commandStarted) {
+        commandStarted = (REMOTE_COMMAND == received);
+        return;
+    }
+    commandStarted = FALSE;
+
+    switch (received) {
+        case 'L': direction = LEFT; break;
+        case 'R': direction = RIGHT; break;
+        case 'U': direction = UP; break;
+        case 'D': direction = DOWN; break;
+        default: return;
+    }
+
+    // the oldest command is overwritten if the game does not keep up
+    if ((tU8) (commandsHead - commandsTail) >= REMOTE_QUEUE_SIZE) {
+        commandsTail++;
+    }
+    commands[commandsHead & (REMOTE_QUEUE_SIZE - 1)].direction = direction;
+    commands[commandsHead & (REMOTE_QUEUE_SIZE - 1)].timestamp = timestamp;
+    commandsHead++;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Takes the oldest pending remote direction command.
+ *
+ * Params:
+ *    [out] direction - commanded direction
+ *    [out] timestamp - cycle clock value of the command arrival
+ *
+ * Returns:
+ *    tU8 - TRUE if a command was pending
+ *
+ ****************************************************************************/
+tU8 pollRemoteDirection(Direction *direction, tU32 *timestamp) {
+    if (commandsHead == commandsTail) {
+        return FALSE;
+    }
+
+    *direction = commands[commandsTail & (REMOTE_QUEUE_SIZE - 1)].direction;
+    *timestamp = commands[commandsTail & (REMOTE_QUEUE_SIZE - 1)].timestamp;
+    commandsTail++;
+    return TRUE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Direction callback steering a character only by remote commands,
+ *    for setDirectionCallback() in fully remote or automated play.
+ *
+ * Params:
+ *    [in] c - a moving character
+ *
+ * Returns:
+ *    Direction - last commanded direction
+ *
+ ****************************************************************************/
+Direction remoteDirection(struct character *c) {
+    tU32 timestamp;
+
+    pollRemoteDirection(&remoteCurrent, &timestamp);
+    return remoteCurrent;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the state and statistics of given remote player.
+ *
+ ****************************************************************************/
+const RemotePlayer *getRemotePlayer(tU8 player) {
+    return &players[player];
+}
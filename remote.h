@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ * File:
+ *    remote.h
+ *
+ * Description:
+ *    Remote control of the game over Bluetooth.
+ *
+ *    A direction command is REMOTE_COMMAND followed by one of the letters
+ *    'L', 'R', 'U' or 'D'. Any other received text is ignored.
+ *
+ *    A ghost frame steers the ghost of one remote player:
+ *       REMOTE_GHOST_SYNC, player (0-3), sequence number, direction
+ *       (the Direction value), checksum (8-bit sum of the three bytes)
+ *    Frames with a sequence number not newer than the last accepted one
+ *    of the player are dropped.
+ *
+ *****************************************************************************/
+
+#ifndef _REMOTE_H_
+#define _REMOTE_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "pacman.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define REMOTE_COMMAND      '>'
+
+// capacity of the remote command queue, has to be a power of two
+#define REMOTE_QUEUE_SIZE   8
+
+#define REMOTE_GHOST_SYNC   0xA6
+#define REMOTE_GHOST_FRAME  5
+
+// a player leaves the game after this many milliseconds without frames
+#define REMOTE_PLAYER_TIMEOUT 5000
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 joined;
+    tU8 lastSequence;
+    Direction direction;
+    tU32 lastFrame;         // cycle clock value of the last accepted frame
+    tU32 accepted;
+    tU32 dropped;
+    tU32 predicted;         // moves made without a new frame
+    tU8 fresh;              // a frame arrived since the last move
+} RemotePlayer;
+
+/*************/
+/* Functions */
+/*************/
+
+void remoteReceive(tU8 received, tU32 timestamp);
+tU8 pollRemoteDirection(Direction *direction, tU32 *timestamp);
+Direction remoteDirection(struct character *c);
+const RemotePlayer *getRemotePlayer(tU8 player);
+
+#endif
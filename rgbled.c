@@ -13,10 +13,28 @@
 #include <printf_P.h>
 #include <lpc2xxx.h>
 
+/***********/
+/* Defines */
+/***********/
+
+// PINSEL0 setting of P0.8 = TxD1 and P0.9 = RxD1
+#define UART1_PINS 0x00050000
+
 /*************/
 /* Functions */
 /*************/
 
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if only the red component can be shown, because P0.8 and P0.9
+ *    are taken by UART #1 (Bluetooth).
+ *
+ ****************************************************************************/
+tBool isRGBLedRedOnly(void) {
+    return UART1_PINS == (PINSEL0 & 0x000f0000);
+}
+
 /*****************************************************************************
  *
  * Description:
@@ -28,7 +46,12 @@
  *
  ****************************************************************************/
 void setRGBLedColor(tU8 r, tU8 g, tU8 b) {
-    PINSEL0 = (PINSEL0 & 0xfff03fff) | 0x000a8000; //Enable PWM2 on P0.7, PWM4 on P0.8, and PWM6 on P0.9
+    if (isRGBLedRedOnly()) {
+        // drive only the red component
+        PINSEL0 = (PINSEL0 & 0xffff3fff) | 0x00008000; //Enable PWM2 on P0.7
+    } else {
+        PINSEL0 = (PINSEL0 & 0xfff03fff) | 0x000a8000; //Enable PWM2 on P0.7, PWM4 on P0.8, and PWM6 on P0.9
+    }
 
     PWM_PR = 0x00; // Prescale Register - PWM_TC will be incremented each tick
     PWM_MCR = 0x02; // Match Control Register - Reset on PWMMR0: the PWMTC will be reset if PWMMR0 matches it
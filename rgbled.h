@@ -12,6 +12,7 @@
 /* Functions */
 /*************/
 
+tBool isRGBLedRedOnly(void);
 void setRGBLedColor(tU8 r, tU8 g, tU8 b);
 
 #endif /* RGBLED_H_ */
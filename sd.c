@@ -20,7 +20,7 @@
 #include "sd.h"
 #include "spi.h"
 
-#include "startup/printf_P.h"
+#include "log.h"
 
 
 /*************/
@@ -174,28 +174,28 @@ WORD sdResp16b() {
 void sdResp8bError(BYTE value) {
 	switch(value){
 		case 0x40:
-			printf("Argument out of bounds.\n");
+			LOG_ERROR(LOG_SD_ARGUMENT);
 			break;
 		case 0x20:
-			printf("Address out of bounds.\n");
+			LOG_ERROR(LOG_SD_ADDRESS);
 			break;
 		case 0x10:
-			printf("Error during erase sequence.\n");
+			LOG_ERROR(LOG_SD_ERASE_SEQUENCE);
 			break;
 		case 0x08:
-			printf("CRC failed.\n");
+			LOG_ERROR(LOG_SD_CRC);
 			break;
 		case 0x04:
-			printf("Illegal command.\n");
+			LOG_ERROR(LOG_SD_ILLEGAL_COMMAND);
 			break;
 		case 0x02:
-			printf("Erase reset (see SanDisk docs p5-13).\n");
+			LOG_ERROR(LOG_SD_ERASE_RESET);
 			break;
 		case 0x01:
-			printf("Card is initialising.\n");
+			LOG_ERROR(LOG_SD_IDLE);
 			break;
 		default:
-			printf("Unknown error 0x%x (see SanDisk docs p5-13).\n",value);
+			LOG_ERROR(LOG_SD_R1_UNKNOWN, value);
 			break;
 	}
 }
@@ -222,34 +222,34 @@ CHAR sdState() {
 		case 0x000:
 			return 1;
 		case 0x0001:
-			printf("Card is Locked.\n");
+			LOG_ERROR(LOG_SD_LOCKED);
 			break;
 		case 0x0002:
-			printf("WP Erase Skip, Lock/Unlock Cmd Failed.\n");
+			LOG_ERROR(LOG_SD_LOCK_FAILED);
 			break;
 		case 0x0004:
-			printf("General / Unknown error -- card broken?.\n");
+			LOG_ERROR(LOG_SD_GENERAL);
 			break;
 		case 0x0008:
-			printf("Internal card controller error.\n");
+			LOG_ERROR(LOG_SD_CONTROLLER);
 			break;
 		case 0x0010:
-			printf("Card internal ECC was applied, but failed to correct the data.\n");
+			LOG_ERROR(LOG_SD_ECC);
 			break;
 		case 0x0020:
-			printf("Write protect violation.\n");
+			LOG_ERROR(LOG_SD_WRITE_PROTECT);
 			break;
 		case 0x0040:
-			printf("An invalid selection, sectors for erase.\n");
+			LOG_ERROR(LOG_SD_ERASE_PARAM);
 			break;
 		case 0x0080:
-			printf("Out of Range, CSD_Overwrite.\n");
+			LOG_ERROR(LOG_SD_OUT_OF_RANGE);
 			break;
 		default:
 			if(value > 0x00FF) {
 				sdResp8bError((BYTE) (value >> 8));
 			} else {
-				printf("Unknown error: 0x%x (see SanDisk docs).\n", value);
+				LOG_ERROR(LOG_SD_R2_UNKNOWN, value);
 			}
 			break;
 	}
@@ -6,7 +6,7 @@
 /************/
 
 #include "pff.h"
-#include "startup/printf_P.h"
+#include "log.h"
 #include "pre_emptive_os/api/general.h"
 #include "sdcard.h"
 
@@ -33,9 +33,9 @@ static tU8 findAndInitSD() {
 	result = pf_mount(&fatfs);
 	if (result) {
 		if (FR_DISK_ERR == result || FR_NOT_READY == result) {
-			printf("Blad interfejsu");
+			LOG_ERROR(LOG_SD_MOUNT_ERROR);
 		} else if (FR_NO_FILESYSTEM == result) {
-			printf("Nieprawidlowy system plikow lub jego brak na karcie pamieci");
+			LOG_ERROR(LOG_SD_NO_FILESYSTEM);
 		}
 		
 		return FALSE;
@@ -44,49 +44,92 @@ static tU8 findAndInitSD() {
 	return TRUE;
 }
 
-// Reads board from SD card. 
-tU8 readBoard(Field *board, tU8 boardHeight, tU8 boardWidth) {
+// Reads board from SD card: rows of field digits, all of the same length.
+// The file is read in parts of the buffer, the size of the board is taken
+// from the rows and the board is checked by checkBoard() of pacman.c.
+tU8 readBoard(tU8 *board, tU8 maxHeight, tU8 maxWidth, tU8 *height, tU8 *width) {
 
 	tU8 initResult = findAndInitSD();
 	if (initResult == FALSE) {
 		return initResult;
 	}
 	
-	printf("Proba otwarcia pliku z plansza.\n");
+	LOG_DEBUG(LOG_SD_OPENING);
 	result = pf_open("board.txt");
 	if (result) {
-		printf("Nie udalo sie otworzyc pliku.\n");
+		LOG_ERROR(LOG_SD_OPEN_FAILED);
 		if (FR_NO_FILE == result) {
-			printf("Nie ma takiego pliku\n");
+			LOG_ERROR(LOG_SD_NO_FILE);
 		} else if (FR_NOT_ENABLED == result) {
-			printf("Problem z systemem plikow\n");
+			LOG_ERROR(LOG_SD_FILESYSTEM_ERROR);
 		}
 		
 		return FALSE;
 	}
 	
-	printf("Proba odczytu z pliku z plansza.\n");
+	LOG_DEBUG(LOG_SD_READING);
 	WORD bytesRead = 0;
-	result = pf_read(boardBuffer, BOARD_BUFFER_SIZE, &bytesRead);
-	printf("Odczyt zakonczony\n");
-	if (result) {
-		printf("Nie udalo sie odczytac wszystkich danych z pliku. Odczytano %d bajtow\n", bytesRead);
-		return FALSE;
-	} else {
-		printf("Odczytano wszystkie dane z pliku.\n");
-	}
-	
-	int i, j = 0;
-	for (i = 0; i < BOARD_BUFFER_SIZE && boardBuffer[i] != 0; ++i) {
-		if (boardBuffer[i] == '\n' || boardBuffer[i] == '\r') {
-			continue;
+	WORD i;
+	tU16 j = 0;
+	tU8 rows = 0, column = 0, rowWidth = 0;
+	do {
+		result = pf_read(boardBuffer, BOARD_BUFFER_SIZE, &bytesRead);
+		if (result) {
+			LOG_ERROR(LOG_SD_READ_SHORT, bytesRead);
+			return FALSE;
 		}
 		
-		board[j] = boardBuffer[i] - '0';
-		++j;
+		for (i = 0; i < bytesRead; ++i) {
+			tU8 c = boardBuffer[i];
+			if (c == '\r') {
+				continue;
+			}
+			
+			if (c == '\n') {
+				// empty lines, e.g. at the end of the file, are skipped
+				if (column == 0) {
+					continue;
+				}
+				if (rows == 0) {
+					rowWidth = column;
+				} else if (column != rowWidth) {
+					LOG_ERROR(LOG_SD_BOARD_INVALID, rows + 1);
+					return FALSE;
+				}
+				++rows;
+				column = 0;
+				continue;
+			}
+			
+			if (c < '0' || c > '0' + DOORS || rows >= maxHeight || column >= maxWidth) {
+				LOG_ERROR(LOG_SD_BOARD_INVALID, rows + 1);
+				return FALSE;
+			}
+			board[j++] = c - '0';
+			++column;
+		}
+	} while (bytesRead == BOARD_BUFFER_SIZE);
+	LOG_DEBUG(LOG_SD_READ_DONE);
+	
+	// the last row without a line break
+	if (column > 0) {
+		if (rows > 0 && column != rowWidth) {
+			LOG_ERROR(LOG_SD_BOARD_INVALID, rows + 1);
+			return FALSE;
+		}
+		rowWidth = column;
+		++rows;
+	}
+	// the size, a border of walls and the birthplaces of the characters
+	if (!checkBoard(board, rowWidth, rows)) {
+		LOG_ERROR(LOG_SD_BOARD_INVALID, rows);
+		return FALSE;
 	}
-	printf("Wprowadzono dane do tablicy.\n");
+	
+	*height = rows;
+	*width = rowWidth;
+	LOG_DEBUG(LOG_SD_BOARD_STORED);
+	LOG_INFO(LOG_SD_BOARD_SIZE, rowWidth, rows);
 	
 	return TRUE;
 }
-
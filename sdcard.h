@@ -7,7 +7,8 @@
 /* Functions */
 /*************/
 
-// Reads board from SD card. 
-tU8 readBoard(Field *board, tU8 boardHeight, tU8 boardWidth);
+// Reads board from SD card into board, row by row, with room for
+// maxHeight rows of maxWidth fields. Returns the size of the board read.
+tU8 readBoard(tU8 *board, tU8 maxHeight, tU8 maxWidth, tU8 *height, tU8 *width);
 
 #endif
@@ -18,6 +18,7 @@
 
 
 #include "spi.h"
+#include "spibus.h"
 #include "integer.h"
 
 
@@ -32,7 +33,9 @@ BYTE incoming;
 /*****************************************************************************
  *
  * Description:
- *      Initializes SPI to work with SD cards
+ *      Initializes SPI to work with SD cards. The pins and the mode
+ *      of the controller belong to the bus manager (spibus.c), the caller
+ *      has to own the bus.
  *
  ****************************************************************************/
 void initSpi(void){
@@ -43,16 +46,6 @@ void initSpi(void){
 	// set Chip-Select high - unselect card
 	UNSELECT_CARD();
 
-	// reset Pin-Functions
-	SPI_PINSEL &= ~( (3 << SPI_SCK_FUNCBIT) | (3 << SPI_MISO_FUNCBIT) |
-		(3 << SPI_MOSI_FUNCBIT) | (3 << SPI_SS_FUNCBIT) );
-
-	SPI_PINSEL |= ( (1 << SPI_SCK_FUNCBIT) | (1 << SPI_MISO_FUNCBIT) |
-		(1 << SPI_MOSI_FUNCBIT) );
-
-	// enable SPI-Master
-	S0SPCR = (1 << MSTR) | (0 << CPOL);
-
 	// low speed during init
 	setSpiSpeed(254);
 
@@ -68,7 +61,8 @@ void initSpi(void){
 /*****************************************************************************
  *
  * Description:
- *      Sets SPI speed.
+ *      Sets SPI speed of the SD card, kept by the bus manager
+ *      for the next time the card owns the bus.
  *
  * Params:
  *      [in] speed - speed to set
@@ -80,7 +74,7 @@ void setSpiSpeed(BYTE speed){
 		speed = SPI_PRESCALE_MIN;
 	}
 
-	SPI_PRESCALE_REG = speed;
+	spiBusSetPrescaler(SPI_BUS_SD, speed);
 }
 
 
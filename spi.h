@@ -23,6 +23,7 @@
 
 #include "integer.h"
 #include "startup/lpc2xxx.h"
+#include "fastcode.h"
 
 
 /***********/
@@ -65,7 +66,7 @@ void initSpi(void);
 
 void setSpiSpeed(BYTE speed);
 
-BYTE spiSend(BYTE toSend);
+FASTCODE BYTE spiSend(BYTE toSend);
 
 
 #endif //_SPI_H
@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * File:
+ *    spibus.c
+ *
+ * Description:
+ *    Manager of the SPI0 bus shared by the LCD controller and the SD card.
+ *
+ *    Both devices use the same SCK, MISO and MOSI pins, each with its own
+ *    chip select driven as GPIO. The manager keeps the mode (control
+ *    register and clock prescaler) of every client and the mode the
+ *    controller is programmed with, so the registers are written only
+ *    when the bus passes to a client with a different mode.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/osapi.h"
+#include "startup/lpc2xxx.h"
+#include "spibus.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// master mode, CPOL = CPHA = 0, 8 bits per transfer
+#define SPI_MASTER          0x20
+
+// SCK, MISO and MOSI functions of P0.4 - P0.6 in PINSEL0
+#define SPI_PINSEL_MASK     0x00003f00
+#define SPI_PINSEL_SPI      0x00001500
+
+/*********/
+/* Types */
+/*********/
+
+typedef struct {
+    tU8 control;
+    tU8 prescaler;
+} SpiBusMode;
+
+/*************/
+/* Variables */
+/*************/
+
+// the SD card starts at a low clock, see initSpi()
+static SpiBusMode modes[SPI_BUS_CLIENTS] = {
+    { SPI_MASTER, 8 },      // SPI_BUS_LCD
+    { SPI_MASTER, 254 }     // SPI_BUS_SD
+};
+
+// mode the controller is programmed with
+static SpiBusMode current;
+
+// client owning the bus, SPI_BUS_CLIENTS when the bus is free
+static SpiBusClient owner = SPI_BUS_CLIENTS;
+
+// count of 1 while the bus is free
+static tCntSem busFree;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Programs the controller with the mode of given client, skipping
+ *    the registers that already hold the right values.
+ *
+ ****************************************************************************/
+static void applyMode(SpiBusClient client) {
+    if (current.prescaler != modes[client].prescaler) {
+        current.prescaler = modes[client].prescaler;
+        S0SPCCR = current.prescaler;
+    }
+    if (current.control != modes[client].control) {
+        current.control = modes[client].control;
+        S0SPCR = current.control;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Connects the SPI pins and marks the bus as free. Has to be called
+ *    before any of the drivers uses the bus.
+ *
+ ****************************************************************************/
+void spiBusInit(void) {
+    PINSEL0 = (PINSEL0 & ~SPI_PINSEL_MASK) | SPI_PINSEL_SPI;
+
+    // unknown mode, the first owner programs all registers
+    current.control = 0;
+    current.prescaler = 0;
+    owner = SPI_BUS_CLIENTS;
+
+    osSemInit(&busFree, 1);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Waits until the bus is free and takes it for given client.
+ *    The controller is reprogrammed only if the mode of the client differs
+ *    from the mode of the previous owner.
+ *
+ * Params:
+ *    [in] client - device about to be selected
+ *
+ ****************************************************************************/
+void spiBusAcquire(SpiBusClient client) {
+    tU8 error;
+
+    osSemTake(&busFree, 0, &error);
+    owner = client;
+    applyMode(client);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Frees the bus after the device of the owner has been deselected.
+ *
+ ****************************************************************************/
+void spiBusRelease(void) {
+    tU8 error;
+
+    owner = SPI_BUS_CLIENTS;
+    osSemGive(&busFree, &error);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Changes the clock prescaler of a client. It is applied at once if
+ *    the client owns the bus, otherwise when it gets the bus next time.
+ *
+ * Params:
+ *    [in] client - device using the clock
+ *    [in] prescaler - even divider of the peripheral clock, at least 8
+ *
+ ****************************************************************************/
+void spiBusSetPrescaler(SpiBusClient client, tU8 prescaler) {
+    modes[client].prescaler = prescaler;
+    if (owner == client) {
+        applyMode(client);
+    }
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ * File:
+ *    spibus.h
+ *
+ * Description:
+ *    Manager of the SPI0 bus shared by the LCD controller and the SD card.
+ *    A client owns the bus between spiBusAcquire() and spiBusRelease(),
+ *    other processes wait for it on a semaphore.
+ *
+ *****************************************************************************/
+
+#ifndef _SPIBUS_H_
+#define _SPIBUS_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+/*********/
+/* Types */
+/*********/
+
+typedef enum {
+    SPI_BUS_LCD,
+    SPI_BUS_SD,
+    SPI_BUS_CLIENTS
+} SpiBusClient;
+
+/*************/
+/* Functions */
+/*************/
+
+void spiBusInit(void);
+void spiBusAcquire(SpiBusClient client);
+void spiBusRelease(void);
+void spiBusSetPrescaler(SpiBusClient client, tU8 prescaler);
+
+#endif
@@ -71,8 +71,9 @@
 #define CONSOL_UART              0
 #define CONSOL_BITRATE       38400
 /*#define USE_UART_FIFO             FALSE  */      /* Will be added in a future release */
-/*#define UART_API_NONBLOCKING      FALSE  */      /* Will be added in a future release */
-/*#define UART_API_NONBLOCKING_SIZE   512  */      /* Will be added in a future release */
+#define UART_API_NONBLOCKING          1            /* 1 = printf() queues characters in a ring sent by
+                                                      the uart interrupt, characters are dropped when full */
+#define UART_API_NONBLOCKING_SIZE   512            /* Size of the ring, has to be a power of two */
 #define CONSOL_STARTUP_DELAY                       /* Short startup delay in order to remove
                                                       risk for false startbit detection,
                                                       timer #1 will be used in polled mode */
@@ -36,6 +36,26 @@
 
 #define UART_DLL_VALUE (unsigned short)((PCLK / (CONSOL_BITRATE * 16.0)) + 0.5)
 
+#if (UART_API_NONBLOCKING == 1)
+#define CONSOL_TX_MASK     (UART_API_NONBLOCKING_SIZE - 1)
+#define CONSOL_VIC_CHANNEL (6 + CONSOL_UART)   // uart #0 = 6, uart #1 = 7
+#define CONSOL_VIC_SLOT    5
+#endif
+
+/*************/
+/* Variables */
+/*************/
+
+#if (UART_API_NONBLOCKING == 1)
+// transmit ring, head is written by printf(), tail by the interrupt;
+// printf() must not be called from interrupts
+static char consolTxBuf[UART_API_NONBLOCKING_SIZE];
+static volatile unsigned int consolTxHead = 0;
+static volatile unsigned int consolTxTail = 0;
+static volatile unsigned char consolTxRunning = 0;
+static volatile unsigned int consolTxDropped = 0;
+#endif
+
 #if (CONSOLE_API_SCANF == 1)  // SIMPLE
 #define __isalpha(c) (c >'9')
 #define __isupper(c) !(c & 0x20)
@@ -181,6 +201,93 @@ reswitch:
 }
 #endif
 
+#if (UART_API_NONBLOCKING == 1)
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Consol uart ISR, moves characters from the transmit ring to the uart
+ *    FIFO (up to 16 at a time) and stops when the ring is empty.
+ *
+ ****************************************************************************/
+static void consolISR(void) {
+    volatile unsigned char statusReg;
+    volatile unsigned char dummy;
+    unsigned int bytesToSend;
+
+    //loop until not more interrupt sources
+    while (((statusReg = UART_IIR) & 0x01) == 0) {
+        if ((statusReg & 0x0e) == 0x02) {  //Transmit Holding Register Empty
+            if (consolTxHead == consolTxTail) {
+                consolTxRunning = 0;
+                UART_IER &= ~0x02;          //disable TX IRQ
+            } else {
+                bytesToSend = 16;
+                do {
+                    consolTxTail = (consolTxTail + 1) & CONSOL_TX_MASK;
+                    UART_THR = consolTxBuf[consolTxTail];
+                } while ((consolTxHead != consolTxTail) && --bytesToSend);
+            }
+        } else {
+            dummy = UART_LSR;
+            dummy = UART_RBR;
+        }
+    }
+
+    VICVectAddr = 0x00000000;    //dummy write to VIC to signal end of interrupt
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking consol output routine. Queues the character in the
+ *    transmit ring or drops it (and counts it) if the ring is full.
+ *
+ * Params:
+ *    [in] charToSend - The character to print (to the consol)
+ *
+ ****************************************************************************/
+static void consolQueueChar(char charToSend) {
+    unsigned int tmpHead = (consolTxHead + 1) & CONSOL_TX_MASK;
+
+    if (tmpHead == consolTxTail) {
+        consolTxDropped++;
+        return;
+    }
+    consolTxBuf[tmpHead] = charToSend;
+    consolTxHead = tmpHead;
+
+    // start the transmission if the interrupt is not running it already
+    VICIntEnClr = (1 << CONSOL_VIC_CHANNEL);
+    if (!consolTxRunning) {
+        consolTxRunning = 1;
+        consolTxTail = (consolTxTail + 1) & CONSOL_TX_MASK;
+        UART_THR = consolTxBuf[consolTxTail];
+        UART_IER |= 0x02;           //enable TX IRQ
+    }
+    VICIntEnable = (1 << CONSOL_VIC_CHANNEL);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking consol output routine that adds extra line feeds at line
+ *    breaks.
+ *
+ * Params:
+ *    [in] charToSend - The character to print (to the consol)
+ *
+ ****************************************************************************/
+static void consolQueueCh(char charToSend) {
+    if ('\n' == charToSend) {
+        consolQueueChar('\r');
+    }
+
+    consolQueueChar(charToSend);
+}
+
+#endif
+
 /******************************************************************************
  * Implementation of public functions
  *****************************************************************************/
@@ -211,11 +318,28 @@ void consolInit(void) {
     //initialize LCR: 8N1
     UART_LCR = 0x03;
 
+#if (UART_API_NONBLOCKING == 1)
+    //enable and reset FIFOs
+    UART_FCR = 0x07;
+#else
     //reset FIFO
     UART_FCR = 0x00;
+#endif
 
     //clear interrupt bits
     UART_IER = 0x00;
+
+#if (UART_API_NONBLOCKING == 1)
+    consolTxHead = 0;
+    consolTxTail = 0;
+    consolTxRunning = 0;
+
+    //initialize the interrupt vector, the TX IRQ is enabled when data is queued
+    VICIntSelect &= ~(1 << CONSOL_VIC_CHANNEL);
+    VICVectCntl5 = 0x20 | CONSOL_VIC_CHANNEL;
+    VICVectAddr5 = (unsigned int) consolISR;
+    VICIntEnable = (1 << CONSOL_VIC_CHANNEL);
+#endif
 }
 
 /*****************************************************************************
@@ -223,6 +347,7 @@ void consolInit(void) {
  * Description:
  *    Blocking consol output routine, i.e., the routine waits until the uart 
  *    buffer is free and then sends the character. 
+ *    Bypasses the transmit ring, so it can be used by exception handlers.
  *
  * Params:
  *    [in] charToSend - The character to print (to the consol) 
@@ -362,11 +487,68 @@ void simplePrintf(const char * fmt, ...) {
     va_list ap;
 
     va_start(ap, fmt);
+#if (UART_API_NONBLOCKING == 1)
+    simplePrint(consolQueueCh, fmt, ap);
+#else
     simplePrint(consolSendCh, fmt, ap);
+#endif
     va_end(ap);
 }
 #endif
 
+#if (UART_API_NONBLOCKING == 1)
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the number of characters dropped by printf() because the transmit
+ *    ring was full.
+ *
+ ****************************************************************************/
+unsigned int consolGetDropped(void) {
+    return consolTxDropped;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Queues raw bytes (without line break translation) in the transmit ring.
+ *    The bytes are queued all together or, if they don't fit, all dropped.
+ *
+ * Params:
+ *    [in] pBytes - bytes to send
+ *    [in] count  - number of bytes
+ *
+ * Returns:
+ *    unsigned char - 1 if the bytes were queued, 0 if they were dropped
+ *
+ ****************************************************************************/
+unsigned char consolQueueBytes(const unsigned char *pBytes, unsigned int count) {
+    // the transmit interrupt only frees space, so the check stays valid
+    unsigned int space = (consolTxTail - consolTxHead - 1) & CONSOL_TX_MASK;
+
+    if (count > space) {
+        consolTxDropped += count;
+        return 0;
+    }
+    while (count--) {
+        consolQueueChar(*pBytes++);
+    }
+    return 1;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Waits until all queued characters have been passed to the uart.
+ *
+ ****************************************************************************/
+void consolFlush(void) {
+    while (consolTxRunning)
+        ;
+}
+#endif
+
 
 #if (CONSOLE_API_SCANF == 1)  //SIMPLE
 
@@ -134,6 +134,44 @@ void simplePrintf(const char * fmt,
                   ...          );
 #endif
 
+#if (UART_API_NONBLOCKING == 1)
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the number of characters dropped by printf() because the transmit
+ *    ring was full. 
+ *
+ ****************************************************************************/
+unsigned int consolGetDropped(void);
+
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Queues raw bytes (without line break translation) in the transmit ring.
+ *    The bytes are queued all together or, if they don't fit, all dropped.
+ *
+ * Params:
+ *    [in] pBytes - bytes to send
+ *    [in] count  - number of bytes
+ *
+ * Returns:
+ *    unsigned char - 1 if the bytes were queued, 0 if they were dropped
+ *
+ ****************************************************************************/
+unsigned char consolQueueBytes(const unsigned char *pBytes,
+                               unsigned int count);
+
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Waits until all queued characters have been passed to the uart. 
+ *
+ ****************************************************************************/
+void consolFlush(void);
+#endif
+
 #if (CONSOLE_API_SCANF == 1)  // SIMPLE
 
 /*****************************************************************************
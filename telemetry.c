@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * File:
+ *    telemetry.c
+ *
+ * Description:
+ *    Live stream of the game state sent over Bluetooth.
+ *    One frame is sent per game step. Characters move by at most one field
+ *    per step, so most frames are deltas taking one byte per character.
+ *    Frames are queued in the UART #1 transmit buffer without blocking;
+ *    a frame that does not fit is dropped and the next one is a keyframe.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "telemetry.h"
+#include "uart.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define CHARACTERS          (NUMBER_OF_GHOSTS + 1)
+#define HEADER_SIZE         4
+#define MAX_FRAME_SIZE      (HEADER_SIZE + 6 + 3 * CHARACTERS + 1)
+
+/*************/
+/* Variables */
+/*************/
+
+// state known to the receiver after the last frame
+static Coordinates lastPositions[CHARACTERS];
+static tU32 lastScore;
+static tU8 lastLives;
+static tU8 lastTimeToEat;
+
+static tU8 sequence = 0;
+static tU8 framesToKeyframe = 0;
+static tU32 droppedFrames = 0;
+
+static tU8 frame[MAX_FRAME_SIZE];
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Encodes a move of one character as a delta step code.
+ *
+ * Returns:
+ *    tU8 - step code, 0xff if the character moved more than one field
+ *
+ ****************************************************************************/
+static tU8 encodeStep(Coordinates from, Coordinates to) {
+    if (from.x == to.x && from.y == to.y) return TELEMETRY_STAY;
+    if (from.y == to.y && from.x == to.x + 1) return TELEMETRY_LEFT;
+    if (from.y == to.y && from.x + 1 == to.x) return TELEMETRY_RIGHT;
+    if (from.x == to.x && from.y == to.y + 1) return TELEMETRY_UP;
+    if (from.x == to.x && from.y + 1 == to.y) return TELEMETRY_DOWN;
+    return 0xff;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Builds a delta frame payload.
+ *
+ * Returns:
+ *    tU8 - payload length, 0 if the state can not be delta-encoded
+ *
+ ****************************************************************************/
+static tU8 encodeDelta(tU8 *payload, Move *moves, tU32 score, tU8 lives, tU8 timeToEat) {
+    tU8 length = 1 + CHARACTERS;
+    tU8 flags = 0;
+    tU8 i;
+
+    for (i = 0; i < CHARACTERS; ++i) {
+        tU8 step = encodeStep(lastPositions[i], moves[i].to);
+        if (0xff == step) {
+            return 0;
+        }
+        payload[1 + i] = step | (moves[i].type << 3);
+    }
+
+    if (score != lastScore) {
+        // the score only grows in small steps, bigger changes need a keyframe
+        if (score < lastScore || score - lastScore > 0xff) {
+            return 0;
+        }
+        flags |= TELEMETRY_SCORE_CHANGED;
+        payload[length++] = score - lastScore;
+    }
+    if (lives != lastLives) {
+        flags |= TELEMETRY_LIVES_CHANGED;
+        payload[length++] = lives;
+    }
+    if (timeToEat != lastTimeToEat) {
+        flags |= TELEMETRY_TIME_CHANGED;
+        payload[length++] = timeToEat;
+    }
+    payload[0] = flags;
+
+    return length;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Builds a keyframe payload.
+ *
+ * Returns:
+ *    tU8 - payload length
+ *
+ ****************************************************************************/
+static tU8 encodeKeyframe(tU8 *payload, Move *moves, tU32 score, tU8 lives, tU8 timeToEat) {
+    tU8 length = 0;
+    tU8 i;
+
+    payload[length++] = score;
+    payload[length++] = score >> 8;
+    payload[length++] = score >> 16;
+    payload[length++] = score >> 24;
+    payload[length++] = lives;
+    payload[length++] = timeToEat;
+    for (i = 0; i < CHARACTERS; ++i) {
+        payload[length++] = moves[i].type;
+        payload[length++] = moves[i].to.x;
+        payload[length++] = moves[i].to.y;
+    }
+
+    return length;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Makes the next frame a keyframe, e.g. after a new device has connected.
+ *
+ ****************************************************************************/
+void resetTelemetry(void) {
+    framesToKeyframe = 0;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Sends a frame describing the current game step. Never blocks.
+ *
+ * Params:
+ *    [in] moves - moves returned by makeMove()
+ *    [in] score - current score
+ *    [in] lives - number of lives left
+ *    [in] timeToEat - remaining time of eating ghosts
+ *
+ ****************************************************************************/
+void sendTelemetry(Move *moves, tU32 score, tU8 lives, tU8 timeToEat) {
+    tU8 *payload = &frame[HEADER_SIZE];
+    tU8 length = 0;
+    tU8 checksum = 0;
+    tU8 i;
+
+    if (framesToKeyframe > 0) {
+        length = encodeDelta(payload, moves, score, lives, timeToEat);
+    }
+    if (0 == length) {
+        length = encodeKeyframe(payload, moves, score, lives, timeToEat);
+        frame[1] = TELEMETRY_KEYFRAME;
+    } else {
+        frame[1] = TELEMETRY_DELTA;
+    }
+
+    frame[0] = TELEMETRY_SYNC;
+    frame[2] = sequence++;
+    frame[3] = length;
+    for (i = 1; i < HEADER_SIZE + length; ++i) {
+        checksum += frame[i];
+    }
+    frame[HEADER_SIZE + length] = checksum;
+
+    if (!uart1TrySendChars(frame, HEADER_SIZE + length + 1)) {
+        // the receiver misses this frame, so it can not apply the next delta
+        droppedFrames++;
+        framesToKeyframe = 0;
+        return;
+    }
+
+    for (i = 0; i < CHARACTERS; ++i) {
+        lastPositions[i] = moves[i].to;
+    }
+    lastScore = score;
+    lastLives = lives;
+    lastTimeToEat = timeToEat;
+
+    if (TELEMETRY_KEYFRAME == frame[1]) {
+        framesToKeyframe = TELEMETRY_KEYFRAME_INTERVAL;
+    }
+    framesToKeyframe--;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the number of frames dropped because the link was too slow
+ *
+ ****************************************************************************/
+tU32 getDroppedTelemetryFrames(void) {
+    return droppedFrames;
+}
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * File:
+ *    telemetry.h
+ *
+ * Description:
+ *    Live stream of the game state sent over Bluetooth.
+ *
+ *    Frame layout:
+ *       sync (0xA5), kind, sequence number, payload length, payload, checksum
+ *    The checksum is the 8-bit sum of all bytes after sync.
+ *
+ *    Keyframe payload:
+ *       score (4 bytes, little endian), lives, time to eat,
+ *       then type, x, y of every character
+ *    Delta payload:
+ *       flags, one byte per character (step code in bits 0-2, type in
+ *       bits 3-4), then score increase, lives and time to eat if flagged
+ *       as changed
+ *
+ *****************************************************************************/
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "pacman.h"
+
+/***********/
+/* Defines */
+/***********/
+
+#define TELEMETRY_SYNC          0xA5
+#define TELEMETRY_KEYFRAME      'K'
+#define TELEMETRY_DELTA         'D'
+
+// a keyframe is sent at least once every this many frames
+#define TELEMETRY_KEYFRAME_INTERVAL 32
+
+// flags of a delta frame
+#define TELEMETRY_SCORE_CHANGED 0x01
+#define TELEMETRY_LIVES_CHANGED 0x02
+#define TELEMETRY_TIME_CHANGED  0x04
+
+// step codes of a delta frame
+#define TELEMETRY_STAY          0
+#define TELEMETRY_LEFT          1
+#define TELEMETRY_RIGHT         2
+#define TELEMETRY_UP            3
+#define TELEMETRY_DOWN          4
+
+/*************/
+/* Functions */
+/*************/
+
+void resetTelemetry(void);
+void sendTelemetry(Move *moves, tU32 score, tU8 lives, tU8 timeToEat);
+tU32 getDroppedTelemetryFrames(void);
+
+#endif
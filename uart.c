@@ -30,6 +30,7 @@ volatile tU32 uart1TxTail = 0;
 volatile tU8 uart1TxRunning = FALSE;
 
 tU8 uart1RxBuf[RX_BUFFER_SIZE];
+tU32 uart1RxTime[RX_BUFFER_SIZE];
 volatile tU32 uart1RxHead = 0;
 volatile tU32 uart1RxTail = 0;
 
@@ -240,3 +241,73 @@ tU8 uart1GetChar(tU8 *pRxChar) {
     *pRxChar = uart1RxBuf[tmpTail];
     return TRUE;
 }
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking receive function returning also the arrival time
+ *    of the character.
+ *
+ * Params:
+ *    [in] pRxChar - Pointer to buffer where the received character shall
+ *                   be placed.
+ *    [in] pRxTime - Pointer to buffer where the cycle clock value of the
+ *                   receive interrupt shall be placed.
+ *
+ * Return:
+ *    TRUE if character was received, else FALSE.
+ *
+ ****************************************************************************/
+tU8 uart1GetCharStamped(tU8 *pRxChar, tU32 *pRxTime) {
+    tU32 tmpTail;
+
+    /* buffer is empty */
+    if (uart1RxHead == uart1RxTail) {
+        return FALSE;
+    }
+
+    tmpTail = (uart1RxTail + 1) & RX_BUFFER_MASK;
+    uart1RxTail = tmpTail;
+
+    *pRxChar = uart1RxBuf[tmpTail];
+    *pRxTime = uart1RxTime[tmpTail];
+    return TRUE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the number of characters that can be queued for transmission
+ *    without blocking.
+ *
+ * Return:
+ *    Number of free places in the transmit buffer.
+ *
+ ****************************************************************************/
+tU16 uart1TxSpace(void) {
+    return (uart1TxTail - uart1TxHead - 1) & TX_BUFFER_MASK;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking output of a fixed number of bytes. The bytes are queued
+ *    only if all of them fit into the transmit buffer.
+ *
+ * Params:
+ *    [in] pBuff - The characters to print (to uart #1)
+ *    [in] count - Number of characters to print
+ *
+ * Return:
+ *    TRUE if the characters were queued, FALSE if there was not enough space.
+ *
+ ****************************************************************************/
+tU8 uart1TrySendChars(tU8 *pBuff, tU16 count) {
+    if (count > uart1TxSpace()) {
+        return FALSE;
+    }
+
+    // only this process adds to the buffer, so the space can only grow
+    uart1SendChars((char *) pBuff, count);
+    return TRUE;
+}
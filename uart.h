@@ -178,4 +178,53 @@ tU8 uart1GetCh(void);
  ****************************************************************************/
 tU8 uart1GetChar(tU8 *pRxChar);
 
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking receive function returning also the arrival time
+ *    of the character.
+ *
+ * Params:
+ *    [in] pRxChar - Pointer to buffer where the received character shall
+ *                   be placed.
+ *    [in] pRxTime - Pointer to buffer where the cycle clock value of the
+ *                   receive interrupt shall be placed.
+ *
+ * Return:
+ *    TRUE if character was received, else FALSE.
+ *
+ ****************************************************************************/
+tU8 uart1GetCharStamped(tU8 *pRxChar, tU32 *pRxTime);
+
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the number of characters that can be queued for transmission
+ *    without blocking.
+ *
+ * Return:
+ *    Number of free places in the transmit buffer.
+ *
+ ****************************************************************************/
+tU16 uart1TxSpace(void);
+
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Non-blocking output of a fixed number of bytes. The bytes are queued
+ *    only if all of them fit into the transmit buffer.
+ *
+ * Params:
+ *    [in] pBuff - The characters to print (to uart #1)
+ *    [in] count - Number of characters to print
+ *
+ * Return:
+ *    TRUE if the characters were queued, FALSE if there was not enough space.
+ *
+ ****************************************************************************/
+tU8 uart1TrySendChars(tU8 *pBuff, tU16 count);
+
 #endif
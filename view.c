@@ -0,0 +1,421 @@
+/******************************************************************************
+ *
+ * File:
+ *    view.c
+ *
+ * Description:
+ *    Draws the part of the board under the camera.
+ *
+ *    The board area of the LCD is the vertical scroll area of the controller.
+ *    Its memory holds VIEW_HEIGHT rows of fields in a ring: a row of the
+ *    board is drawn on the lines of (row * FIELD_SIZE - scrollBase) modulo
+ *    the height of the area. When the camera moves a row up or down, the area
+ *    is scrolled by FIELD_SIZE lines and only the row coming into view is
+ *    drawn, over the one that left. The controller has no horizontal
+ *    scrolling, so a sideways move of the camera redraws the whole area;
+ *    the camera then jumps to put Pacman in the middle, so it happens
+ *    seldom. Boards of the size of the screen never scroll.
+ *
+ *****************************************************************************/
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+
+#include "lcd.h"
+#include "display.h"
+#include "pacman.h"
+#include "view.h"
+
+/*********/
+/* Types */
+/*********/
+
+// lines of the board generated for lcdBlit()
+typedef struct {
+    const tU8 *eaten;
+    tU16 firstLine;     // line of the board from the top of its first row
+} BoardLines;
+
+/*************/
+/* Variables */
+/*************/
+
+// Top-left field under the camera.
+static tU8 cameraX;
+static tU8 cameraY;
+
+// Line of the board drawn on the first line of the scroll area and the
+// number of lines the area is scrolled by.
+static tU16 scrollBase;
+static tU8 scrollOffset;
+
+// The board is taller than the screen and the board area scrolls.
+static tBool scrolling;
+
+/*************/
+/* Functions */
+/*************/
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Limits a position of the camera to the board.
+ *
+ * Params:
+ *    [in] camera - wanted first field under the camera
+ *    [in] viewFields - fields under the camera
+ *    [in] boardFields - fields of the board
+ *
+ * Returns:
+ *    tU8 - first field under the camera
+ *
+ ****************************************************************************/
+static tU8 clampCamera(int camera, tU8 viewFields, tU8 boardFields) {
+    if (camera > boardFields - viewFields) {
+        camera = boardFields - viewFields;
+    }
+    if (camera < 0) {
+        camera = 0;
+    }
+    return camera;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets the line of the scroll area a line of the board is drawn on.
+ *
+ * Params:
+ *    [in] line - line of pixels from the top of the board
+ *
+ * Returns:
+ *    tU8 - line from the top of the scroll area memory
+ *
+ ****************************************************************************/
+static tU8 getAreaLine(int line) {
+    line = (line - scrollBase) % VIEW_PIXELS_Y;
+    return line < 0 ? line + VIEW_PIXELS_Y : line;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets x coordinate of the first pixel in given column.
+ *
+ * Params:
+ *    [in] column - column number (columns' numbers start from 0)
+ *
+ * Returns:
+ *    tU8 - x coordinate of the left side of the column
+ *
+ ****************************************************************************/
+static tU8 getX(tU8 column) {
+    return TOP_LEFT_X + (column - cameraX) * FIELD_SIZE;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets y coordinate of the first pixel in given row.
+ *
+ * Params:
+ *    [in] row - row number (rows' numbers start from 0)
+ *
+ * Returns:
+ *    tU8 - y coordinate of the top side of the row in the scroll area
+ *
+ ****************************************************************************/
+static tU8 getY(tU8 row) {
+    return TOP_LEFT_Y + getAreaLine(row * FIELD_SIZE);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Checks if a field is under the camera.
+ *
+ ****************************************************************************/
+static tBool isVisible(Coordinates coords) {
+    return coords.x >= cameraX && coords.x < cameraX + VIEW_WIDTH
+           && coords.y >= cameraY && coords.y < cameraY + VIEW_HEIGHT;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Gets a field of the board as it was with given points eaten.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *    [in] row - row of the field
+ *    [in] column - column of the field
+ *
+ * Returns:
+ *    Field - the field
+ *
+ ****************************************************************************/
+static Field getEatenField(const tU8 *eaten, tU8 row, tU8 column) {
+    tU16 index = row * boardWidth + column;
+    Field field = boardLayout[index];
+
+    if ((POINT == field || BONUS == field) && (eaten[index >> 3] & (1 << (index & 7)))) {
+        return EMPTY;
+    }
+    return field;
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Generates one line of pixels of the board under the camera from
+ *    the tiles of its fields.
+ *
+ * Params:
+ *    [in] line - line of pixels from the first line of the context
+ *    [out] pixels - colors of the line
+ *    [in] context - BoardLines with the bitmap of the eaten fields
+ *
+ ****************************************************************************/
+static void getBoardLine(tU8 line, tU8 *pixels, const void *context) {
+    // tiles of the fields in the order of Field
+    static const tU8 fieldTiles[] = {TILE_EMPTY, TILE_WALL, TILE_POINT, TILE_BONUS, TILE_DOORS};
+    const BoardLines *lines = (const BoardLines *) context;
+    tU16 boardLine = lines->firstLine + line;
+    tU8 row = boardLine / FIELD_SIZE;
+    tU8 tileLine = boardLine % FIELD_SIZE;
+    tU8 column, i;
+
+    for (column = cameraX; column < cameraX + VIEW_WIDTH; ++column) {
+        const tU8 *tile = tiles[fieldTiles[getEatenField(lines->eaten, row, column)]][tileLine];
+        for (i = 0; i < FIELD_SIZE; ++i) {
+            *pixels++ = tile[i];
+        }
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays the rows of the board under the camera in a single window.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *    [in] row - first row
+ *    [in] rows - number of rows, not wrapping around the scroll area
+ *
+ ****************************************************************************/
+static void displayRows(const tU8 *eaten, tU8 row, tU8 rows) {
+    BoardLines lines;
+
+    lines.eaten = eaten;
+    lines.firstLine = row * FIELD_SIZE;
+    lcdBlit(TOP_LEFT_X, getY(row), VIEW_PIXELS_X, rows * FIELD_SIZE, getBoardLine, &lines);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Places the camera with given field in the middle and, on boards
+ *    taller than the screen, makes the board area the scroll area.
+ *
+ * Params:
+ *    [in] target - field to show, Pacman's position
+ *
+ ****************************************************************************/
+void viewInit(Coordinates target) {
+    cameraX = clampCamera(target.x - VIEW_WIDTH / 2, VIEW_WIDTH, boardWidth);
+    cameraY = clampCamera(target.y - VIEW_HEIGHT / 2, VIEW_HEIGHT, boardHeight);
+    scrollBase = cameraY * FIELD_SIZE;
+    scrollOffset = 0;
+
+    scrolling = boardHeight > VIEW_HEIGHT;
+    if (scrolling) {
+        lcdScrollArea(TOP_LEFT_Y, VIEW_PIXELS_Y);
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Moves the camera to keep given field VIEW_MARGIN fields from the edges
+ *    of the screen. A move by one row scrolls the board area and draws the
+ *    row that comes into view, any other move redraws the whole board.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *    [in] target - field to follow, Pacman's position
+ *
+ * Returns:
+ *    tBool - TRUE if the whole board was redrawn
+ *
+ ****************************************************************************/
+tBool viewFollow(const tU8 *eaten, Coordinates target) {
+    tU8 x = cameraX;
+    tU8 y = cameraY;
+
+    // sideways the camera jumps, every move redraws the board
+    if (target.x < cameraX + VIEW_MARGIN || target.x >= cameraX + VIEW_WIDTH - VIEW_MARGIN) {
+        x = clampCamera(target.x - VIEW_WIDTH / 2, VIEW_WIDTH, boardWidth);
+    }
+    if (target.y < cameraY + VIEW_MARGIN) {
+        y = clampCamera(target.y - VIEW_MARGIN, VIEW_HEIGHT, boardHeight);
+    } else if (target.y >= cameraY + VIEW_HEIGHT - VIEW_MARGIN) {
+        y = clampCamera(target.y - VIEW_HEIGHT + VIEW_MARGIN + 1, VIEW_HEIGHT, boardHeight);
+    }
+
+    if (x == cameraX && y == cameraY) {
+        return FALSE;
+    }
+    if (x != cameraX || y > cameraY + 1 || y + 1 < cameraY) {
+        cameraX = x;
+        cameraY = y;
+        viewDisplayBoard(eaten);
+        return TRUE;
+    }
+
+    // the new row takes the lines of the row that leaves
+    displayRows(eaten, y > cameraY ? y + VIEW_HEIGHT - 1 : y, 1);
+    scrollOffset = getAreaLine(y * FIELD_SIZE);
+    lcdScroll(scrollOffset);
+    cameraY = y;
+    return FALSE;
+}
+
+tBool viewScrolled(void) {
+    return 0 != scrollOffset;
+}
+
+void viewEnd(void) {
+    if (scrolling) {
+        lcdScrollArea(0, 0);
+        scrolling = FALSE;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays the board under the camera in a single window, without
+ *    the commands of a window for every field. The board area is
+ *    scrolled back, so its lines are the lines of the screen again.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *
+ ****************************************************************************/
+void viewDisplayBoard(const tU8 *eaten) {
+    scrollBase = cameraY * FIELD_SIZE;
+    if (scrollOffset) {
+        scrollOffset = 0;
+        lcdScroll(0);
+    }
+    displayRows(eaten, cameraY, VIEW_HEIGHT);
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays a field of the board as it was with given points eaten,
+ *    if it is under the camera.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *    [in] row - row of the field
+ *    [in] column - column of the field
+ *
+ ****************************************************************************/
+void viewDisplayField(const tU8 *eaten, tU8 row, tU8 column) {
+    Coordinates coords = {column, row};
+    tU8 x, y;
+
+    if (!isVisible(coords)) {
+        return;
+    }
+    x = getX(column);
+    y = getY(row);
+
+    switch (getEatenField(eaten, row, column)) {
+        case EMPTY:
+            displayEmptyField(x, y);
+            break;
+        case WALL:
+            displayWall(x, y);
+            break;
+        case POINT:
+            displayPoint(x, y);
+            break;
+        case BONUS:
+            displayBonus(x, y);
+            break;
+        case DOORS:
+            displayDoors(x, y);
+            break;
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays only the fields under the camera marked in the bitmap
+ *    of changes.
+ *
+ * Params:
+ *    [in] eaten - bitmap of the eaten points and bonuses
+ *    [in] changed - bitmap of the fields to display
+ *
+ ****************************************************************************/
+void viewDisplayChangedFields(const tU8 *eaten, const tU8 *changed) {
+    tU8 row, column;
+    tU16 index;
+
+    for (row = cameraY; row < cameraY + VIEW_HEIGHT; ++row) {
+        index = row * boardWidth + cameraX;
+        for (column = cameraX; column < cameraX + VIEW_WIDTH; ++column, ++index) {
+            if (0 == changed[index >> 3]) {
+                // the rest of the byte is unchanged
+                column += 7 - (index & 7);
+                index |= 7;
+            } else if (changed[index >> 3] & (1 << (index & 7))) {
+                viewDisplayField(eaten, row, column);
+            }
+        }
+    }
+}
+
+/*****************************************************************************
+ *
+ * Description:
+ *    Displays a character in given step of movement, if it moves
+ *    between fields under the camera.
+ *
+ * Params:
+ *    [in] move - a structure representing the moving character and its direction
+ *    [in] animationStep - the step of animation (from 0 to FIELD_SIZE - 1)
+ *
+ ****************************************************************************/
+void viewDisplayCharacter(Move move, tU8 animationStep) {
+    tU8 x, y;
+
+    if (!isVisible(move.from) || !isVisible(move.to)) {
+        return;
+    }
+    x = getX(move.from.x) + animationStep * (move.to.x - move.from.x);
+    y = TOP_LEFT_Y + getAreaLine(move.from.y * FIELD_SIZE + animationStep * (move.to.y - move.from.y));
+    switch (move.type) {
+        case GHOST:
+            displayGhost(x, y);
+            break;
+        case PACMAN:
+            displayPacman(x, y);
+            break;
+        case EATABLE_GHOST:
+            displayEatableGhost(x, y);
+            break;
+        case EYES:
+            displayEyes(x, y);
+            break;
+    }
+}
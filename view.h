@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * File:
+ *    view.h
+ *
+ * Description:
+ *    Part of the board shown on the screen. Boards bigger than the screen
+ *    are followed by a camera: the board area of the LCD is scrolled by
+ *    the controller when the camera moves up or down and redrawn when
+ *    it moves sideways.
+ *
+ *****************************************************************************/
+
+#ifndef _VIEW_H_
+#define _VIEW_H_
+
+/************/
+/* Includes */
+/************/
+
+#include "pre_emptive_os/api/general.h"
+#include "display.h"
+#include "pacman.h"
+
+/***********/
+/* Defines */
+/***********/
+
+// position of the top-left corner of the board
+#define TOP_LEFT_X          1
+#define TOP_LEFT_Y          1
+
+// fields shown on the screen, the whole default board
+#define VIEW_WIDTH          DEFAULT_BOARD_WIDTH
+#define VIEW_HEIGHT         DEFAULT_BOARD_HEIGHT
+
+// size of the shown part of the board in pixels
+#define VIEW_PIXELS_X       (VIEW_WIDTH * FIELD_SIZE)
+#define VIEW_PIXELS_Y       (VIEW_HEIGHT * FIELD_SIZE)
+
+// fields kept between Pacman and the edges of the screen
+#define VIEW_MARGIN         5
+
+/*************/
+/* Functions */
+/*************/
+
+// places the camera over given field and sets up scrolling
+void viewInit(Coordinates target);
+
+// moves the camera after given field, TRUE if the board was redrawn
+tBool viewFollow(const tU8 *eaten, Coordinates target);
+
+// TRUE if the board area is scrolled, e.g. under a text on the screen
+tBool viewScrolled(void);
+
+// ends scrolling after the game
+void viewEnd(void);
+
+void viewDisplayBoard(const tU8 *eaten);
+void viewDisplayField(const tU8 *eaten, tU8 row, tU8 column);
+void viewDisplayChangedFields(const tU8 *eaten, const tU8 *changed);
+void viewDisplayCharacter(Move move, tU8 animationStep);
+
+#endif